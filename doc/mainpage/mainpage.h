@@ -1,12 +1,13 @@
 /**
  * @mainpage  LibDriver BMP180
  * @brief     LibDriver BMP180 is a full-featured driver of BMP180 and it can run in both MCU and Linux platform.
- * @version   2.0.0
+ * @version   2.1.0
  * @author    Shifeng Li
  *
  * <h3>History</h3>
  * <table>
  * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>2.1      <td>Shifeng Li  <td>add the split-phase api and performance modules
  * <tr><td>2021/02/21  <td>2.0      <td>Shifeng Li  <td>format the code
  * <tr><td>2020/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
  * </table>
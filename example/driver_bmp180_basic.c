@@ -23,13 +23,14 @@
  *
  * @file      driver_bmp180_basic.c
  * @brief     driver bmp180 basic source file
- * @version   2.0.0
+ * @version   2.1.0
  * @author    Shifeng Li
  * @date      2021-02-21
  *
  * <h3>history</h3>
  * <table>
  * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>2.1      <td>Shifeng Li  <td>add the split-phase api and performance modules
  * <tr><td>2021/02/21  <td>2.0      <td>Shifeng Li  <td>format the code
  * <tr><td>2020/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
  * </table>
@@ -57,6 +58,10 @@ uint8_t bmp180_basic_init(void)
     DRIVER_BMP180_LINK_IIC_READ(&gs_handle, bmp180_interface_iic_read);
     DRIVER_BMP180_LINK_IIC_WRITE(&gs_handle, bmp180_interface_iic_write);
     DRIVER_BMP180_LINK_DELAY_MS(&gs_handle, bmp180_interface_delay_ms);
+    DRIVER_BMP180_LINK_DELAY_US(&gs_handle, bmp180_interface_delay_us);
+    DRIVER_BMP180_LINK_TIMESTAMP_MS(&gs_handle, bmp180_interface_timestamp_ms);
+    DRIVER_BMP180_LINK_TIMESTAMP_NS(&gs_handle, bmp180_interface_timestamp_ns);
+    DRIVER_BMP180_LINK_WAIT_EOC(&gs_handle, bmp180_interface_wait_eoc);
     DRIVER_BMP180_LINK_DEBUG_PRINT(&gs_handle, bmp180_interface_debug_print);
     
     /* bmp180 init */
@@ -81,6 +86,8 @@ uint8_t bmp180_basic_init(void)
     return 0;
 }
 
+#if (BMP180_FLOAT_ENABLE == 1)
+
 /**
  * @brief      basic example read
  * @param[out] *temperature pointer to a converted temperature buffer
@@ -88,7 +95,7 @@ uint8_t bmp180_basic_init(void)
  * @return     status code
  *             - 0 success
  *             - 1 read failed
- * @note       none
+ * @note       only built when BMP180_FLOAT_ENABLE is 1
  */
 uint8_t bmp180_basic_read(float *temperature, uint32_t *pressure)
 {
@@ -107,6 +114,55 @@ uint8_t bmp180_basic_read(float *temperature, uint32_t *pressure)
     }
 }
 
+#endif
+
+/**
+ * @brief      basic example read in fixed point
+ * @param[out] *temperature pointer to a temperature buffer in 0.1 degrees celsius
+ * @param[out] *pressure pointer to a converted pressure buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       it works without the float support
+ */
+uint8_t bmp180_basic_read_fixed(int32_t *temperature, uint32_t *pressure)
+{
+    uint16_t temperature_yaw;
+    uint32_t pressure_yaw;
+    
+    /* read temperature and pressure */
+    if (bmp180_read_temperature_pressure_fixed(&gs_handle, (uint16_t *)&temperature_yaw, 
+                                               temperature, (uint32_t *)&pressure_yaw, pressure) != 0)
+    {
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/**
+ * @brief     basic example set the conversion wait mode
+ * @param[in] mode wait mode
+ * @return    status code
+ *            - 0 success
+ *            - 1 set failed
+ * @note      none
+ */
+uint8_t bmp180_basic_set_wait_mode(bmp180_wait_mode_t mode)
+{
+    /* set wait mode */
+    if (bmp180_set_wait_mode(&gs_handle, mode) != 0)
+    {
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
 /**
  * @brief  basic example deinit
  * @return status code
@@ -23,13 +23,14 @@
  *
  * @file      driver_bmp180_basic.h
  * @brief     driver bmp180 basic header file
- * @version   2.0.0
+ * @version   2.1.0
  * @author    Shifeng Li
  * @date      2021-02-21
  *
  * <h3>history</h3>
  * <table>
  * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>2.1      <td>Shifeng Li  <td>add the split-phase api and performance modules
  * <tr><td>2021/02/21  <td>2.0      <td>Shifeng Li  <td>format the code
  * <tr><td>2020/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
  * </table>
@@ -74,6 +75,8 @@ uint8_t bmp180_basic_init(void);
  */
 uint8_t bmp180_basic_deinit(void);
 
+#if (BMP180_FLOAT_ENABLE == 1)
+
 /**
  * @brief      basic example read
  * @param[out] *temperature pointer to a converted temperature buffer
@@ -81,10 +84,33 @@ uint8_t bmp180_basic_deinit(void);
  * @return     status code
  *             - 0 success
  *             - 1 read failed
- * @note       none
+ * @note       only built when BMP180_FLOAT_ENABLE is 1
  */
 uint8_t bmp180_basic_read(float *temperature, uint32_t *pressure);
 
+#endif
+
+/**
+ * @brief      basic example read in fixed point
+ * @param[out] *temperature pointer to a temperature buffer in 0.1 degrees celsius
+ * @param[out] *pressure pointer to a converted pressure buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       it works without the float support
+ */
+uint8_t bmp180_basic_read_fixed(int32_t *temperature, uint32_t *pressure);
+
+/**
+ * @brief     basic example set the conversion wait mode
+ * @param[in] mode wait mode
+ * @return    status code
+ *            - 0 success
+ *            - 1 set failed
+ * @note      none
+ */
+uint8_t bmp180_basic_set_wait_mode(bmp180_wait_mode_t mode);
+
 /**
  * @}
  */
@@ -23,13 +23,14 @@
  *
  * @file      driver_bmp180_interface.h
  * @brief     driver bmp180 interface header file
- * @version   2.0.0
+ * @version   2.1.0
  * @author    Shifeng Li
  * @date      2021-02-21
  *
  * <h3>history</h3>
  * <table>
  * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>2.1      <td>Shifeng Li  <td>add the split-phase api and performance modules
  * <tr><td>2021/02/21  <td>2.0      <td>Shifeng Li  <td>format the code
  * <tr><td>2020/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
  * </table>
@@ -95,6 +96,54 @@ uint8_t bmp180_interface_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint1
  */
 uint8_t bmp180_interface_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
 
+/**
+ * @brief     interface iic bus init with a user context
+ * @param[in] *user pointer to the user context
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic init failed
+ * @note      the user context is the one linked with DRIVER_BMP180_LINK_USER
+ */
+uint8_t bmp180_interface_iic_init_ctx(void *user);
+
+/**
+ * @brief     interface iic bus deinit with a user context
+ * @param[in] *user pointer to the user context
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic deinit failed
+ * @note      the user context is the one linked with DRIVER_BMP180_LINK_USER
+ */
+uint8_t bmp180_interface_iic_deinit_ctx(void *user);
+
+/**
+ * @brief      interface iic bus read with a user context
+ * @param[in]  *user pointer to the user context
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the user context is the one linked with DRIVER_BMP180_LINK_USER
+ */
+uint8_t bmp180_interface_iic_read_ctx(void *user, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief     interface iic bus write with a user context
+ * @param[in] *user pointer to the user context
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      the user context is the one linked with DRIVER_BMP180_LINK_USER
+ */
+uint8_t bmp180_interface_iic_write_ctx(void *user, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
+
 /**
  * @brief     interface delay ms
  * @param[in] ms time
@@ -102,6 +151,50 @@ uint8_t bmp180_interface_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint
  */
 void bmp180_interface_delay_ms(uint32_t ms);
 
+/**
+ * @brief     interface delay us
+ * @param[in] us time
+ * @note      none
+ */
+void bmp180_interface_delay_us(uint32_t us);
+
+/**
+ * @brief  interface timestamp ms
+ * @return monotonic time in ms
+ * @note   none
+ */
+uint32_t bmp180_interface_timestamp_ms(void);
+
+/**
+ * @brief  interface timestamp ns
+ * @return monotonic time in ns
+ * @note   none
+ */
+uint64_t bmp180_interface_timestamp_ns(void);
+
+/**
+ * @brief     interface wait eoc
+ * @param[in] us timeout in us
+ * @return    status code
+ *            - 0 success
+ *            - 1 timeout or failed
+ * @note      wait for the rising edge of the EOC pin,
+ *            a zero timeout only checks for an edge that is already seen
+ */
+uint8_t bmp180_interface_wait_eoc(uint32_t us);
+
+/**
+ * @brief     interface wait eoc with a user context
+ * @param[in] *user pointer to the user context
+ * @param[in] us timeout in us
+ * @return    status code
+ *            - 0 success
+ *            - 1 timeout or failed
+ * @note      the user context is the one linked with DRIVER_BMP180_LINK_USER,
+ *            it waits for the EOC pin of that sensor
+ */
+uint8_t bmp180_interface_wait_eoc_ctx(void *user, uint32_t us);
+
 /**
  * @brief     interface print format data
  * @param[in] fmt format data
@@ -23,13 +23,14 @@
  *
  * @file      driver_bmp180_interface_template.c
  * @brief     driver bmp180 interface template source file
- * @version   2.0.0
+ * @version   2.1.0
  * @author    Shifeng Li
  * @date      2021-02-21
  *
  * <h3>history</h3>
  * <table>
  * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>2.1      <td>Shifeng Li  <td>add the split-phase api and performance modules
  * <tr><td>2021/02/21  <td>2.0      <td>Shifeng Li  <td>format the code
  * <tr><td>2020/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
  * </table>
@@ -93,6 +94,66 @@ uint8_t bmp180_interface_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint
     return 0;
 }
 
+/**
+ * @brief     interface iic bus init with a user context
+ * @param[in] *user pointer to the user context
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic init failed
+ * @note      none
+ */
+uint8_t bmp180_interface_iic_init_ctx(void *user)
+{
+    return 0;
+}
+
+/**
+ * @brief     interface iic bus deinit with a user context
+ * @param[in] *user pointer to the user context
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic deinit failed
+ * @note      none
+ */
+uint8_t bmp180_interface_iic_deinit_ctx(void *user)
+{
+    return 0;
+}
+
+/**
+ * @brief      interface iic bus read with a user context
+ * @param[in]  *user pointer to the user context
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t bmp180_interface_iic_read_ctx(void *user, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    return 0;
+}
+
+/**
+ * @brief     interface iic bus write with a user context
+ * @param[in] *user pointer to the user context
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t bmp180_interface_iic_write_ctx(void *user, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    return 0;
+}
+
 /**
  * @brief     interface delay ms
  * @param[in] ms time
@@ -103,6 +164,64 @@ void bmp180_interface_delay_ms(uint32_t ms)
 
 }
 
+/**
+ * @brief     interface delay us
+ * @param[in] us time
+ * @note      none
+ */
+void bmp180_interface_delay_us(uint32_t us)
+{
+
+}
+
+/**
+ * @brief  interface timestamp ms
+ * @return monotonic time in ms
+ * @note   none
+ */
+uint32_t bmp180_interface_timestamp_ms(void)
+{
+    return 0;
+}
+
+/**
+ * @brief  interface timestamp ns
+ * @return monotonic time in ns
+ * @note   none
+ */
+uint64_t bmp180_interface_timestamp_ns(void)
+{
+    return 0;
+}
+
+/**
+ * @brief     interface wait eoc
+ * @param[in] us timeout in us
+ * @return    status code
+ *            - 0 success
+ *            - 1 timeout or failed
+ * @note      wait for the rising edge of the EOC pin,
+ *            a zero timeout only checks for an edge that is already seen
+ */
+uint8_t bmp180_interface_wait_eoc(uint32_t us)
+{
+    return 0;
+}
+
+/**
+ * @brief     interface wait eoc with a user context
+ * @param[in] *user pointer to the user context
+ * @param[in] us timeout in us
+ * @return    status code
+ *            - 0 success
+ *            - 1 timeout or failed
+ * @note      none
+ */
+uint8_t bmp180_interface_wait_eoc_ctx(void *user, uint32_t us)
+{
+    return 0;
+}
+
 /**
  * @brief     interface print format data
  * @param[in] fmt format data
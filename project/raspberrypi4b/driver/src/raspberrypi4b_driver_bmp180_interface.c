@@ -37,7 +37,11 @@
 
 #include "driver_bmp180_interface.h"
 #include "iic.h"
+#include "iic_bus.h"
+#include "gpio.h"
+#include "sensor_ctx.h"
 #include <stdarg.h>
+#include <time.h>
 
 /**
  * @brief iic device name definition
@@ -105,6 +109,66 @@ uint8_t bmp180_interface_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint
     return iic_write(gs_fd, addr, reg, buf, len);
 }
 
+/**
+ * @brief     interface iic bus init with a user context
+ * @param[in] *user pointer to a sensor_ctx_t structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic init failed
+ * @note      the bus must be set up by iic_bus_init, every bus keeps its own fd
+ */
+uint8_t bmp180_interface_iic_init_ctx(void *user)
+{
+    return iic_bus_open(((sensor_ctx_t *)user)->bus);
+}
+
+/**
+ * @brief     interface iic bus deinit with a user context
+ * @param[in] *user pointer to a sensor_ctx_t structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic deinit failed
+ * @note      none
+ */
+uint8_t bmp180_interface_iic_deinit_ctx(void *user)
+{
+    return iic_bus_close(((sensor_ctx_t *)user)->bus);
+}
+
+/**
+ * @brief      interface iic bus read with a user context
+ * @param[in]  *user pointer to a sensor_ctx_t structure
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t bmp180_interface_iic_read_ctx(void *user, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    return iic_bus_read(((sensor_ctx_t *)user)->bus, addr, reg, buf, len);
+}
+
+/**
+ * @brief     interface iic bus write with a user context
+ * @param[in] *user pointer to a sensor_ctx_t structure
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t bmp180_interface_iic_write_ctx(void *user, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    return iic_bus_write(((sensor_ctx_t *)user)->bus, addr, reg, buf, len);
+}
+
 /**
  * @brief     interface delay ms
  * @param[in] ms time
@@ -115,6 +179,73 @@ void bmp180_interface_delay_ms(uint32_t ms)
     usleep(1000 * ms);
 }
 
+/**
+ * @brief     interface delay us
+ * @param[in] us time
+ * @note      none
+ */
+void bmp180_interface_delay_us(uint32_t us)
+{
+    usleep(us);
+}
+
+/**
+ * @brief  interface timestamp ms
+ * @return monotonic time in ms
+ * @note   none
+ */
+uint32_t bmp180_interface_timestamp_ms(void)
+{
+    struct timespec ts;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000 + (uint64_t)ts.tv_nsec / 1000000);
+}
+
+/**
+ * @brief  interface timestamp ns
+ * @return monotonic time in ns
+ * @note   none
+ */
+uint64_t bmp180_interface_timestamp_ns(void)
+{
+    struct timespec ts;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief     interface wait eoc
+ * @param[in] us timeout in us
+ * @return    status code
+ *            - 0 success
+ *            - 1 timeout or failed
+ * @note      wait for the rising edge of the EOC pin,
+ *            a zero timeout only checks for an edge that is already seen
+ */
+uint8_t bmp180_interface_wait_eoc(uint32_t us)
+{
+    return (gpio_eoc_wait(us) == 0) ? 0 : 1;
+}
+
+/**
+ * @brief     interface wait eoc with a user context
+ * @param[in] *user pointer to a sensor_ctx_t structure
+ * @param[in] us timeout in us
+ * @return    status code
+ *            - 0 success
+ *            - 1 timeout or failed
+ * @note      wait for the rising edge of the EOC line of the sensor,
+ *            a zero timeout only checks for an edge that is already seen
+ */
+uint8_t bmp180_interface_wait_eoc_ctx(void *user, uint32_t us)
+{
+    return (gpio_eoc_line_wait(((sensor_ctx_t *)user)->eoc, us) == 0) ? 0 : 1;
+}
+
 /**
  * @brief     interface print format data
  * @param[in] fmt format data
@@ -0,0 +1,185 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      gpio.h
+ * @brief     gpio header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+
+#ifndef GPIO_H
+#define GPIO_H
+
+#include <unistd.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct gpiod_chip;
+struct gpiod_line;
+
+/**
+ * @defgroup gpio gpio function
+ * @brief    gpio function modules
+ * @{
+ */
+
+/**
+ * @brief gpio eoc device definition
+ */
+#define GPIO_DEVICE_NAME "/dev/gpiochip0"        /**< gpio device name */
+#define GPIO_DEVICE_LINE 17                      /**< gpio device line */
+
+/**
+ * @brief gpio eoc line structure definition
+ */
+typedef struct gpio_eoc_line_s
+{
+    struct gpiod_chip *chip;         /**< gpio chip handle */
+    struct gpiod_line *line;         /**< gpio line handle */
+    int fd;                          /**< event fd */
+    uint64_t timestamp_ns;           /**< last rising edge timestamp */
+} gpio_eoc_line_t;
+
+/**
+ * @brief     gpio eoc init
+ * @param[in] *name pointer to a gpio chip name buffer
+ * @param[in] pin gpio line offset
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      the line is requested for rising edge events,
+ *            it inits one default line for the functions without a gpio eoc line structure
+ */
+uint8_t gpio_eoc_init(char *name, uint32_t pin);
+
+/**
+ * @brief  gpio eoc deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t gpio_eoc_deinit(void);
+
+/**
+ * @brief     gpio eoc wait for the rising edge
+ * @param[in] us timeout in us
+ * @return    status code
+ *            - 0 success
+ *            - 1 wait failed
+ *            - 2 timeout
+ * @note      stale edges of the previous conversions are skipped,
+ *            a zero timeout only checks the queued edges without sleeping
+ */
+uint8_t gpio_eoc_wait(uint32_t us);
+
+/**
+ * @brief      gpio eoc get the timestamp of the last rising edge
+ * @param[out] *ns pointer to a timestamp buffer in ns
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       the timestamp is taken by the kernel on CLOCK_MONOTONIC
+ */
+uint8_t gpio_eoc_get_timestamp(uint64_t *ns);
+
+/**
+ * @brief      gpio eoc line init
+ * @param[out] *eoc pointer to a gpio eoc line structure
+ * @param[in]  *name pointer to a gpio chip name buffer
+ * @param[in]  pin gpio line offset
+ * @return     status code
+ *             - 0 success
+ *             - 1 init failed
+ * @note       unlike gpio_eoc_init every sensor keeps its own line, the event fd can be polled by an event loop
+ */
+uint8_t gpio_eoc_line_init(gpio_eoc_line_t *eoc, char *name, uint32_t pin);
+
+/**
+ * @brief     gpio eoc line deinit
+ * @param[in] *eoc pointer to a gpio eoc line structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      none
+ */
+uint8_t gpio_eoc_line_deinit(gpio_eoc_line_t *eoc);
+
+/**
+ * @brief      gpio eoc line read the queued events
+ * @param[in]  *eoc pointer to a gpio eoc line structure
+ * @param[out] *high pointer to a line level buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       it never blocks, the timestamp of the last edge is kept when the line is high
+ */
+uint8_t gpio_eoc_line_read(gpio_eoc_line_t *eoc, uint8_t *high);
+
+/**
+ * @brief     gpio eoc line wait for the rising edge
+ * @param[in] *eoc pointer to a gpio eoc line structure
+ * @param[in] us timeout in us
+ * @return    status code
+ *            - 0 success
+ *            - 1 wait failed
+ *            - 2 timeout
+ * @note      stale edges of the previous conversions are skipped,
+ *            a zero timeout only checks the queued edges without sleeping
+ */
+uint8_t gpio_eoc_line_wait(gpio_eoc_line_t *eoc, uint32_t us);
+
+/**
+ * @brief      gpio eoc line get the timestamp of the last rising edge
+ * @param[in]  *eoc pointer to a gpio eoc line structure
+ * @param[out] *ns pointer to a timestamp buffer in ns
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       the timestamp is taken by the kernel on CLOCK_MONOTONIC
+ */
+uint8_t gpio_eoc_line_get_timestamp(gpio_eoc_line_t *eoc, uint64_t *ns);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
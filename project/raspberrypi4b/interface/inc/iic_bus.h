@@ -0,0 +1,175 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      iic_bus.h
+ * @brief     iic bus header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+
+#ifndef IIC_BUS_H
+#define IIC_BUS_H
+
+#include <pthread.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup iic_bus iic bus function
+ * @brief    iic bus function modules
+ * @{
+ */
+
+/**
+ * @brief iic bus backend enumeration definition
+ */
+typedef enum
+{
+    IIC_BUS_BACKEND_RDWR  = 0x00,        /**< I2C_RDWR message transfers */
+    IIC_BUS_BACKEND_SMBUS = 0x01,        /**< I2C_SMBUS byte data and i2c block data transfers */
+} iic_bus_backend_t;
+
+/**
+ * @brief iic bus structure definition
+ */
+typedef struct iic_bus_s
+{
+    char name[32];                 /**< iic device name */
+    int fd;                        /**< iic device handle */
+    uint32_t users;                /**< open reference counter */
+    pthread_mutex_t mutex;         /**< open, close and slave address mutex */
+    uint8_t backend;               /**< transfer backend */
+    int32_t slave;                 /**< slave address of the fd, -1 means not set */
+} iic_bus_t;
+
+/**
+ * @brief     iic bus init
+ * @param[in] *bus pointer to an iic bus structure
+ * @param[in] index bus index of /dev/i2c-N
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      it doesn't open the device, the first iic_bus_open does,
+ *            the default backend is IIC_BUS_BACKEND_RDWR
+ */
+uint8_t iic_bus_init(iic_bus_t *bus, uint32_t index);
+
+/**
+ * @brief     iic bus set the transfer backend
+ * @param[in] *bus pointer to an iic bus structure
+ * @param[in] backend transfer backend
+ * @return    status code
+ *            - 0 success
+ *            - 1 set failed
+ *            - 2 bus is open
+ * @note      the smbus backend sets I2C_SLAVE once per fd and needs no message arrays,
+ *            it works on smbus-only adapters such as i2c-stub, all users of one fd must share one slave address
+ */
+uint8_t iic_bus_set_backend(iic_bus_t *bus, iic_bus_backend_t backend);
+
+/**
+ * @brief     iic bus deinit
+ * @param[in] *bus pointer to an iic bus structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ *            - 2 bus is still open
+ * @note      none
+ */
+uint8_t iic_bus_deinit(iic_bus_t *bus);
+
+/**
+ * @brief     iic bus open
+ * @param[in] *bus pointer to an iic bus structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ * @note      the device is opened by the first user and shared by the others
+ */
+uint8_t iic_bus_open(iic_bus_t *bus);
+
+/**
+ * @brief     iic bus close
+ * @param[in] *bus pointer to an iic bus structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      the device is closed by the last user
+ */
+uint8_t iic_bus_close(iic_bus_t *bus);
+
+/**
+ * @brief      iic bus read
+ * @param[in]  *bus pointer to an iic bus structure
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       addr = device_address_7bits << 1,
+ *             every access is one ioctl, so threads can share the bus without a lock,
+ *             the smbus backend splits reads longer than 32 bytes
+ */
+uint8_t iic_bus_read(iic_bus_t *bus, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief     iic bus write
+ * @param[in] *bus pointer to an iic bus structure
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      addr = device_address_7bits << 1,
+ *            the smbus backend splits writes longer than 32 bytes
+ */
+uint8_t iic_bus_write(iic_bus_t *bus, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,181 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      periodic.h
+ * @brief     periodic timer header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+
+#ifndef PERIODIC_H
+#define PERIODIC_H
+
+#include <unistd.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup periodic periodic function
+ * @brief    periodic timer function modules
+ * @{
+ */
+
+/**
+ * @brief periodic statistics structure definition
+ */
+typedef struct periodic_stats_s
+{
+    uint64_t ticks;                  /**< handled ticks */
+    uint64_t overruns;               /**< missed ticks */
+    double lateness_min_us;          /**< min wake time after the deadline */
+    double lateness_mean_us;         /**< mean wake time after the deadline */
+    double lateness_max_us;          /**< max wake time after the deadline */
+    double lateness_stddev_us;       /**< standard deviation of the wake time after the deadline */
+    double jitter_min_us;            /**< min interval minus the period */
+    double jitter_max_us;            /**< max interval minus the period */
+    double jitter_stddev_us;         /**< standard deviation of the interval */
+} periodic_stats_t;
+
+/**
+ * @brief periodic structure definition
+ */
+typedef struct periodic_s
+{
+    int fd;                          /**< timerfd handle */
+    uint64_t period_ns;              /**< period in ns */
+    uint64_t start_ns;               /**< first deadline on CLOCK_MONOTONIC */
+    uint64_t expirations;            /**< timer expirations since the start */
+    uint64_t last_ns;                /**< wake time of the last tick */
+    uint64_t lateness_ns;            /**< wake time after the deadline of the last tick */
+    uint64_t ticks;                  /**< handled ticks */
+    uint64_t overruns;               /**< missed ticks */
+    double lateness_min;             /**< min lateness in ns */
+    double lateness_max;             /**< max lateness in ns */
+    double lateness_mean;            /**< running lateness mean in ns */
+    double lateness_m2;              /**< running lateness sum of squared deviations */
+    uint64_t intervals;              /**< measured intervals */
+    double jitter_min;               /**< min jitter in ns */
+    double jitter_max;               /**< max jitter in ns */
+    double jitter_mean;              /**< running jitter mean in ns */
+    double jitter_m2;                /**< running jitter sum of squared deviations */
+} periodic_t;
+
+/**
+ * @brief     periodic timer init
+ * @param[in] *periodic pointer to a periodic structure
+ * @param[in] period_ns period in ns
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      the timer runs on absolute CLOCK_MONOTONIC deadlines, the first one is one period from now,
+ *            so the read time never adds up and the ticks don't drift
+ */
+uint8_t periodic_init(periodic_t *periodic, uint64_t period_ns);
+
+/**
+ * @brief     periodic timer deinit
+ * @param[in] *periodic pointer to a periodic structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      none
+ */
+uint8_t periodic_deinit(periodic_t *periodic);
+
+/**
+ * @brief      wait for the next tick
+ * @param[in]  *periodic pointer to a periodic structure
+ * @param[out] *missed pointer to a missed tick buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 wait failed
+ * @note       missed counts the deadlines that passed while the caller was busy,
+ *             they are skipped instead of being run back to back
+ */
+uint8_t periodic_wait(periodic_t *periodic, uint64_t *missed);
+
+/**
+ * @brief      handle the expirations of a readable timer fd
+ * @param[in]  *periodic pointer to a periodic structure
+ * @param[out] *missed pointer to a missed tick buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 no expiration
+ * @note       it never blocks, use it when the fd is polled by an event loop
+ */
+uint8_t periodic_handle(periodic_t *periodic, uint64_t *missed);
+
+/**
+ * @brief     get the timer fd
+ * @param[in] *periodic pointer to a periodic structure
+ * @return    timer fd
+ * @note      the fd becomes readable at every deadline
+ */
+int periodic_get_fd(periodic_t *periodic);
+
+/**
+ * @brief      get the lateness of the last tick
+ * @param[in]  *periodic pointer to a periodic structure
+ * @param[out] *ns pointer to a lateness buffer in ns
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       feed it to a histogram after every periodic_wait
+ */
+uint8_t periodic_get_lateness(periodic_t *periodic, uint64_t *ns);
+
+/**
+ * @brief      get the statistics
+ * @param[in]  *periodic pointer to a periodic structure
+ * @param[out] *stats pointer to a periodic statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       lateness is the wake time after the deadline, jitter is the interval between two ticks minus the period
+ */
+uint8_t periodic_get_stats(periodic_t *periodic, periodic_stats_t *stats);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
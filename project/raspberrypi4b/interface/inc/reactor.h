@@ -0,0 +1,189 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      reactor.h
+ * @brief     reactor header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+
+#ifndef REACTOR_H
+#define REACTOR_H
+
+#include "driver_bmp180_scheduler.h"
+#include "gpio.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup reactor reactor function
+ * @brief    reactor event loop function modules
+ * @{
+ */
+
+/**
+ * @brief reactor max events definition
+ */
+#define REACTOR_MAX_EVENTS 32        /**< events handled per wait */
+
+/**
+ * @brief reactor callback definition
+ */
+typedef void (*reactor_callback_t)(void *arg, const bmp180_sample_t *sample);
+
+/**
+ * @brief reactor sensor structure definition
+ */
+typedef struct reactor_sensor_s
+{
+    gpio_eoc_line_t *eoc;            /**< eoc line or NULL */
+    uint32_t eoc_wakes;              /**< running conversions woken by the eoc edge */
+    uint8_t edge;                    /**< eoc edge seen in the current wake */
+} reactor_sensor_t;
+
+/**
+ * @brief reactor structure definition
+ */
+typedef struct reactor_s
+{
+    int epoll_fd;                    /**< epoll handle */
+    int timer_fd;                    /**< earliest deadline timerfd */
+    bmp180_scheduler_t scheduler;    /**< conversion scheduler */
+    reactor_sensor_t *sensor;        /**< sensor array */
+    uint8_t capacity;                /**< sensor array capacity */
+    uint8_t count;                   /**< added sensors */
+    volatile uint8_t running;        /**< running flag */
+    uint64_t samples;                /**< delivered samples */
+    uint64_t wakes;                  /**< epoll wakes */
+    reactor_callback_t callback;     /**< sample callback */
+    void *arg;                       /**< callback argument */
+} reactor_t;
+
+/**
+ * @brief     reactor init
+ * @param[in] *reactor pointer to a reactor structure
+ * @param[in] *sensor pointer to a sensor array
+ * @param[in] *slot pointer to a scheduler sensor array
+ * @param[in] capacity capacity of both arrays
+ * @param[in] callback sample callback
+ * @param[in] *arg callback argument
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      the conversions run on bmp180_scheduler, the reactor only waits for its deadline and the eoc edges
+ */
+uint8_t reactor_init(reactor_t *reactor, reactor_sensor_t *sensor, bmp180_scheduler_sensor_t *slot, uint8_t capacity,
+                     reactor_callback_t callback, void *arg);
+
+/**
+ * @brief     reactor deinit
+ * @param[in] *reactor pointer to a reactor structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      the handles and the eoc lines belong to the caller and are not closed
+ */
+uint8_t reactor_deinit(reactor_t *reactor);
+
+/**
+ * @brief      add a sensor to the reactor
+ * @param[in]  *reactor pointer to a reactor structure
+ * @param[in]  *handle pointer to an initialized bmp180 handle
+ * @param[in]  *eoc pointer to an initialized eoc line or NULL
+ * @param[in]  period_ns sample period in ns, 0 means back to back
+ * @param[out] *index pointer to a sensor index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 add failed
+ *             - 2 reactor is full
+ * @note       the first conversion starts at the next reactor_run_once,
+ *             with an eoc line the conversion is harvested on the rising edge and the timer is only a fallback
+ */
+uint8_t reactor_add(reactor_t *reactor, bmp180_handle_t *handle, gpio_eoc_line_t *eoc, uint64_t period_ns,
+                    uint8_t *index);
+
+/**
+ * @brief     wait once and dispatch the ready sensors
+ * @param[in] *reactor pointer to a reactor structure
+ * @param[in] timeout_ms wait timeout in ms, -1 means forever
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      every finished sample is passed to the callback before it returns
+ */
+uint8_t reactor_run_once(reactor_t *reactor, int32_t timeout_ms);
+
+/**
+ * @brief     run the reactor until reactor_stop is called
+ * @param[in] *reactor pointer to a reactor structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      none
+ */
+uint8_t reactor_run(reactor_t *reactor);
+
+/**
+ * @brief     stop the running reactor
+ * @param[in] *reactor pointer to a reactor structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 stop failed
+ * @note      it can be called from the callback
+ */
+uint8_t reactor_stop(reactor_t *reactor);
+
+/**
+ * @brief      get the sensor statistics
+ * @param[in]  *reactor pointer to a reactor structure
+ * @param[in]  index sensor index
+ * @param[out] *samples pointer to a sample counter buffer
+ * @param[out] *overruns pointer to an overrun counter buffer
+ * @param[out] *errors pointer to an error counter buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+uint8_t reactor_get_sensor_stats(reactor_t *reactor, uint8_t index, uint64_t *samples, uint64_t *overruns,
+                                 uint32_t *errors);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,160 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      rt.h
+ * @brief     real-time header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+
+#ifndef RT_H
+#define RT_H
+
+#include <unistd.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup rt rt function
+ * @brief    real-time function modules
+ * @{
+ */
+
+/**
+ * @brief rt histogram definition
+ */
+#define RT_HISTOGRAM_BUCKETS 1000        /**< 1us buckets, the last one also holds the overflow */
+
+/**
+ * @brief rt config structure definition
+ */
+typedef struct rt_config_s
+{
+    int32_t priority;                /**< SCHED_FIFO priority 1 - 99 */
+    int32_t cpu;                     /**< cpu of the thread, -1 keeps the affinity */
+    uint8_t lock_memory;             /**< lock the current and the future pages */
+    uint8_t prefault_stack;          /**< touch the stack before the first deadline */
+} rt_config_t;
+
+/**
+ * @brief rt histogram structure definition
+ */
+typedef struct rt_histogram_s
+{
+    uint64_t bucket[RT_HISTOGRAM_BUCKETS];        /**< counts of 1us buckets */
+    uint64_t count;                               /**< added values */
+    uint64_t min_ns;                              /**< min value in ns */
+    uint64_t max_ns;                              /**< max value in ns */
+    uint64_t sum_ns;                              /**< value sum in ns */
+} rt_histogram_t;
+
+/**
+ * @brief     make the calling thread real-time
+ * @param[in] *config pointer to a rt config structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 enter failed
+ * @note      SCHED_FIFO and mlockall need root or CAP_SYS_NICE and CAP_IPC_LOCK,
+ *            every step is tried and the failed ones are printed
+ */
+uint8_t rt_enter(const rt_config_t *config);
+
+/**
+ * @brief  make the calling thread a normal thread again
+ * @return status code
+ *         - 0 success
+ *         - 1 leave failed
+ * @note   the memory is unlocked as well
+ */
+uint8_t rt_leave(void);
+
+/**
+ * @brief     clear the histogram
+ * @param[in] *histogram pointer to a rt histogram structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 clear failed
+ * @note      none
+ */
+uint8_t rt_histogram_clear(rt_histogram_t *histogram);
+
+/**
+ * @brief     add a value to the histogram
+ * @param[in] *histogram pointer to a rt histogram structure
+ * @param[in] ns value in ns
+ * @return    status code
+ *            - 0 success
+ *            - 1 add failed
+ * @note      it never allocates, so it is safe on the real-time thread
+ */
+uint8_t rt_histogram_add(rt_histogram_t *histogram, uint64_t ns);
+
+/**
+ * @brief      get the percentile of the histogram
+ * @param[in]  *histogram pointer to a rt histogram structure
+ * @param[in]  percent percentile 0.0 - 100.0
+ * @param[out] *us pointer to a value buffer in us
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       the upper edge of the bucket is returned, the overflow bucket returns the max
+ */
+uint8_t rt_histogram_get_percentile(rt_histogram_t *histogram, double percent, uint32_t *us);
+
+/**
+ * @brief      get the count of a histogram range
+ * @param[in]  *histogram pointer to a rt histogram structure
+ * @param[in]  from_us first value of the range in us
+ * @param[in]  to_us value after the range in us
+ * @param[out] *count pointer to a count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       to_us >= RT_HISTOGRAM_BUCKETS includes the overflow
+ */
+uint8_t rt_histogram_get_range(rt_histogram_t *histogram, uint32_t from_us, uint32_t to_us, uint64_t *count);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
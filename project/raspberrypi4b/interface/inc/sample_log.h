@@ -0,0 +1,205 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      sample_log.h
+ * @brief     sample log header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef SAMPLE_LOG_H
+#define SAMPLE_LOG_H
+
+#include "driver_bmp180.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup sample_log sample_log function
+ * @brief    packed sample log function modules
+ * @{
+ */
+
+/**
+ * @brief sample log definition
+ */
+#define SAMPLE_LOG_MAGIC              "BMPL"        /**< file header magic */
+#define SAMPLE_LOG_BLOCK_MAGIC        "BMPB"        /**< block magic */
+#define SAMPLE_LOG_VERSION            1             /**< file version */
+#define SAMPLE_LOG_BLOCK_SIZE         4096          /**< block size, the file header is the first block */
+#define SAMPLE_LOG_BLOCK_HEADER_SIZE  44            /**< block header size */
+#define SAMPLE_LOG_RECORD_MAX         24            /**< max encoded record size */
+#define SAMPLE_LOG_BLOCK_RECORDS      1352          /**< max records of a block, one base and 3 byte deltas */
+
+/**
+ * @brief sample log writer structure definition
+ */
+typedef struct sample_log_writer_s
+{
+    int fd;                                              /**< file fd */
+    uint8_t sync;                                        /**< fdatasync every sealed block */
+    uint16_t records;                                    /**< records of the open block */
+    uint16_t len;                                        /**< payload bytes of the open block */
+    uint64_t index;                                      /**< file index of the next record */
+    uint64_t blocks;                                     /**< blocks in the file */
+    uint64_t first_us;                                   /**< timestamp of the first record of the open block */
+    uint64_t last_us;                                    /**< timestamp of the last record */
+    uint32_t last_up;                                    /**< raw pressure of the last record */
+    uint16_t last_ut;                                    /**< raw temperature of the last record */
+    uint64_t written;                                    /**< records written by this writer */
+    uint64_t sealed;                                     /**< blocks sealed by this writer */
+    uint8_t block[SAMPLE_LOG_BLOCK_SIZE];                /**< open block */
+} sample_log_writer_t;
+
+/**
+ * @brief sample log reader structure definition
+ */
+typedef struct sample_log_reader_s
+{
+    const uint8_t *map;                                  /**< mapped file */
+    size_t size;                                         /**< mapped size */
+    uint64_t blocks;                                     /**< complete blocks */
+    uint64_t first_us;                                   /**< timestamp of the first record */
+    uint64_t last_us;                                    /**< timestamp of the last record */
+    uint8_t calibration[BMP180_CALIBRATION_SIZE];        /**< calibration blob of the sensor */
+    bmp180_handle_t handle;                              /**< handle that only compensates */
+} sample_log_reader_t;
+
+/**
+ * @brief     open a sample log for appending
+ * @param[in] *writer pointer to a sample log writer structure
+ * @param[in] *path pointer to a file path
+ * @param[in] *calibration pointer to a calibration blob from bmp180_export_calibration
+ * @param[in] sync fdatasync flag of every sealed block
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ *            - 4 the file belongs to another sensor or is not a sample log
+ * @note      a new file gets the header block, an existing file is checked and a torn last block
+ *            of a crashed writer is cut off, the records are appended after the last complete block
+ */
+uint8_t sample_log_writer_open(sample_log_writer_t *writer, const char *path, const uint8_t *calibration, uint8_t sync);
+
+/**
+ * @brief     append a sample
+ * @param[in] *writer pointer to a sample log writer structure
+ * @param[in] *sample pointer to a sample
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ *            - 4 the timestamp goes backwards
+ * @note      only timestamp_us, ut, up and mode are stored, a full block is sealed and written at once
+ */
+uint8_t sample_log_writer_write(sample_log_writer_t *writer, const bmp180_sample_t *sample);
+
+/**
+ * @brief     seal and write the open block
+ * @param[in] *writer pointer to a sample log writer structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      the records are durable after it, a partial block takes a whole block on disk,
+ *            so call it at the interval the data may be lost in a crash, not after every sample
+ */
+uint8_t sample_log_writer_flush(sample_log_writer_t *writer);
+
+/**
+ * @brief     close a sample log writer
+ * @param[in] *writer pointer to a sample log writer structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      the open block is sealed first
+ */
+uint8_t sample_log_writer_close(sample_log_writer_t *writer);
+
+/**
+ * @brief     map a sample log for reading
+ * @param[in] *reader pointer to a sample log reader structure
+ * @param[in] *path pointer to a file path
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ *            - 4 the file is not a sample log
+ * @note      the file is mapped read only, a torn last block is not counted
+ */
+uint8_t sample_log_reader_open(sample_log_reader_t *reader, const char *path);
+
+/**
+ * @brief     unmap a sample log
+ * @param[in] *reader pointer to a sample log reader structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      none
+ */
+uint8_t sample_log_reader_close(sample_log_reader_t *reader);
+
+/**
+ * @brief      find the first block that may hold a timestamp
+ * @param[in]  *reader pointer to a sample log reader structure
+ * @param[in]  timestamp_us timestamp to seek
+ * @param[out] *block pointer to a block index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 every record is older
+ * @note       the block headers are the index, the binary search touches log2(blocks) pages
+ */
+uint8_t sample_log_reader_seek(sample_log_reader_t *reader, uint64_t timestamp_us, uint64_t *block);
+
+/**
+ * @brief      decode the records of a block
+ * @param[in]  *reader pointer to a sample log reader structure
+ * @param[in]  block block index
+ * @param[out] *sample pointer to a sample buffer
+ * @param[in]  len sample buffer length, SAMPLE_LOG_BLOCK_RECORDS fits every block
+ * @param[out] *count pointer to a decoded record count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 block index is invalid or the buffer is too small
+ *             - 4 the block is corrupted
+ * @note       the sequence is the record index in the file, the temperature and the pressure
+ *             are compensated again with the calibration of the file header
+ */
+uint8_t sample_log_reader_decode(sample_log_reader_t *reader, uint64_t block, bmp180_sample_t *sample,
+                                 uint32_t len, uint32_t *count);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
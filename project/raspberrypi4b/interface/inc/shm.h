@@ -0,0 +1,192 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      shm.h
+ * @brief     shared memory sample header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef SHM_H
+#define SHM_H
+
+#include "driver_bmp180.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup shm shm function
+ * @brief    shared memory sample function modules
+ * @{
+ */
+
+/**
+ * @brief shm definition
+ */
+#define SHM_DEFAULT_NAME     "/bmp180"                                           /**< default segment name */
+#define SHM_MAGIC            0x48504D42U                                         /**< "BMPH" little endian segment magic */
+#define SHM_VERSION          1                                                   /**< segment version */
+#define SHM_SAMPLE_WORDS     ((sizeof(bmp180_sample_t) + 3) / 4)                 /**< sample size in 32 bit words */
+#define SHM_READ_RETRIES     64                                                  /**< reader retries while a slot is written */
+
+/**
+ * @brief shm header structure definition
+ * @note  the header is the first cache line of the segment
+ */
+typedef struct shm_header_s
+{
+    uint32_t magic;                /**< segment magic, written last by the publisher */
+    uint32_t version;              /**< segment version */
+    uint32_t header_size;          /**< header size */
+    uint32_t slot_size;            /**< slot size */
+    uint32_t slots;                /**< slot count, one per sensor */
+    uint32_t pid;                  /**< publisher pid */
+    uint64_t publishes;            /**< published samples */
+    uint8_t reserved[32];          /**< reserved */
+} shm_header_t;
+
+/**
+ * @brief shm slot structure definition
+ * @note  one cache line per sensor, so the sensors don't share a line
+ */
+typedef struct shm_slot_s
+{
+    uint32_t sequence;                          /**< seqlock sequence, odd while the sample is written, 0 before the first sample */
+    uint32_t reserved;                          /**< reserved */
+    uint32_t word[SHM_SAMPLE_WORDS];            /**< latest sample */
+    uint8_t pad[56 - 4 * SHM_SAMPLE_WORDS];     /**< pad to 64 bytes */
+} shm_slot_t;
+
+/**
+ * @brief shm publisher structure definition
+ */
+typedef struct shm_publisher_s
+{
+    int fd;                        /**< segment fd */
+    size_t size;                   /**< segment size */
+    shm_header_t *header;          /**< mapped header */
+    shm_slot_t *slot;              /**< mapped slots */
+    char name[64];                 /**< segment name */
+} shm_publisher_t;
+
+/**
+ * @brief shm reader structure definition
+ */
+typedef struct shm_reader_s
+{
+    size_t size;                         /**< segment size */
+    const shm_header_t *header;          /**< mapped header */
+    const shm_slot_t *slot;              /**< mapped slots */
+    uint32_t retries;                    /**< retries of a slot that was being written */
+} shm_reader_t;
+
+/**
+ * @brief     shm publisher init
+ * @param[in] *publisher pointer to a shm publisher structure
+ * @param[in] *name pointer to a segment name, NULL means SHM_DEFAULT_NAME
+ * @param[in] slots slot count
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      an existing segment of the same name is unlinked and a new one is created with mode 0644,
+ *            readers that still map the old segment must reopen it
+ */
+uint8_t shm_publisher_init(shm_publisher_t *publisher, const char *name, uint32_t slots);
+
+/**
+ * @brief     shm publisher deinit
+ * @param[in] *publisher pointer to a shm publisher structure
+ * @param[in] unlink unlink flag
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      readers keep their mapping after the name is unlinked
+ */
+uint8_t shm_publisher_deinit(shm_publisher_t *publisher, uint8_t unlink);
+
+/**
+ * @brief     publish a sample
+ * @param[in] *publisher pointer to a shm publisher structure
+ * @param[in] *sample pointer to a sample
+ * @return    status code
+ *            - 0 success
+ *            - 1 sensor index is invalid
+ * @note      the sample replaces the last one of its sensor slot, there must be only one publisher thread,
+ *            it never blocks and makes no syscall
+ */
+uint8_t shm_publisher_write(shm_publisher_t *publisher, const bmp180_sample_t *sample);
+
+/**
+ * @brief     shm reader init
+ * @param[in] *reader pointer to a shm reader structure
+ * @param[in] *name pointer to a segment name, NULL means SHM_DEFAULT_NAME
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ *            - 4 segment is invalid
+ * @note      the segment is mapped read only and the fd is closed
+ */
+uint8_t shm_reader_init(shm_reader_t *reader, const char *name);
+
+/**
+ * @brief     shm reader deinit
+ * @param[in] *reader pointer to a shm reader structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      none
+ */
+uint8_t shm_reader_deinit(shm_reader_t *reader);
+
+/**
+ * @brief      read the latest sample of a sensor
+ * @param[in]  *reader pointer to a shm reader structure
+ * @param[in]  index sensor index
+ * @param[out] *sample pointer to a sample buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 sensor index is invalid
+ *             - 4 no sample has been published
+ *             - 5 the slot was written during every retry
+ * @note       it makes no syscall and takes no lock, a reader never delays the publisher
+ */
+uint8_t shm_reader_read(shm_reader_t *reader, uint32_t index, bmp180_sample_t *sample);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,141 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      stream.h
+ * @brief     sample stream header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+
+#ifndef STREAM_H
+#define STREAM_H
+
+#include "driver_bmp180.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup stream stream function
+ * @brief    sample stream function modules
+ * @{
+ */
+
+/**
+ * @brief stream definition
+ */
+#define STREAM_BUFFER_SIZE         65536              /**< output buffer size */
+#define STREAM_FLUSH_US            1000000ULL         /**< max age of a buffered record */
+#define STREAM_BINARY_MAGIC        "BMPS"             /**< binary file magic */
+#define STREAM_BINARY_VERSION      1                  /**< binary file version */
+#define STREAM_BINARY_HEADER_SIZE  8                  /**< binary file header size */
+#define STREAM_BINARY_RECORD_SIZE  28                 /**< binary record size */
+
+/**
+ * @brief stream format enumeration definition
+ */
+typedef enum
+{
+    STREAM_FORMAT_CSV    = 0x00,        /**< comma separated values with a header line */
+    STREAM_FORMAT_JSONL  = 0x01,        /**< one json object per line */
+    STREAM_FORMAT_BINARY = 0x02,        /**< packed little endian records */
+} stream_format_t;
+
+/**
+ * @brief stream structure definition
+ */
+typedef struct stream_s
+{
+    int fd;                                  /**< output fd */
+    uint8_t format;                          /**< output format */
+    uint8_t owned;                           /**< the fd is closed by stream_deinit */
+    uint32_t len;                            /**< buffered bytes */
+    uint64_t first_us;                       /**< timestamp of the oldest buffered record */
+    uint64_t records;                        /**< written records */
+    uint64_t bytes;                          /**< written bytes */
+    uint64_t writes;                         /**< write calls */
+    char buf[STREAM_BUFFER_SIZE];            /**< output buffer */
+} stream_t;
+
+/**
+ * @brief     stream init
+ * @param[in] *stream pointer to a stream structure
+ * @param[in] *path pointer to an output path, NULL or "-" means stdout
+ * @param[in] format output format
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      an existing file is truncated, the csv header line or the binary file header is written first
+ */
+uint8_t stream_init(stream_t *stream, const char *path, stream_format_t format);
+
+/**
+ * @brief     stream deinit
+ * @param[in] *stream pointer to a stream structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      the buffered records are flushed first
+ */
+uint8_t stream_deinit(stream_t *stream);
+
+/**
+ * @brief     append a sample to the stream
+ * @param[in] *stream pointer to a stream structure
+ * @param[in] *sample pointer to a sample
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      the record is formatted into the buffer, the buffer is written when it is full
+ *            or when the oldest record is STREAM_FLUSH_US old
+ */
+uint8_t stream_write(stream_t *stream, const bmp180_sample_t *sample);
+
+/**
+ * @brief     write the buffered records
+ * @param[in] *stream pointer to a stream structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 flush failed
+ * @note      none
+ */
+uint8_t stream_flush(stream_t *stream);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
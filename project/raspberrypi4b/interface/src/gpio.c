@@ -0,0 +1,348 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      gpio.c
+ * @brief     gpio source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+
+#include "gpio.h"
+#include <gpiod.h>
+#include <time.h>
+
+/**
+ * @brief gpio consumer name definition
+ */
+#define GPIO_CONSUMER_NAME "bmp180 eoc"        /**< gpio consumer name */
+
+/**
+ * @brief gpio event buffer size definition
+ */
+#define GPIO_EVENT_SIZE 16                     /**< gpio event buffer size */
+
+static gpio_eoc_line_t gs_eoc;                 /**< default eoc line */
+
+/**
+ * @brief  get the monotonic time
+ * @return monotonic time in ns
+ * @note   none
+ */
+static uint64_t a_gpio_now_ns(void)
+{
+    struct timespec ts;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief     gpio eoc init
+ * @param[in] *name pointer to a gpio chip name buffer
+ * @param[in] pin gpio line offset
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      the line is requested for rising edge events,
+ *            it inits one default line for the functions without a gpio eoc line structure
+ */
+uint8_t gpio_eoc_init(char *name, uint32_t pin)
+{
+    return gpio_eoc_line_init(&gs_eoc, name, pin);
+}
+
+/**
+ * @brief  gpio eoc deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t gpio_eoc_deinit(void)
+{
+    return gpio_eoc_line_deinit(&gs_eoc);
+}
+
+/**
+ * @brief     gpio eoc wait for the rising edge
+ * @param[in] us timeout in us
+ * @return    status code
+ *            - 0 success
+ *            - 1 wait failed
+ *            - 2 timeout
+ * @note      stale edges of the previous conversions are skipped,
+ *            a zero timeout only checks the queued edges without sleeping
+ */
+uint8_t gpio_eoc_wait(uint32_t us)
+{
+    return gpio_eoc_line_wait(&gs_eoc, us);
+}
+
+/**
+ * @brief      gpio eoc get the timestamp of the last rising edge
+ * @param[out] *ns pointer to a timestamp buffer in ns
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       the timestamp is taken by the kernel on CLOCK_MONOTONIC
+ */
+uint8_t gpio_eoc_get_timestamp(uint64_t *ns)
+{
+    return gpio_eoc_line_get_timestamp(&gs_eoc, ns);
+}
+
+/**
+ * @brief      gpio eoc line init
+ * @param[out] *eoc pointer to a gpio eoc line structure
+ * @param[in]  *name pointer to a gpio chip name buffer
+ * @param[in]  pin gpio line offset
+ * @return     status code
+ *             - 0 success
+ *             - 1 init failed
+ * @note       unlike gpio_eoc_init every sensor keeps its own line, the event fd can be polled by an event loop
+ */
+uint8_t gpio_eoc_line_init(gpio_eoc_line_t *eoc, char *name, uint32_t pin)
+{
+    /* check the param */
+    if (eoc == NULL)
+    {
+        return 1;
+    }
+    memset(eoc, 0, sizeof(gpio_eoc_line_t));
+    eoc->fd = -1;
+    
+    /* open the chip */
+    eoc->chip = gpiod_chip_open(name);
+    if (eoc->chip == NULL)
+    {
+        perror("gpio: open failed.\n");
+        
+        return 1;
+    }
+    
+    /* get the line */
+    eoc->line = gpiod_chip_get_line(eoc->chip, pin);
+    if (eoc->line == NULL)
+    {
+        perror("gpio: get line failed.\n");
+        gpiod_chip_close(eoc->chip);
+        eoc->chip = NULL;
+        
+        return 1;
+    }
+    
+    /* request the rising edge events */
+    if (gpiod_line_request_rising_edge_events(eoc->line, GPIO_CONSUMER_NAME) < 0)
+    {
+        perror("gpio: request rising edge events failed.\n");
+        gpiod_chip_close(eoc->chip);
+        eoc->chip = NULL;
+        eoc->line = NULL;
+        
+        return 1;
+    }
+    
+    /* get the event fd */
+    eoc->fd = gpiod_line_event_get_fd(eoc->line);
+    if (eoc->fd < 0)
+    {
+        perror("gpio: get event fd failed.\n");
+        gpiod_line_release(eoc->line);
+        gpiod_chip_close(eoc->chip);
+        eoc->chip = NULL;
+        eoc->line = NULL;
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     gpio eoc line deinit
+ * @param[in] *eoc pointer to a gpio eoc line structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      none
+ */
+uint8_t gpio_eoc_line_deinit(gpio_eoc_line_t *eoc)
+{
+    /* check the chip */
+    if ((eoc == NULL) || (eoc->chip == NULL))
+    {
+        return 1;
+    }
+    
+    /* release the line and close the chip */
+    gpiod_line_release(eoc->line);
+    gpiod_chip_close(eoc->chip);
+    eoc->chip = NULL;
+    eoc->line = NULL;
+    eoc->fd = -1;
+    
+    return 0;
+}
+
+/**
+ * @brief      gpio eoc line read the queued events
+ * @param[in]  *eoc pointer to a gpio eoc line structure
+ * @param[out] *high pointer to a line level buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       it never blocks, the timestamp of the last edge is kept when the line is high
+ */
+uint8_t gpio_eoc_line_read(gpio_eoc_line_t *eoc, uint8_t *high)
+{
+    struct gpiod_line_event events[GPIO_EVENT_SIZE];
+    struct timespec timeout = {0, 0};
+    int res;
+    
+    /* check the line */
+    if ((eoc == NULL) || (eoc->line == NULL) || (high == NULL))
+    {
+        return 1;
+    }
+    *high = 0;
+    
+    /* drain the queue */
+    while (gpiod_line_event_wait(eoc->line, &timeout) > 0)
+    {
+        res = gpiod_line_event_read_multiple(eoc->line, events, GPIO_EVENT_SIZE);
+        if (res <= 0)
+        {
+            perror("gpio: read event failed.\n");
+            
+            return 1;
+        }
+        eoc->timestamp_ns = (uint64_t)events[res - 1].ts.tv_sec * 1000000000ULL +
+                            (uint64_t)events[res - 1].ts.tv_nsec;
+    }
+    
+    /* eoc is low while converting */
+    *high = (gpiod_line_get_value(eoc->line) == 1) ? 1 : 0;
+    
+    return 0;
+}
+
+/**
+ * @brief     gpio eoc line wait for the rising edge
+ * @param[in] *eoc pointer to a gpio eoc line structure
+ * @param[in] us timeout in us
+ * @return    status code
+ *            - 0 success
+ *            - 1 wait failed
+ *            - 2 timeout
+ * @note      stale edges of the previous conversions are skipped,
+ *            a zero timeout only checks the queued edges without sleeping
+ */
+uint8_t gpio_eoc_line_wait(gpio_eoc_line_t *eoc, uint32_t us)
+{
+    struct gpiod_line_event events[GPIO_EVENT_SIZE];
+    struct timespec timeout;
+    uint64_t deadline;
+    uint64_t now;
+    int res;
+    
+    /* check the line */
+    if ((eoc == NULL) || (eoc->line == NULL))
+    {
+        return 1;
+    }
+    
+    /* set the deadline */
+    deadline = a_gpio_now_ns() + (uint64_t)us * 1000;
+    
+    while (1)
+    {
+        /* a passed deadline still checks the queued events once */
+        now = a_gpio_now_ns();
+        now = (now < deadline) ? now : deadline;
+        timeout.tv_sec = (time_t)((deadline - now) / 1000000000ULL);
+        timeout.tv_nsec = (long)((deadline - now) % 1000000000ULL);
+        
+        /* wait the events */
+        res = gpiod_line_event_wait(eoc->line, &timeout);
+        if (res < 0)
+        {
+            perror("gpio: wait event failed.\n");
+            
+            return 1;
+        }
+        else if (res == 0)
+        {
+            return 2;
+        }
+        else
+        {
+            /* read all queued events */
+            res = gpiod_line_event_read_multiple(eoc->line, events, GPIO_EVENT_SIZE);
+            if (res <= 0)
+            {
+                perror("gpio: read event failed.\n");
+                
+                return 1;
+            }
+            
+            /* eoc is low while converting, a high level means the conversion is finished */
+            if (gpiod_line_get_value(eoc->line) == 1)
+            {
+                eoc->timestamp_ns = (uint64_t)events[res - 1].ts.tv_sec * 1000000000ULL +
+                                    (uint64_t)events[res - 1].ts.tv_nsec;
+                
+                return 0;
+            }
+        }
+    }
+}
+
+/**
+ * @brief      gpio eoc line get the timestamp of the last rising edge
+ * @param[in]  *eoc pointer to a gpio eoc line structure
+ * @param[out] *ns pointer to a timestamp buffer in ns
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       the timestamp is taken by the kernel on CLOCK_MONOTONIC
+ */
+uint8_t gpio_eoc_line_get_timestamp(gpio_eoc_line_t *eoc, uint64_t *ns)
+{
+    /* check the timestamp */
+    if ((eoc == NULL) || (eoc->timestamp_ns == 0))
+    {
+        return 1;
+    }
+    *ns = eoc->timestamp_ns;
+    
+    return 0;
+}
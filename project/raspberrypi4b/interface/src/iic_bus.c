@@ -0,0 +1,410 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      iic_bus.c
+ * @brief     iic bus source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+
+#include "iic_bus.h"
+#include "iic.h"
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+#include <sys/ioctl.h>
+
+/**
+ * @brief      smbus transfer
+ * @param[in]  fd iic handle
+ * @param[in]  read_write I2C_SMBUS_READ or I2C_SMBUS_WRITE
+ * @param[in]  command smbus command
+ * @param[in]  size smbus transaction type
+ * @param[in]  *data pointer to an smbus data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 transfer failed
+ * @note       none
+ */
+static uint8_t a_iic_bus_smbus(int fd, uint8_t read_write, uint8_t command, uint32_t size, union i2c_smbus_data *data)
+{
+    struct i2c_smbus_ioctl_data args;
+    
+    /* set the param */
+    args.read_write = read_write;
+    args.command = command;
+    args.size = size;
+    args.data = data;
+    
+    /* transmit */
+    if (ioctl(fd, I2C_SMBUS, &args) < 0)
+    {
+        perror("iic: smbus transfer failed.\n");
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     set the slave address of the fd
+ * @param[in] *bus pointer to an iic bus structure
+ * @param[in] addr iic device write address
+ * @return    status code
+ *            - 0 success
+ *            - 1 set failed
+ * @note      the ioctl is only issued when the address changes
+ */
+static uint8_t a_iic_bus_set_slave(iic_bus_t *bus, uint8_t addr)
+{
+    uint8_t res = 0;
+    
+    /* fast path */
+    if (__atomic_load_n(&bus->slave, __ATOMIC_ACQUIRE) == (int32_t)(addr >> 1))
+    {
+        return 0;
+    }
+    
+    (void)pthread_mutex_lock(&bus->mutex);
+    
+    /* set the slave address */
+    if (bus->slave != (int32_t)(addr >> 1))
+    {
+        if (ioctl(bus->fd, I2C_SLAVE, (unsigned long)(addr >> 1)) < 0)
+        {
+            perror("iic: set slave failed.\n");
+            res = 1;
+        }
+        else
+        {
+            __atomic_store_n(&bus->slave, (int32_t)(addr >> 1), __ATOMIC_RELEASE);
+        }
+    }
+    
+    (void)pthread_mutex_unlock(&bus->mutex);
+    
+    return res;
+}
+
+/**
+ * @brief     iic bus init
+ * @param[in] *bus pointer to an iic bus structure
+ * @param[in] index bus index of /dev/i2c-N
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      it doesn't open the device, the first iic_bus_open does
+ */
+uint8_t iic_bus_init(iic_bus_t *bus, uint32_t index)
+{
+    /* check the bus */
+    if (bus == NULL)
+    {
+        return 1;
+    }
+    
+    /* set the device name */
+    memset(bus->name, 0, sizeof(bus->name));
+    snprintf(bus->name, sizeof(bus->name), "/dev/i2c-%u", index);
+    bus->fd = -1;
+    bus->users = 0;
+    bus->backend = IIC_BUS_BACKEND_RDWR;
+    bus->slave = -1;
+    
+    /* init the mutex */
+    if (pthread_mutex_init(&bus->mutex, NULL) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     iic bus set the transfer backend
+ * @param[in] *bus pointer to an iic bus structure
+ * @param[in] backend transfer backend
+ * @return    status code
+ *            - 0 success
+ *            - 1 set failed
+ *            - 2 bus is open
+ * @note      the smbus backend sets I2C_SLAVE once per fd and needs no message arrays,
+ *            it works on smbus-only adapters such as i2c-stub, all users of one fd must share one slave address
+ */
+uint8_t iic_bus_set_backend(iic_bus_t *bus, iic_bus_backend_t backend)
+{
+    /* check the param */
+    if ((bus == NULL) || (backend > IIC_BUS_BACKEND_SMBUS))
+    {
+        return 1;
+    }
+    
+    /* check the users */
+    if (bus->users != 0)
+    {
+        return 2;
+    }
+    bus->backend = (uint8_t)backend;
+    
+    return 0;
+}
+
+/**
+ * @brief     iic bus deinit
+ * @param[in] *bus pointer to an iic bus structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ *            - 2 bus is still open
+ * @note      none
+ */
+uint8_t iic_bus_deinit(iic_bus_t *bus)
+{
+    /* check the bus */
+    if (bus == NULL)
+    {
+        return 1;
+    }
+    
+    /* check the users */
+    if (bus->users != 0)
+    {
+        return 2;
+    }
+    
+    /* destroy the mutex */
+    if (pthread_mutex_destroy(&bus->mutex) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     iic bus open
+ * @param[in] *bus pointer to an iic bus structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ * @note      the device is opened by the first user and shared by the others
+ */
+uint8_t iic_bus_open(iic_bus_t *bus)
+{
+    uint8_t res = 0;
+    
+    /* check the bus */
+    if (bus == NULL)
+    {
+        return 1;
+    }
+    
+    (void)pthread_mutex_lock(&bus->mutex);
+    
+    /* the first user opens the device */
+    if (bus->users == 0)
+    {
+        res = iic_init(bus->name, &bus->fd);
+    }
+    if (res == 0)
+    {
+        bus->users++;
+    }
+    
+    (void)pthread_mutex_unlock(&bus->mutex);
+    
+    return res;
+}
+
+/**
+ * @brief     iic bus close
+ * @param[in] *bus pointer to an iic bus structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      the device is closed by the last user
+ */
+uint8_t iic_bus_close(iic_bus_t *bus)
+{
+    uint8_t res = 0;
+    
+    /* check the bus */
+    if (bus == NULL)
+    {
+        return 1;
+    }
+    
+    (void)pthread_mutex_lock(&bus->mutex);
+    
+    /* the last user closes the device */
+    if (bus->users == 0)
+    {
+        res = 1;
+    }
+    else if (bus->users == 1)
+    {
+        res = iic_deinit(bus->fd);
+        bus->fd = -1;
+        bus->users = 0;
+        bus->slave = -1;
+    }
+    else
+    {
+        bus->users--;
+    }
+    
+    (void)pthread_mutex_unlock(&bus->mutex);
+    
+    return res;
+}
+
+/**
+ * @brief      iic bus read
+ * @param[in]  *bus pointer to an iic bus structure
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       addr = device_address_7bits << 1,
+ *             every access is one ioctl, so threads can share the bus without a lock,
+ *             the smbus backend splits reads longer than 32 bytes
+ */
+uint8_t iic_bus_read(iic_bus_t *bus, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    /* check the bus */
+    if ((bus == NULL) || (bus->fd < 0))
+    {
+        return 1;
+    }
+    
+    /* message transfer */
+    if (bus->backend == IIC_BUS_BACKEND_RDWR)
+    {
+        return iic_read(bus->fd, addr, reg, buf, len);
+    }
+    
+    /* smbus transfer */
+    if (a_iic_bus_set_slave(bus, addr) != 0)
+    {
+        return 1;
+    }
+    if (len == 1)
+    {
+        union i2c_smbus_data data;
+        
+        if (a_iic_bus_smbus(bus->fd, I2C_SMBUS_READ, reg, I2C_SMBUS_BYTE_DATA, &data) != 0)
+        {
+            return 1;
+        }
+        buf[0] = data.byte;
+        
+        return 0;
+    }
+    while (len != 0)
+    {
+        union i2c_smbus_data data;
+        uint16_t size = (len > I2C_SMBUS_BLOCK_MAX) ? I2C_SMBUS_BLOCK_MAX : len;
+        
+        data.block[0] = (uint8_t)size;
+        if (a_iic_bus_smbus(bus->fd, I2C_SMBUS_READ, reg, I2C_SMBUS_I2C_BLOCK_DATA, &data) != 0)
+        {
+            return 1;
+        }
+        memcpy(buf, &data.block[1], size);
+        buf += size;
+        reg = (uint8_t)(reg + size);
+        len = (uint16_t)(len - size);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     iic bus write
+ * @param[in] *bus pointer to an iic bus structure
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      addr = device_address_7bits << 1,
+ *            the smbus backend splits writes longer than 32 bytes
+ */
+uint8_t iic_bus_write(iic_bus_t *bus, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    /* check the bus */
+    if ((bus == NULL) || (bus->fd < 0))
+    {
+        return 1;
+    }
+    
+    /* message transfer */
+    if (bus->backend == IIC_BUS_BACKEND_RDWR)
+    {
+        return iic_write(bus->fd, addr, reg, buf, len);
+    }
+    
+    /* smbus transfer */
+    if (a_iic_bus_set_slave(bus, addr) != 0)
+    {
+        return 1;
+    }
+    if (len == 1)
+    {
+        union i2c_smbus_data data;
+        
+        data.byte = buf[0];
+        
+        return a_iic_bus_smbus(bus->fd, I2C_SMBUS_WRITE, reg, I2C_SMBUS_BYTE_DATA, &data);
+    }
+    while (len != 0)
+    {
+        union i2c_smbus_data data;
+        uint16_t size = (len > I2C_SMBUS_BLOCK_MAX) ? I2C_SMBUS_BLOCK_MAX : len;
+        
+        data.block[0] = (uint8_t)size;
+        memcpy(&data.block[1], buf, size);
+        if (a_iic_bus_smbus(bus->fd, I2C_SMBUS_WRITE, reg, I2C_SMBUS_I2C_BLOCK_DATA, &data) != 0)
+        {
+            return 1;
+        }
+        buf += size;
+        reg = (uint8_t)(reg + size);
+        len = (uint16_t)(len - size);
+    }
+    
+    return 0;
+}
@@ -0,0 +1,340 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      periodic.c
+ * @brief     periodic timer source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+
+#include "periodic.h"
+#include <sys/timerfd.h>
+#include <poll.h>
+#include <errno.h>
+#include <math.h>
+#include <time.h>
+
+/**
+ * @brief  get the monotonic time
+ * @return monotonic time in ns
+ * @note   none
+ */
+static uint64_t a_periodic_now(void)
+{
+    struct timespec ts;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief      update the running statistics
+ * @param[in]  value new value
+ * @param[in]  count value count including the new one
+ * @param[out] *min pointer to a min buffer
+ * @param[out] *max pointer to a max buffer
+ * @param[out] *mean pointer to a running mean buffer
+ * @param[out] *m2 pointer to a running sum of squared deviations buffer
+ * @note       welford's online algorithm
+ */
+static void a_periodic_update(double value, uint64_t count, double *min, double *max, double *mean, double *m2)
+{
+    double delta;
+    
+    if (count == 1)
+    {
+        *min = value;
+        *max = value;
+        *mean = 0.0;
+        *m2 = 0.0;
+    }
+    if (value < *min)
+    {
+        *min = value;
+    }
+    if (value > *max)
+    {
+        *max = value;
+    }
+    delta = value - *mean;
+    *mean += delta / (double)count;
+    *m2 += delta * (value - *mean);
+}
+
+/**
+ * @brief     periodic timer init
+ * @param[in] *periodic pointer to a periodic structure
+ * @param[in] period_ns period in ns
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      the timer runs on absolute CLOCK_MONOTONIC deadlines, the first one is one period from now,
+ *            so the read time never adds up and the ticks don't drift
+ */
+uint8_t periodic_init(periodic_t *periodic, uint64_t period_ns)
+{
+    struct itimerspec its;
+    
+    /* check the param */
+    if ((periodic == NULL) || (period_ns == 0))
+    {
+        return 1;
+    }
+    memset(periodic, 0, sizeof(periodic_t));
+    
+    /* create the timer */
+    periodic->fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (periodic->fd < 0)
+    {
+        perror("periodic: create failed.\n");
+        
+        return 1;
+    }
+    
+    /* arm the absolute deadlines */
+    periodic->period_ns = period_ns;
+    periodic->start_ns = a_periodic_now() + period_ns;
+    its.it_value.tv_sec = (time_t)(periodic->start_ns / 1000000000ULL);
+    its.it_value.tv_nsec = (long)(periodic->start_ns % 1000000000ULL);
+    its.it_interval.tv_sec = (time_t)(period_ns / 1000000000ULL);
+    its.it_interval.tv_nsec = (long)(period_ns % 1000000000ULL);
+    if (timerfd_settime(periodic->fd, TFD_TIMER_ABSTIME, &its, NULL) < 0)
+    {
+        perror("periodic: set time failed.\n");
+        (void)close(periodic->fd);
+        periodic->fd = -1;
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     periodic timer deinit
+ * @param[in] *periodic pointer to a periodic structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      none
+ */
+uint8_t periodic_deinit(periodic_t *periodic)
+{
+    /* check the param */
+    if ((periodic == NULL) || (periodic->fd < 0))
+    {
+        return 1;
+    }
+    
+    /* close the timer */
+    if (close(periodic->fd) < 0)
+    {
+        return 1;
+    }
+    periodic->fd = -1;
+    
+    return 0;
+}
+
+/**
+ * @brief      handle the expirations of a readable timer fd
+ * @param[in]  *periodic pointer to a periodic structure
+ * @param[out] *missed pointer to a missed tick buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 no expiration
+ * @note       it never blocks, use it when the fd is polled by an event loop
+ */
+uint8_t periodic_handle(periodic_t *periodic, uint64_t *missed)
+{
+    uint64_t expirations;
+    uint64_t now;
+    uint64_t deadline;
+    
+    /* check the param */
+    if ((periodic == NULL) || (missed == NULL) || (periodic->fd < 0))
+    {
+        return 1;
+    }
+    
+    /* read the expirations */
+    if (read(periodic->fd, &expirations, sizeof(uint64_t)) != sizeof(uint64_t))
+    {
+        if ((errno == EAGAIN) || (errno == EINTR))
+        {
+            return 2;
+        }
+        perror("periodic: read failed.\n");
+        
+        return 1;
+    }
+    now = a_periodic_now();
+    
+    /* the deadline of the latest expiration */
+    periodic->expirations += expirations;
+    deadline = periodic->start_ns + (periodic->expirations - 1) * periodic->period_ns;
+    *missed = expirations - 1;
+    periodic->overruns += *missed;
+    
+    /* update the statistics */
+    periodic->lateness_ns = (now > deadline) ? (now - deadline) : 0;
+    periodic->ticks++;
+    a_periodic_update((double)(int64_t)(now - deadline), periodic->ticks, &periodic->lateness_min,
+                      &periodic->lateness_max, &periodic->lateness_mean, &periodic->lateness_m2);
+    if (periodic->ticks > 1)
+    {
+        periodic->intervals++;
+        a_periodic_update((double)(int64_t)(now - periodic->last_ns - expirations * periodic->period_ns), 
+                          periodic->intervals, &periodic->jitter_min, &periodic->jitter_max, 
+                          &periodic->jitter_mean, &periodic->jitter_m2);
+    }
+    periodic->last_ns = now;
+    
+    return 0;
+}
+
+/**
+ * @brief      wait for the next tick
+ * @param[in]  *periodic pointer to a periodic structure
+ * @param[out] *missed pointer to a missed tick buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 wait failed
+ * @note       missed counts the deadlines that passed while the caller was busy,
+ *             they are skipped instead of being run back to back
+ */
+uint8_t periodic_wait(periodic_t *periodic, uint64_t *missed)
+{
+    struct pollfd pfd;
+    uint8_t res;
+    
+    /* check the param */
+    if ((periodic == NULL) || (missed == NULL) || (periodic->fd < 0))
+    {
+        return 1;
+    }
+    
+    pfd.fd = periodic->fd;
+    pfd.events = POLLIN;
+    while (1)
+    {
+        /* sleep until the deadline */
+        if (poll(&pfd, 1, -1) < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            perror("periodic: poll failed.\n");
+            
+            return 1;
+        }
+        
+        /* handle the expirations */
+        res = periodic_handle(periodic, missed);
+        if (res != 2)
+        {
+            return res;
+        }
+    }
+}
+
+/**
+ * @brief     get the timer fd
+ * @param[in] *periodic pointer to a periodic structure
+ * @return    timer fd
+ * @note      the fd becomes readable at every deadline
+ */
+int periodic_get_fd(periodic_t *periodic)
+{
+    return periodic->fd;
+}
+
+/**
+ * @brief      get the lateness of the last tick
+ * @param[in]  *periodic pointer to a periodic structure
+ * @param[out] *ns pointer to a lateness buffer in ns
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       feed it to a histogram after every periodic_wait
+ */
+uint8_t periodic_get_lateness(periodic_t *periodic, uint64_t *ns)
+{
+    /* check the param */
+    if ((periodic == NULL) || (ns == NULL) || (periodic->ticks == 0))
+    {
+        return 1;
+    }
+    *ns = periodic->lateness_ns;
+    
+    return 0;
+}
+
+/**
+ * @brief      get the statistics
+ * @param[in]  *periodic pointer to a periodic structure
+ * @param[out] *stats pointer to a periodic statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       lateness is the wake time after the deadline, jitter is the interval between two ticks minus the period
+ */
+uint8_t periodic_get_stats(periodic_t *periodic, periodic_stats_t *stats)
+{
+    /* check the param */
+    if ((periodic == NULL) || (stats == NULL))
+    {
+        return 1;
+    }
+    
+    /* convert to us */
+    memset(stats, 0, sizeof(periodic_stats_t));
+    stats->ticks = periodic->ticks;
+    stats->overruns = periodic->overruns;
+    if (periodic->ticks != 0)
+    {
+        stats->lateness_min_us = periodic->lateness_min / 1000.0;
+        stats->lateness_mean_us = periodic->lateness_mean / 1000.0;
+        stats->lateness_max_us = periodic->lateness_max / 1000.0;
+        stats->lateness_stddev_us = sqrt(periodic->lateness_m2 / (double)periodic->ticks) / 1000.0;
+    }
+    if (periodic->intervals != 0)
+    {
+        stats->jitter_min_us = periodic->jitter_min / 1000.0;
+        stats->jitter_max_us = periodic->jitter_max / 1000.0;
+        stats->jitter_stddev_us = sqrt(periodic->jitter_m2 / (double)periodic->intervals) / 1000.0;
+    }
+    
+    return 0;
+}
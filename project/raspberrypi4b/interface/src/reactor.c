@@ -0,0 +1,502 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      reactor.c
+ * @brief     reactor source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "reactor.h"
+#include <sys/timerfd.h>
+#include <sys/epoll.h>
+#include <errno.h>
+#include <time.h>
+
+/**
+ * @brief reactor definition
+ */
+#define REACTOR_MAX_SAMPLES               32           /**< samples harvested per scheduler poll */
+#define REACTOR_EOC_MARGIN_US             2000         /**< fallback delay after the datasheet time with an eoc line */
+
+/**
+ * @brief reactor event kind definition
+ */
+#define REACTOR_EVENT_TIMER               0        /**< earliest scheduler deadline */
+#define REACTOR_EVENT_EOC                 1        /**< eoc rising edge */
+
+/**
+ * @brief  get the monotonic time
+ * @return monotonic time in us
+ * @note   the scheduler deadlines are on the same clock as the timerfd
+ */
+static uint64_t a_reactor_timestamp_us(void)
+{
+    struct timespec ts;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)ts.tv_nsec / 1000;
+}
+
+/**
+ * @brief     sleep on the monotonic clock
+ * @param[in] us time in us
+ * @note      the reactor never blocks in the scheduler, it is only linked for bmp180_scheduler_init
+ */
+static void a_reactor_delay_us(uint32_t us)
+{
+    (void)usleep(us);
+}
+
+/**
+ * @brief     arm the timer on the earliest scheduler deadline
+ * @param[in] *reactor pointer to a reactor structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 arm failed
+ * @note      re-arming drops the pending expirations
+ */
+static uint8_t a_reactor_arm(reactor_t *reactor)
+{
+    struct itimerspec its;
+    uint64_t deadline_us;
+    uint64_t deadline_ns;
+    
+    /* nothing to wait for */
+    if (bmp180_scheduler_get_deadline(&reactor->scheduler, &deadline_us) != 0)
+    {
+        return 0;
+    }
+    
+    /* a zero value would disarm the timer */
+    deadline_ns = deadline_us * 1000;
+    if (deadline_ns == 0)
+    {
+        deadline_ns = 1;
+    }
+    memset(&its, 0, sizeof(struct itimerspec));
+    its.it_value.tv_sec = (time_t)(deadline_ns / 1000000000ULL);
+    its.it_value.tv_nsec = (long)(deadline_ns % 1000000000ULL);
+    if (timerfd_settime(reactor->timer_fd, TFD_TIMER_ABSTIME, &its, NULL) < 0)
+    {
+        perror("reactor: set time failed.\n");
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     consume a ready event
+ * @param[in] *reactor pointer to a reactor structure
+ * @param[in] index sensor index
+ * @param[in] kind event kind
+ * @return    status code
+ *            - 0 success
+ *            - 1 consume failed
+ * @note      an eoc edge makes the running conversion of its sensor due at once
+ */
+static uint8_t a_reactor_event(reactor_t *reactor, uint8_t index, uint8_t kind)
+{
+    reactor_sensor_t *sensor;
+    uint64_t expirations;
+    uint8_t high;
+    
+    /* the timer only wakes the loop */
+    if (kind == REACTOR_EVENT_TIMER)
+    {
+        if (read(reactor->timer_fd, &expirations, sizeof(uint64_t)) != (ssize_t)sizeof(uint64_t))
+        {
+            /* re-armed after the wake */
+            return (errno == EAGAIN) ? 0 : 1;
+        }
+        
+        return 0;
+    }
+    sensor = &reactor->sensor[index];
+    if (gpio_eoc_line_read(sensor->eoc, &high) != 0)
+    {
+        return 1;
+    }
+    
+    /* stale edge of a harvested conversion or nothing running */
+    if ((high != 0) && (bmp180_scheduler_wake(&reactor->scheduler, index) == 0))
+    {
+        sensor->edge = 1;
+        sensor->eoc_wakes++;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     run the due conversions and deliver the samples
+ * @param[in] *reactor pointer to a reactor structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 harvest failed
+ * @note      the scheduler starts the next conversion before the callback adds its latency
+ */
+static uint8_t a_reactor_harvest(reactor_t *reactor)
+{
+    bmp180_sample_t sample[REACTOR_MAX_SAMPLES];
+    reactor_sensor_t *sensor;
+    uint32_t count;
+    uint32_t i;
+    
+    do
+    {
+        if (bmp180_scheduler_poll(&reactor->scheduler, sample, REACTOR_MAX_SAMPLES, &count) != 0)
+        {
+            return 1;
+        }
+        for (i = 0; i < count; i++)
+        {
+            /* the kernel edge time is closer to the conversion end */
+            sensor = &reactor->sensor[sample[i].sensor];
+            if ((sensor->edge != 0) && (sensor->eoc->timestamp_ns != 0))
+            {
+                sample[i].timestamp_us = sensor->eoc->timestamp_ns / 1000;
+            }
+            reactor->samples++;
+            reactor->callback(reactor->arg, &sample[i]);
+        }
+    } while (count == REACTOR_MAX_SAMPLES);
+    
+    /* the edges belong to this wake */
+    for (i = 0; i < reactor->count; i++)
+    {
+        reactor->sensor[i].edge = 0;
+    }
+    
+    return a_reactor_arm(reactor);
+}
+
+/**
+ * @brief     reactor init
+ * @param[in] *reactor pointer to a reactor structure
+ * @param[in] *sensor pointer to a sensor array
+ * @param[in] *slot pointer to a scheduler sensor array
+ * @param[in] capacity capacity of both arrays
+ * @param[in] callback sample callback
+ * @param[in] *arg callback argument
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      the conversions run on bmp180_scheduler, the reactor only waits for its deadline and the eoc edges
+ */
+uint8_t reactor_init(reactor_t *reactor, reactor_sensor_t *sensor, bmp180_scheduler_sensor_t *slot, uint8_t capacity,
+                     reactor_callback_t callback, void *arg)
+{
+    struct epoll_event event;
+    
+    /* check the param */
+    if ((reactor == NULL) || (sensor == NULL) || (slot == NULL) || (capacity == 0) || (callback == NULL))
+    {
+        return 1;
+    }
+    memset(reactor, 0, sizeof(reactor_t));
+    reactor->epoll_fd = -1;
+    reactor->timer_fd = -1;
+    
+    /* the scheduler keeps the conversion state */
+    if (bmp180_scheduler_init(&reactor->scheduler, slot, capacity, a_reactor_timestamp_us, a_reactor_delay_us) != 0)
+    {
+        return 1;
+    }
+    
+    /* create the epoll set */
+    reactor->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (reactor->epoll_fd < 0)
+    {
+        perror("reactor: create failed.\n");
+        
+        return 1;
+    }
+    
+    /* one timer follows the earliest deadline of all sensors */
+    reactor->timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (reactor->timer_fd < 0)
+    {
+        perror("reactor: create timer failed.\n");
+        (void)close(reactor->epoll_fd);
+        reactor->epoll_fd = -1;
+        
+        return 1;
+    }
+    memset(&event, 0, sizeof(struct epoll_event));
+    event.events = EPOLLIN;
+    event.data.u32 = REACTOR_EVENT_TIMER;
+    if (epoll_ctl(reactor->epoll_fd, EPOLL_CTL_ADD, reactor->timer_fd, &event) < 0)
+    {
+        perror("reactor: add timer failed.\n");
+        (void)close(reactor->timer_fd);
+        (void)close(reactor->epoll_fd);
+        reactor->timer_fd = -1;
+        reactor->epoll_fd = -1;
+        
+        return 1;
+    }
+    reactor->sensor = sensor;
+    reactor->capacity = capacity;
+    reactor->callback = callback;
+    reactor->arg = arg;
+    
+    return 0;
+}
+
+/**
+ * @brief     reactor deinit
+ * @param[in] *reactor pointer to a reactor structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      the handles and the eoc lines belong to the caller and are not closed
+ */
+uint8_t reactor_deinit(reactor_t *reactor)
+{
+    /* check the reactor */
+    if ((reactor == NULL) || (reactor->epoll_fd < 0))
+    {
+        return 1;
+    }
+    
+    /* close the timer and the epoll set */
+    (void)close(reactor->timer_fd);
+    reactor->timer_fd = -1;
+    (void)close(reactor->epoll_fd);
+    reactor->epoll_fd = -1;
+    reactor->count = 0;
+    
+    return 0;
+}
+
+/**
+ * @brief      add a sensor to the reactor
+ * @param[in]  *reactor pointer to a reactor structure
+ * @param[in]  *handle pointer to an initialized bmp180 handle
+ * @param[in]  *eoc pointer to an initialized eoc line or NULL
+ * @param[in]  period_ns sample period in ns, 0 means back to back
+ * @param[out] *index pointer to a sensor index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 add failed
+ *             - 2 reactor is full
+ * @note       the first conversion starts at the next reactor_run_once,
+ *             with an eoc line the conversion is harvested on the rising edge and the timer is only a fallback
+ */
+uint8_t reactor_add(reactor_t *reactor, bmp180_handle_t *handle, gpio_eoc_line_t *eoc, uint64_t period_ns,
+                    uint8_t *index)
+{
+    struct epoll_event event;
+    uint8_t i;
+    
+    /* check the param */
+    if ((reactor == NULL) || (reactor->epoll_fd < 0) || (handle == NULL) || (index == NULL))
+    {
+        return 1;
+    }
+    if ((eoc != NULL) && (eoc->fd < 0))
+    {
+        return 1;
+    }
+    if (reactor->count >= reactor->capacity)
+    {
+        return 2;
+    }
+    i = reactor->count;
+    
+    /* watch the eoc line, the index and the kind share the event data */
+    if (eoc != NULL)
+    {
+        memset(&event, 0, sizeof(struct epoll_event));
+        event.events = EPOLLIN;
+        event.data.u32 = ((uint32_t)i << 1) | REACTOR_EVENT_EOC;
+        if (epoll_ctl(reactor->epoll_fd, EPOLL_CTL_ADD, eoc->fd, &event) < 0)
+        {
+            perror("reactor: add eoc failed.\n");
+            
+            return 1;
+        }
+    }
+    
+    /* hand the handle to the scheduler, the timer is a late fallback with an eoc line */
+    if ((bmp180_scheduler_add(&reactor->scheduler, handle, &i) != 0) ||
+        (bmp180_scheduler_set_sensor_timing(&reactor->scheduler, i, (uint32_t)(period_ns / 1000),
+                                            (eoc != NULL) ? REACTOR_EOC_MARGIN_US : 0) != 0))
+    {
+        if (eoc != NULL)
+        {
+            (void)epoll_ctl(reactor->epoll_fd, EPOLL_CTL_DEL, eoc->fd, NULL);
+        }
+        
+        return 1;
+    }
+    memset(&reactor->sensor[i], 0, sizeof(reactor_sensor_t));
+    reactor->sensor[i].eoc = eoc;
+    reactor->count++;
+    *index = i;
+    
+    /* the first start is due now */
+    return a_reactor_arm(reactor);
+}
+
+/**
+ * @brief     wait once and dispatch the ready sensors
+ * @param[in] *reactor pointer to a reactor structure
+ * @param[in] timeout_ms wait timeout in ms, -1 means forever
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      every finished sample is passed to the callback before it returns
+ */
+uint8_t reactor_run_once(reactor_t *reactor, int32_t timeout_ms)
+{
+    struct epoll_event events[REACTOR_MAX_EVENTS];
+    int res;
+    int i;
+    
+    /* check the reactor */
+    if ((reactor == NULL) || (reactor->epoll_fd < 0))
+    {
+        return 1;
+    }
+    
+    /* wait for the deadline and the edges */
+    res = epoll_wait(reactor->epoll_fd, events, REACTOR_MAX_EVENTS, timeout_ms);
+    if (res < 0)
+    {
+        if (errno == EINTR)
+        {
+            return 0;
+        }
+        perror("reactor: wait failed.\n");
+        
+        return 1;
+    }
+    reactor->wakes++;
+    
+    /* consume the events, then let the scheduler run everything that is due */
+    for (i = 0; i < res; i++)
+    {
+        if (a_reactor_event(reactor, (uint8_t)(events[i].data.u32 >> 1),
+                            (uint8_t)(events[i].data.u32 & 1)) != 0)
+        {
+            return 1;
+        }
+    }
+    
+    return a_reactor_harvest(reactor);
+}
+
+/**
+ * @brief     run the reactor until reactor_stop is called
+ * @param[in] *reactor pointer to a reactor structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      none
+ */
+uint8_t reactor_run(reactor_t *reactor)
+{
+    /* check the reactor */
+    if ((reactor == NULL) || (reactor->epoll_fd < 0))
+    {
+        return 1;
+    }
+    
+    /* loop until stopped */
+    reactor->running = 1;
+    while (reactor->running != 0)
+    {
+        if (reactor_run_once(reactor, -1) != 0)
+        {
+            reactor->running = 0;
+            
+            return 1;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     stop the running reactor
+ * @param[in] *reactor pointer to a reactor structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 stop failed
+ * @note      it can be called from the callback
+ */
+uint8_t reactor_stop(reactor_t *reactor)
+{
+    /* check the reactor */
+    if (reactor == NULL)
+    {
+        return 1;
+    }
+    reactor->running = 0;
+    
+    return 0;
+}
+
+/**
+ * @brief      get the sensor statistics
+ * @param[in]  *reactor pointer to a reactor structure
+ * @param[in]  index sensor index
+ * @param[out] *samples pointer to a sample counter buffer
+ * @param[out] *overruns pointer to an overrun counter buffer
+ * @param[out] *errors pointer to an error counter buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+uint8_t reactor_get_sensor_stats(reactor_t *reactor, uint8_t index, uint64_t *samples, uint64_t *overruns,
+                                 uint32_t *errors)
+{
+    uint32_t rate_mhz;
+    
+    /* check the param */
+    if ((reactor == NULL) || (index >= reactor->count) ||
+        (samples == NULL) || (overruns == NULL) || (errors == NULL))
+    {
+        return 1;
+    }
+    if ((bmp180_scheduler_get_sensor_rate(&reactor->scheduler, index, samples, errors, &rate_mhz) != 0) ||
+        (bmp180_scheduler_get_sensor_overruns(&reactor->scheduler, index, overruns) != 0))
+    {
+        return 1;
+    }
+    
+    return 0;
+}
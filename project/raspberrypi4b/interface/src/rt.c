@@ -0,0 +1,299 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      rt.c
+ * @brief     real-time source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#define _GNU_SOURCE
+#include "rt.h"
+#include <sys/mman.h>
+#include <malloc.h>
+#include <sched.h>
+#include <time.h>
+
+/**
+ * @brief rt prefault definition
+ */
+#define RT_PREFAULT_STACK_SIZE        (256 * 1024)        /**< stack touched by rt_enter */
+
+/**
+ * @brief  touch the stack so the first deadline doesn't take page faults
+ * @note   the buffer is volatile so the compiler keeps the writes
+ */
+static void a_rt_prefault_stack(void)
+{
+    volatile uint8_t buf[RT_PREFAULT_STACK_SIZE];
+    uint32_t i;
+    
+    for (i = 0; i < RT_PREFAULT_STACK_SIZE; i += 256)
+    {
+        buf[i] = 0;
+    }
+    (void)buf[0];
+}
+
+/**
+ * @brief     make the calling thread real-time
+ * @param[in] *config pointer to a rt config structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 enter failed
+ * @note      SCHED_FIFO and mlockall need root or CAP_SYS_NICE and CAP_IPC_LOCK,
+ *            every step is tried and the failed ones are printed
+ */
+uint8_t rt_enter(const rt_config_t *config)
+{
+    struct sched_param param;
+    uint8_t res = 0;
+    int err;
+    
+    /* check the param */
+    if ((config == NULL) || (config->priority < sched_get_priority_min(SCHED_FIFO)) ||
+        (config->priority > sched_get_priority_max(SCHED_FIFO)))
+    {
+        return 1;
+    }
+    
+    /* pin the thread */
+    if (config->cpu >= 0)
+    {
+        cpu_set_t set;
+        
+        CPU_ZERO(&set);
+        CPU_SET(config->cpu, &set);
+        err = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &set);
+        if (err != 0)
+        {
+            (void)fprintf(stderr, "rt: set cpu %d failed: %s.\n", (int)config->cpu, strerror(err));
+            res = 1;
+        }
+    }
+    
+    /* lock the memory, freed heap stays mapped so it never faults again */
+    if (config->lock_memory != 0)
+    {
+        (void)mallopt(M_TRIM_THRESHOLD, -1);
+        (void)mallopt(M_MMAP_MAX, 0);
+        if (mlockall(MCL_CURRENT | MCL_FUTURE) < 0)
+        {
+            perror("rt: mlockall failed.\n");
+            res = 1;
+        }
+    }
+    
+    /* fault the stack in */
+    if (config->prefault_stack != 0)
+    {
+        a_rt_prefault_stack();
+    }
+    
+    /* switch to SCHED_FIFO last, so the setup above doesn't run with the real-time priority */
+    memset(&param, 0, sizeof(struct sched_param));
+    param.sched_priority = config->priority;
+    err = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+    if (err != 0)
+    {
+        (void)fprintf(stderr, "rt: set SCHED_FIFO %d failed: %s.\n", (int)config->priority, strerror(err));
+        res = 1;
+    }
+    
+    return res;
+}
+
+/**
+ * @brief  make the calling thread a normal thread again
+ * @return status code
+ *         - 0 success
+ *         - 1 leave failed
+ * @note   the memory is unlocked as well
+ */
+uint8_t rt_leave(void)
+{
+    struct sched_param param;
+    uint8_t res = 0;
+    
+    /* back to SCHED_OTHER */
+    memset(&param, 0, sizeof(struct sched_param));
+    if (pthread_setschedparam(pthread_self(), SCHED_OTHER, &param) != 0)
+    {
+        res = 1;
+    }
+    
+    /* unlock the memory */
+    if (munlockall() < 0)
+    {
+        res = 1;
+    }
+    
+    return res;
+}
+
+/**
+ * @brief     clear the histogram
+ * @param[in] *histogram pointer to a rt histogram structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 clear failed
+ * @note      none
+ */
+uint8_t rt_histogram_clear(rt_histogram_t *histogram)
+{
+    /* check the param */
+    if (histogram == NULL)
+    {
+        return 1;
+    }
+    memset(histogram, 0, sizeof(rt_histogram_t));
+    
+    return 0;
+}
+
+/**
+ * @brief     add a value to the histogram
+ * @param[in] *histogram pointer to a rt histogram structure
+ * @param[in] ns value in ns
+ * @return    status code
+ *            - 0 success
+ *            - 1 add failed
+ * @note      it never allocates, so it is safe on the real-time thread
+ */
+uint8_t rt_histogram_add(rt_histogram_t *histogram, uint64_t ns)
+{
+    uint64_t us;
+    
+    /* check the param */
+    if (histogram == NULL)
+    {
+        return 1;
+    }
+    
+    /* 1us buckets with the overflow in the last one */
+    us = ns / 1000;
+    if (us >= RT_HISTOGRAM_BUCKETS)
+    {
+        us = RT_HISTOGRAM_BUCKETS - 1;
+    }
+    histogram->bucket[us]++;
+    if ((histogram->count == 0) || (ns < histogram->min_ns))
+    {
+        histogram->min_ns = ns;
+    }
+    if (ns > histogram->max_ns)
+    {
+        histogram->max_ns = ns;
+    }
+    histogram->sum_ns += ns;
+    histogram->count++;
+    
+    return 0;
+}
+
+/**
+ * @brief      get the percentile of the histogram
+ * @param[in]  *histogram pointer to a rt histogram structure
+ * @param[in]  percent percentile 0.0 - 100.0
+ * @param[out] *us pointer to a value buffer in us
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       the upper edge of the bucket is returned, the overflow bucket returns the max
+ */
+uint8_t rt_histogram_get_percentile(rt_histogram_t *histogram, double percent, uint32_t *us)
+{
+    uint64_t target;
+    uint64_t sum;
+    uint32_t i;
+    
+    /* check the param */
+    if ((histogram == NULL) || (us == NULL) || (histogram->count == 0) || 
+        (percent < 0.0) || (percent > 100.0))
+    {
+        return 1;
+    }
+    
+    /* the first bucket that covers the rank */
+    target = (uint64_t)((double)histogram->count * percent / 100.0 + 0.5);
+    if (target == 0)
+    {
+        target = 1;
+    }
+    sum = 0;
+    for (i = 0; i < RT_HISTOGRAM_BUCKETS - 1; i++)
+    {
+        sum += histogram->bucket[i];
+        if (sum >= target)
+        {
+            *us = i + 1;
+            
+            return 0;
+        }
+    }
+    *us = (uint32_t)((histogram->max_ns + 999) / 1000);
+    
+    return 0;
+}
+
+/**
+ * @brief      get the count of a histogram range
+ * @param[in]  *histogram pointer to a rt histogram structure
+ * @param[in]  from_us first value of the range in us
+ * @param[in]  to_us value after the range in us
+ * @param[out] *count pointer to a count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       to_us >= RT_HISTOGRAM_BUCKETS includes the overflow
+ */
+uint8_t rt_histogram_get_range(rt_histogram_t *histogram, uint32_t from_us, uint32_t to_us, uint64_t *count)
+{
+    uint32_t i;
+    
+    /* check the param */
+    if ((histogram == NULL) || (count == NULL) || (from_us > to_us))
+    {
+        return 1;
+    }
+    
+    /* sum the buckets */
+    if (to_us > RT_HISTOGRAM_BUCKETS)
+    {
+        to_us = RT_HISTOGRAM_BUCKETS;
+    }
+    *count = 0;
+    for (i = from_us; i < to_us; i++)
+    {
+        *count += histogram->bucket[i];
+    }
+    
+    return 0;
+}
@@ -0,0 +1,1003 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      sample_log.c
+ * @brief     sample log source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "sample_log.h"
+#include <fcntl.h>
+#include <errno.h>
+#include <unistd.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/**
+ * @brief sample log layout definition
+ */
+#define SAMPLE_LOG_HEADER_CRC        40                                                        /**< crc offset of the file header */
+#define SAMPLE_LOG_HEADER_SIZE       44                                                        /**< file header size */
+#define SAMPLE_LOG_BLOCK_CRC         40                                                        /**< crc offset of the block header */
+#define SAMPLE_LOG_PAYLOAD_MAX       (SAMPLE_LOG_BLOCK_SIZE - SAMPLE_LOG_BLOCK_HEADER_SIZE)    /**< max payload size */
+
+/**
+ * @brief crc32 nibble table definition
+ */
+static const uint32_t gsc_crc32_table[16] =
+{
+    0x00000000U, 0x1DB71064U, 0x3B6E20C8U, 0x26D930ACU, 0x76DC4190U, 0x6B6B51F4U, 0x4DB26158U, 0x5005713CU,
+    0xEDB88320U, 0xF00F9344U, 0xD6D6A3E8U, 0xCB61B38CU, 0x9B64C2B0U, 0x86D3D2D4U, 0xA00AE278U, 0xBDBDF21CU,
+};
+
+/**
+ * @brief     update a crc32
+ * @param[in] crc running crc
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len data length
+ * @return    updated crc
+ * @note      ieee 802.3 polynomial, start with 0xFFFFFFFF and invert the result
+ */
+static uint32_t a_sample_log_crc32(uint32_t crc, const uint8_t *buf, size_t len)
+{
+    size_t i;
+    
+    for (i = 0; i < len; i++)
+    {
+        crc ^= buf[i];
+        crc = (crc >> 4) ^ gsc_crc32_table[crc & 0x0F];
+        crc = (crc >> 4) ^ gsc_crc32_table[crc & 0x0F];
+    }
+    
+    return crc;
+}
+
+/**
+ * @brief      put a little endian value
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  value value to put
+ * @param[in]  bytes value size
+ * @note       the file format doesn't depend on the host byte order
+ */
+static void a_sample_log_put_le(uint8_t *buf, uint64_t value, uint8_t bytes)
+{
+    uint8_t i;
+    
+    for (i = 0; i < bytes; i++)
+    {
+        buf[i] = (uint8_t)(value >> (8 * i));
+    }
+}
+
+/**
+ * @brief     get a little endian value
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] bytes value size
+ * @return    value
+ * @note      none
+ */
+static uint64_t a_sample_log_get_le(const uint8_t *buf, uint8_t bytes)
+{
+    uint64_t value;
+    uint8_t i;
+    
+    value = 0;
+    for (i = 0; i < bytes; i++)
+    {
+        value |= (uint64_t)buf[i] << (8 * i);
+    }
+    
+    return value;
+}
+
+/**
+ * @brief      put a varint
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  value value to put
+ * @return     encoded size
+ * @note       7 bits per byte, the high bit marks a following byte
+ */
+static uint8_t a_sample_log_put_varint(uint8_t *buf, uint64_t value)
+{
+    uint8_t len;
+    
+    len = 0;
+    while (value >= 0x80)
+    {
+        buf[len++] = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    buf[len++] = (uint8_t)value;
+    
+    return len;
+}
+
+/**
+ * @brief         get a varint
+ * @param[in]     *buf pointer to a data buffer
+ * @param[in]     len data length
+ * @param[in,out] *pos pointer to a read position
+ * @param[out]    *value pointer to a value buffer
+ * @return        status code
+ *                - 0 success
+ *                - 1 the varint is truncated or too long
+ * @note          none
+ */
+static uint8_t a_sample_log_get_varint(const uint8_t *buf, uint32_t len, uint32_t *pos, uint64_t *value)
+{
+    uint8_t shift;
+    uint8_t b;
+    
+    *value = 0;
+    for (shift = 0; shift < 64; shift += 7)
+    {
+        if (*pos >= len)
+        {
+            return 1;
+        }
+        b = buf[(*pos)++];
+        *value |= (uint64_t)(b & 0x7F) << shift;
+        if ((b & 0x80) == 0)
+        {
+            return 0;
+        }
+    }
+    
+    return 1;
+}
+
+/**
+ * @brief     zig-zag encode a signed value
+ * @param[in] value signed value
+ * @return    unsigned value, small magnitudes stay small
+ * @note      none
+ */
+static uint64_t a_sample_log_zigzag(int64_t value)
+{
+    return ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+}
+
+/**
+ * @brief     zig-zag decode an unsigned value
+ * @param[in] value unsigned value
+ * @return    signed value
+ * @note      none
+ */
+static int64_t a_sample_log_unzigzag(uint64_t value)
+{
+    return (int64_t)(value >> 1) ^ -(int64_t)(value & 1);
+}
+
+/**
+ * @brief     check a block
+ * @param[in] *block pointer to a block
+ * @return    status code
+ *            - 0 success
+ *            - 1 the block is torn or corrupted
+ * @note      none
+ */
+static uint8_t a_sample_log_check_block(const uint8_t *block)
+{
+    uint32_t crc;
+    uint16_t records;
+    uint16_t len;
+    
+    /* check the header */
+    if (memcmp(block, SAMPLE_LOG_BLOCK_MAGIC, 4) != 0)
+    {
+        return 1;
+    }
+    records = (uint16_t)a_sample_log_get_le(&block[4], 2);
+    len = (uint16_t)a_sample_log_get_le(&block[6], 2);
+    if ((records == 0) || (len > SAMPLE_LOG_PAYLOAD_MAX))
+    {
+        return 1;
+    }
+    
+    /* check the crc of the header and the payload */
+    crc = a_sample_log_crc32(0xFFFFFFFFU, block, SAMPLE_LOG_BLOCK_CRC);
+    crc = a_sample_log_crc32(crc, &block[SAMPLE_LOG_BLOCK_HEADER_SIZE], len);
+    if ((crc ^ 0xFFFFFFFFU) != (uint32_t)a_sample_log_get_le(&block[SAMPLE_LOG_BLOCK_CRC], 4))
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     check a file header
+ * @param[in] *header pointer to a file header
+ * @return    status code
+ *            - 0 success
+ *            - 1 the file is not a sample log
+ * @note      none
+ */
+static uint8_t a_sample_log_check_header(const uint8_t *header)
+{
+    uint32_t crc;
+    
+    if ((memcmp(header, SAMPLE_LOG_MAGIC, 4) != 0) ||
+        (a_sample_log_get_le(&header[4], 2) != SAMPLE_LOG_VERSION) ||
+        (a_sample_log_get_le(&header[6], 2) != SAMPLE_LOG_HEADER_SIZE) ||
+        (a_sample_log_get_le(&header[8], 4) != SAMPLE_LOG_BLOCK_SIZE) ||
+        (a_sample_log_get_le(&header[12], 2) != BMP180_CALIBRATION_SIZE))
+    {
+        return 1;
+    }
+    crc = a_sample_log_crc32(0xFFFFFFFFU, header, SAMPLE_LOG_HEADER_CRC) ^ 0xFFFFFFFFU;
+    if (crc != (uint32_t)a_sample_log_get_le(&header[SAMPLE_LOG_HEADER_CRC], 4))
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     write a buffer at an offset
+ * @param[in] fd file fd
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len data length
+ * @param[in] offset file offset
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      short writes and interrupted calls are retried
+ */
+static uint8_t a_sample_log_write_all(int fd, const uint8_t *buf, size_t len, off_t offset)
+{
+    ssize_t res;
+    
+    while (len != 0)
+    {
+        res = pwrite(fd, buf, len, offset);
+        if (res < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            perror("sample_log: write failed.\n");
+            
+            return 1;
+        }
+        buf += res;
+        len -= (size_t)res;
+        offset += res;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     read a buffer at an offset
+ * @param[in] fd file fd
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len data length
+ * @param[in] offset file offset
+ * @return    status code
+ *            - 0 success
+ *            - 1 read failed
+ * @note      none
+ */
+static uint8_t a_sample_log_read_all(int fd, uint8_t *buf, size_t len, off_t offset)
+{
+    ssize_t res;
+    
+    while (len != 0)
+    {
+        res = pread(fd, buf, len, offset);
+        if (res < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            
+            return 1;
+        }
+        if (res == 0)
+        {
+            return 1;
+        }
+        buf += res;
+        len -= (size_t)res;
+        offset += res;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  stub iic init of the reader handle
+ * @return status code
+ *         - 0 success
+ * @note   the reader handle never touches a bus
+ */
+static uint8_t a_sample_log_iic_init(void)
+{
+    return 0;
+}
+
+/**
+ * @brief  stub iic deinit of the reader handle
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+static uint8_t a_sample_log_iic_deinit(void)
+{
+    return 0;
+}
+
+/**
+ * @brief     stub iic read and write of the reader handle
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len data length
+ * @return    status code
+ *            - 1 no bus
+ * @note      none
+ */
+static uint8_t a_sample_log_iic_transfer(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    (void)addr;
+    (void)reg;
+    (void)buf;
+    (void)len;
+    
+    return 1;
+}
+
+/**
+ * @brief     stub delay of the reader handle
+ * @param[in] ms time
+ * @note      none
+ */
+static void a_sample_log_delay_ms(uint32_t ms)
+{
+    (void)ms;
+}
+
+/**
+ * @brief     stub debug print of the reader handle
+ * @param[in] fmt format data
+ * @note      the driver messages of the reader handle are dropped
+ */
+static void a_sample_log_debug_print(const char *const fmt, ...)
+{
+    (void)fmt;
+}
+
+/**
+ * @brief     seal and write the open block
+ * @param[in] *writer pointer to a sample log writer structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+static uint8_t a_sample_log_seal(sample_log_writer_t *writer)
+{
+    uint8_t *block;
+    uint32_t crc;
+    
+    /* nothing to seal */
+    if (writer->records == 0)
+    {
+        return 0;
+    }
+    
+    /* finish the header, the base record is already in place */
+    block = writer->block;
+    memcpy(block, SAMPLE_LOG_BLOCK_MAGIC, 4);
+    a_sample_log_put_le(&block[4], writer->records, 2);
+    a_sample_log_put_le(&block[6], writer->len, 2);
+    a_sample_log_put_le(&block[8], writer->index, 8);
+    a_sample_log_put_le(&block[16], writer->first_us, 8);
+    a_sample_log_put_le(&block[24], writer->last_us, 8);
+    crc = a_sample_log_crc32(0xFFFFFFFFU, block, SAMPLE_LOG_BLOCK_CRC);
+    crc = a_sample_log_crc32(crc, &block[SAMPLE_LOG_BLOCK_HEADER_SIZE], writer->len);
+    a_sample_log_put_le(&block[SAMPLE_LOG_BLOCK_CRC], crc ^ 0xFFFFFFFFU, 4);
+    
+    /* every block is written once at the end of the file */
+    if (a_sample_log_write_all(writer->fd, block, SAMPLE_LOG_BLOCK_SIZE,
+                               (off_t)((writer->blocks + 1) * SAMPLE_LOG_BLOCK_SIZE)) != 0)
+    {
+        return 1;
+    }
+    if ((writer->sync != 0) && (fdatasync(writer->fd) < 0))
+    {
+        perror("sample_log: fdatasync failed.\n");
+        
+        return 1;
+    }
+    writer->blocks++;
+    writer->sealed++;
+    writer->index += writer->records;
+    writer->records = 0;
+    writer->len = 0;
+    memset(block, 0, SAMPLE_LOG_BLOCK_SIZE);
+    
+    return 0;
+}
+
+/**
+ * @brief     prepare the file of a writer
+ * @param[in] *writer pointer to a sample log writer structure
+ * @param[in] *path pointer to a file path
+ * @param[in] *calibration pointer to a calibration blob
+ * @return    status code
+ *            - 0 success
+ *            - 1 io failed
+ *            - 4 the file belongs to another sensor or is not a sample log
+ * @note      none
+ */
+static uint8_t a_sample_log_writer_prepare(sample_log_writer_t *writer, const char *path, const uint8_t *calibration)
+{
+    uint8_t *block;
+    struct stat st;
+    uint64_t blocks;
+    
+    block = writer->block;
+    if (fstat(writer->fd, &st) < 0)
+    {
+        perror("sample_log: fstat failed.\n");
+        
+        return 1;
+    }
+    
+    /* a new file starts with the header block */
+    if (st.st_size == 0)
+    {
+        memcpy(block, SAMPLE_LOG_MAGIC, 4);
+        a_sample_log_put_le(&block[4], SAMPLE_LOG_VERSION, 2);
+        a_sample_log_put_le(&block[6], SAMPLE_LOG_HEADER_SIZE, 2);
+        a_sample_log_put_le(&block[8], SAMPLE_LOG_BLOCK_SIZE, 4);
+        a_sample_log_put_le(&block[12], BMP180_CALIBRATION_SIZE, 2);
+        memcpy(&block[14], calibration, BMP180_CALIBRATION_SIZE);
+        a_sample_log_put_le(&block[SAMPLE_LOG_HEADER_CRC], 
+                            a_sample_log_crc32(0xFFFFFFFFU, block, SAMPLE_LOG_HEADER_CRC) ^ 0xFFFFFFFFU, 4);
+        if ((a_sample_log_write_all(writer->fd, block, SAMPLE_LOG_BLOCK_SIZE, 0) != 0) ||
+            (fdatasync(writer->fd) < 0))
+        {
+            return 1;
+        }
+        memset(block, 0, SAMPLE_LOG_BLOCK_SIZE);
+        
+        return 0;
+    }
+    
+    /* an existing file must be a log of the same sensor */
+    if ((st.st_size < SAMPLE_LOG_BLOCK_SIZE) ||
+        (a_sample_log_read_all(writer->fd, block, SAMPLE_LOG_BLOCK_SIZE, 0) != 0) ||
+        (a_sample_log_check_header(block) != 0))
+    {
+        (void)fprintf(stderr, "sample_log: %s is not a sample log.\n", path);
+        
+        return 4;
+    }
+    if (memcmp(&block[14], calibration, BMP180_CALIBRATION_SIZE) != 0)
+    {
+        (void)fprintf(stderr, "sample_log: %s belongs to another sensor.\n", path);
+        
+        return 4;
+    }
+    
+    /* a crash leaves at most one torn block at the end */
+    blocks = (uint64_t)(st.st_size / SAMPLE_LOG_BLOCK_SIZE) - 1;
+    if ((blocks != 0) &&
+        ((a_sample_log_read_all(writer->fd, block, SAMPLE_LOG_BLOCK_SIZE, 
+                                (off_t)(blocks * SAMPLE_LOG_BLOCK_SIZE)) != 0) ||
+         (a_sample_log_check_block(block) != 0)))
+    {
+        blocks--;
+    }
+    if ((uint64_t)st.st_size != (blocks + 1) * SAMPLE_LOG_BLOCK_SIZE)
+    {
+        (void)fprintf(stderr, "sample_log: cut the torn tail of %s.\n", path);
+        if (ftruncate(writer->fd, (off_t)((blocks + 1) * SAMPLE_LOG_BLOCK_SIZE)) < 0)
+        {
+            perror("sample_log: ftruncate failed.\n");
+            
+            return 1;
+        }
+    }
+    writer->blocks = blocks;
+    
+    /* continue the index and the timestamps of the last block */
+    if (blocks != 0)
+    {
+        if (a_sample_log_read_all(writer->fd, block, SAMPLE_LOG_BLOCK_HEADER_SIZE, 
+                                  (off_t)(blocks * SAMPLE_LOG_BLOCK_SIZE)) != 0)
+        {
+            return 1;
+        }
+        writer->index = a_sample_log_get_le(&block[8], 8) + a_sample_log_get_le(&block[4], 2);
+        writer->last_us = a_sample_log_get_le(&block[24], 8);
+    }
+    memset(block, 0, SAMPLE_LOG_BLOCK_SIZE);
+    
+    return 0;
+}
+
+/**
+ * @brief     open a sample log for appending
+ * @param[in] *writer pointer to a sample log writer structure
+ * @param[in] *path pointer to a file path
+ * @param[in] *calibration pointer to a calibration blob from bmp180_export_calibration
+ * @param[in] sync fdatasync flag of every sealed block
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ *            - 4 the file belongs to another sensor or is not a sample log
+ * @note      a new file gets the header block, an existing file is checked and a torn last block
+ *            of a crashed writer is cut off, the records are appended after the last complete block
+ */
+uint8_t sample_log_writer_open(sample_log_writer_t *writer, const char *path, const uint8_t *calibration, uint8_t sync)
+{
+    uint8_t res;
+    
+    /* check the param */
+    if ((writer == NULL) || (path == NULL) || (calibration == NULL))
+    {
+        return 1;
+    }
+    memset(writer, 0, sizeof(sample_log_writer_t));
+    writer->sync = sync;
+    
+    /* open the file */
+    writer->fd = open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (writer->fd < 0)
+    {
+        perror("sample_log: open failed.\n");
+        
+        return 1;
+    }
+    res = a_sample_log_writer_prepare(writer, path, calibration);
+    if (res != 0)
+    {
+        (void)close(writer->fd);
+        writer->fd = -1;
+        
+        return res;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     append a sample
+ * @param[in] *writer pointer to a sample log writer structure
+ * @param[in] *sample pointer to a sample
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ *            - 4 the timestamp goes backwards
+ * @note      only timestamp_us, ut, up and mode are stored, a full block is sealed and written at once
+ */
+uint8_t sample_log_writer_write(sample_log_writer_t *writer, const bmp180_sample_t *sample)
+{
+    uint8_t record[SAMPLE_LOG_RECORD_MAX];
+    uint8_t *block;
+    uint8_t len;
+    
+    /* check the param */
+    if ((writer == NULL) || (sample == NULL) || (writer->fd < 0) || (sample->mode > 3))
+    {
+        return 1;
+    }
+    if (sample->timestamp_us < writer->last_us)
+    {
+        return 4;
+    }
+    block = writer->block;
+    
+    /* delta against the previous record, the mode shares the timestamp varint */
+    if (writer->records != 0)
+    {
+        len = a_sample_log_put_varint(record, ((sample->timestamp_us - writer->last_us) << 2) | sample->mode);
+        len += a_sample_log_put_varint(&record[len], a_sample_log_zigzag((int64_t)sample->ut - writer->last_ut));
+        len += a_sample_log_put_varint(&record[len], a_sample_log_zigzag((int64_t)sample->up - writer->last_up));
+        
+        /* a full block is sealed and the record opens the next one */
+        if ((writer->len + len > SAMPLE_LOG_PAYLOAD_MAX) && (a_sample_log_seal(writer) != 0))
+        {
+            return 1;
+        }
+    }
+    
+    if (writer->records != 0)
+    {
+        memcpy(&block[SAMPLE_LOG_BLOCK_HEADER_SIZE + writer->len], record, len);
+        writer->len += len;
+        writer->records++;
+    }
+    else
+    {
+        /* the first record of a block is the base of the deltas */
+        writer->first_us = sample->timestamp_us;
+        a_sample_log_put_le(&block[32], sample->up, 4);
+        a_sample_log_put_le(&block[36], sample->ut, 2);
+        block[38] = sample->mode;
+        writer->records = 1;
+    }
+    writer->last_us = sample->timestamp_us;
+    writer->last_ut = sample->ut;
+    writer->last_up = sample->up;
+    writer->written++;
+    
+    return 0;
+}
+
+/**
+ * @brief     seal and write the open block
+ * @param[in] *writer pointer to a sample log writer structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      the records are durable after it, a partial block takes a whole block on disk,
+ *            so call it at the interval the data may be lost in a crash, not after every sample
+ */
+uint8_t sample_log_writer_flush(sample_log_writer_t *writer)
+{
+    /* check the param */
+    if ((writer == NULL) || (writer->fd < 0))
+    {
+        return 1;
+    }
+    if (writer->records == 0)
+    {
+        return 0;
+    }
+    if (a_sample_log_seal(writer) != 0)
+    {
+        return 1;
+    }
+    if ((writer->sync == 0) && (fdatasync(writer->fd) < 0))
+    {
+        perror("sample_log: fdatasync failed.\n");
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     close a sample log writer
+ * @param[in] *writer pointer to a sample log writer structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      the open block is sealed first
+ */
+uint8_t sample_log_writer_close(sample_log_writer_t *writer)
+{
+    uint8_t res;
+    
+    /* check the param */
+    if ((writer == NULL) || (writer->fd < 0))
+    {
+        return 1;
+    }
+    
+    /* flush and close */
+    res = sample_log_writer_flush(writer);
+    if (close(writer->fd) < 0)
+    {
+        res = 1;
+    }
+    writer->fd = -1;
+    
+    return res;
+}
+
+/**
+ * @brief     map a sample log for reading
+ * @param[in] *reader pointer to a sample log reader structure
+ * @param[in] *path pointer to a file path
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ *            - 4 the file is not a sample log
+ * @note      the file is mapped read only, a torn last block is not counted
+ */
+uint8_t sample_log_reader_open(sample_log_reader_t *reader, const char *path)
+{
+    struct stat st;
+    void *map;
+    int fd;
+    
+    /* check the param */
+    if ((reader == NULL) || (path == NULL))
+    {
+        return 1;
+    }
+    memset(reader, 0, sizeof(sample_log_reader_t));
+    
+    /* map the file, the mapping outlives the fd */
+    fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        perror("sample_log: open failed.\n");
+        
+        return 1;
+    }
+    if (fstat(fd, &st) < 0)
+    {
+        perror("sample_log: fstat failed.\n");
+        (void)close(fd);
+        
+        return 1;
+    }
+    if (st.st_size < SAMPLE_LOG_BLOCK_SIZE)
+    {
+        (void)fprintf(stderr, "sample_log: %s is not a sample log.\n", path);
+        (void)close(fd);
+        
+        return 4;
+    }
+    map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    (void)close(fd);
+    if (map == MAP_FAILED)
+    {
+        perror("sample_log: mmap failed.\n");
+        
+        return 1;
+    }
+    reader->map = (const uint8_t *)map;
+    reader->size = (size_t)st.st_size;
+    
+    /* check the header */
+    if (a_sample_log_check_header(reader->map) != 0)
+    {
+        (void)fprintf(stderr, "sample_log: %s is not a sample log.\n", path);
+        (void)sample_log_reader_close(reader);
+        
+        return 4;
+    }
+    memcpy(reader->calibration, &reader->map[14], BMP180_CALIBRATION_SIZE);
+    
+    /* a writer that crashed may have left a torn last block */
+    reader->blocks = (uint64_t)(reader->size / SAMPLE_LOG_BLOCK_SIZE) - 1;
+    if ((reader->blocks != 0) && 
+        (a_sample_log_check_block(&reader->map[reader->blocks * SAMPLE_LOG_BLOCK_SIZE]) != 0))
+    {
+        reader->blocks--;
+    }
+    if (reader->blocks != 0)
+    {
+        reader->first_us = a_sample_log_get_le(&reader->map[SAMPLE_LOG_BLOCK_SIZE + 16], 8);
+        reader->last_us = a_sample_log_get_le(&reader->map[reader->blocks * SAMPLE_LOG_BLOCK_SIZE + 24], 8);
+    }
+    
+    /* the handle only compensates, it never touches a bus */
+    DRIVER_BMP180_LINK_INIT(&reader->handle, bmp180_handle_t);
+    DRIVER_BMP180_LINK_IIC_INIT(&reader->handle, a_sample_log_iic_init);
+    DRIVER_BMP180_LINK_IIC_DEINIT(&reader->handle, a_sample_log_iic_deinit);
+    DRIVER_BMP180_LINK_IIC_READ(&reader->handle, a_sample_log_iic_transfer);
+    DRIVER_BMP180_LINK_IIC_WRITE(&reader->handle, a_sample_log_iic_transfer);
+    DRIVER_BMP180_LINK_DELAY_MS(&reader->handle, a_sample_log_delay_ms);
+    DRIVER_BMP180_LINK_DEBUG_PRINT(&reader->handle, a_sample_log_debug_print);
+    if (bmp180_init_with_calibration(&reader->handle, reader->calibration, 
+                                     BMP180_CALIBRATION_SIZE, BMP180_BOOL_FALSE) != 0)
+    {
+        (void)fprintf(stderr, "sample_log: calibration of %s is invalid.\n", path);
+        (void)sample_log_reader_close(reader);
+        
+        return 4;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     unmap a sample log
+ * @param[in] *reader pointer to a sample log reader structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      none
+ */
+uint8_t sample_log_reader_close(sample_log_reader_t *reader)
+{
+    uint8_t res;
+    
+    /* check the param */
+    if ((reader == NULL) || (reader->map == NULL))
+    {
+        return 1;
+    }
+    
+    /* unmap */
+    res = 0;
+    if (munmap((void *)reader->map, reader->size) < 0)
+    {
+        res = 1;
+    }
+    reader->map = NULL;
+    reader->size = 0;
+    reader->blocks = 0;
+    
+    return res;
+}
+
+/**
+ * @brief      find the first block that may hold a timestamp
+ * @param[in]  *reader pointer to a sample log reader structure
+ * @param[in]  timestamp_us timestamp to seek
+ * @param[out] *block pointer to a block index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 every record is older
+ * @note       the block headers are the index, the binary search touches log2(blocks) pages
+ */
+uint8_t sample_log_reader_seek(sample_log_reader_t *reader, uint64_t timestamp_us, uint64_t *block)
+{
+    uint64_t low;
+    uint64_t high;
+    uint64_t mid;
+    
+    /* check the param */
+    if ((reader == NULL) || (reader->map == NULL) || (block == NULL))
+    {
+        return 1;
+    }
+    
+    /* the first block whose last record is not older */
+    low = 0;
+    high = reader->blocks;
+    while (low < high)
+    {
+        mid = low + (high - low) / 2;
+        if (a_sample_log_get_le(&reader->map[(mid + 1) * SAMPLE_LOG_BLOCK_SIZE + 24], 8) < timestamp_us)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+    if (low == reader->blocks)
+    {
+        return 1;
+    }
+    *block = low;
+    
+    return 0;
+}
+
+/**
+ * @brief      decode the records of a block
+ * @param[in]  *reader pointer to a sample log reader structure
+ * @param[in]  block block index
+ * @param[out] *sample pointer to a sample buffer
+ * @param[in]  len sample buffer length, SAMPLE_LOG_BLOCK_RECORDS fits every block
+ * @param[out] *count pointer to a decoded record count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 block index is invalid or the buffer is too small
+ *             - 4 the block is corrupted
+ * @note       the sequence is the record index in the file, the temperature and the pressure
+ *             are compensated again with the calibration of the file header
+ */
+uint8_t sample_log_reader_decode(sample_log_reader_t *reader, uint64_t block, bmp180_sample_t *sample,
+                                 uint32_t len, uint32_t *count)
+{
+    const uint8_t *p;
+    const uint8_t *payload;
+    uint64_t index;
+    uint64_t value;
+    uint64_t timestamp_us;
+    uint32_t pos;
+    uint32_t size;
+    uint32_t up;
+    uint16_t records;
+    uint16_t ut;
+    uint16_t i;
+    uint8_t mode;
+    
+    /* check the param */
+    if ((reader == NULL) || (reader->map == NULL) || (sample == NULL) || (count == NULL) ||
+        (block >= reader->blocks))
+    {
+        return 1;
+    }
+    p = &reader->map[(block + 1) * SAMPLE_LOG_BLOCK_SIZE];
+    if (a_sample_log_check_block(p) != 0)
+    {
+        return 4;
+    }
+    records = (uint16_t)a_sample_log_get_le(&p[4], 2);
+    if (records > len)
+    {
+        return 1;
+    }
+    
+    /* the base record */
+    size = (uint32_t)a_sample_log_get_le(&p[6], 2);
+    payload = &p[SAMPLE_LOG_BLOCK_HEADER_SIZE];
+    index = a_sample_log_get_le(&p[8], 8);
+    timestamp_us = a_sample_log_get_le(&p[16], 8);
+    up = (uint32_t)a_sample_log_get_le(&p[32], 4);
+    ut = (uint16_t)a_sample_log_get_le(&p[36], 2);
+    mode = p[38];
+    pos = 0;
+    for (i = 0; i < records; i++)
+    {
+        /* the following records are deltas */
+        if (i != 0)
+        {
+            if (a_sample_log_get_varint(payload, size, &pos, &value) != 0)
+            {
+                return 4;
+            }
+            timestamp_us += value >> 2;
+            mode = (uint8_t)(value & 0x03);
+            if (a_sample_log_get_varint(payload, size, &pos, &value) != 0)
+            {
+                return 4;
+            }
+            ut = (uint16_t)((int64_t)ut + a_sample_log_unzigzag(value));
+            if (a_sample_log_get_varint(payload, size, &pos, &value) != 0)
+            {
+                return 4;
+            }
+            up = (uint32_t)((int64_t)up + a_sample_log_unzigzag(value));
+        }
+        
+        /* compensate with the calibration of the file */
+        memset(&sample[i], 0, sizeof(bmp180_sample_t));
+        sample[i].timestamp_us = timestamp_us;
+        sample[i].sequence = (uint32_t)(index + i);
+        sample[i].up = up;
+        sample[i].ut = ut;
+        sample[i].mode = mode;
+        if (bmp180_compensate(&reader->handle, (bmp180_mode_t)mode, ut, up, 
+                              &sample[i].temperature, &sample[i].pa) != 0)
+        {
+            return 4;
+        }
+    }
+    if (pos != size)
+    {
+        return 4;
+    }
+    *count = records;
+    
+    return 0;
+}
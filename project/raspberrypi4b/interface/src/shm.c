@@ -0,0 +1,354 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      shm.c
+ * @brief     shared memory sample source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "shm.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * @brief     get the segment size
+ * @param[in] slots slot count
+ * @return    segment size
+ * @note      none
+ */
+static size_t a_shm_size(uint32_t slots)
+{
+    return sizeof(shm_header_t) + (size_t)slots * sizeof(shm_slot_t);
+}
+
+/**
+ * @brief     shm publisher init
+ * @param[in] *publisher pointer to a shm publisher structure
+ * @param[in] *name pointer to a segment name, NULL means SHM_DEFAULT_NAME
+ * @param[in] slots slot count
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      an existing segment of the same name is unlinked and a new one is created with mode 0644,
+ *            readers that still map the old segment must reopen it
+ */
+uint8_t shm_publisher_init(shm_publisher_t *publisher, const char *name, uint32_t slots)
+{
+    void *addr;
+    
+    /* check the param */
+    if ((publisher == NULL) || (slots == 0) || (slots > 65536))
+    {
+        return 1;
+    }
+    memset(publisher, 0, sizeof(shm_publisher_t));
+    strncpy(publisher->name, (name != NULL) ? name : SHM_DEFAULT_NAME, sizeof(publisher->name) - 1);
+    publisher->size = a_shm_size(slots);
+    
+    /* a new segment never shrinks under a reader of the old one */
+    (void)shm_unlink(publisher->name);
+    publisher->fd = shm_open(publisher->name, O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+    if (publisher->fd < 0)
+    {
+        perror("shm: shm_open failed.\n");
+        
+        return 1;
+    }
+    if (ftruncate(publisher->fd, (off_t)publisher->size) != 0)
+    {
+        perror("shm: ftruncate failed.\n");
+        (void)close(publisher->fd);
+        (void)shm_unlink(publisher->name);
+        
+        return 1;
+    }
+    addr = mmap(NULL, publisher->size, PROT_READ | PROT_WRITE, MAP_SHARED, publisher->fd, 0);
+    if (addr == MAP_FAILED)
+    {
+        perror("shm: mmap failed.\n");
+        (void)close(publisher->fd);
+        (void)shm_unlink(publisher->name);
+        
+        return 1;
+    }
+    
+    /* the slots of a new segment are zero, the magic is stored last */
+    publisher->header = (shm_header_t *)addr;
+    publisher->slot = (shm_slot_t *)((uint8_t *)addr + sizeof(shm_header_t));
+    publisher->header->version = SHM_VERSION;
+    publisher->header->header_size = (uint32_t)sizeof(shm_header_t);
+    publisher->header->slot_size = (uint32_t)sizeof(shm_slot_t);
+    publisher->header->slots = slots;
+    publisher->header->pid = (uint32_t)getpid();
+    __atomic_store_n(&publisher->header->magic, SHM_MAGIC, __ATOMIC_RELEASE);
+    
+    return 0;
+}
+
+/**
+ * @brief     shm publisher deinit
+ * @param[in] *publisher pointer to a shm publisher structure
+ * @param[in] unlink unlink flag
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      readers keep their mapping after the name is unlinked
+ */
+uint8_t shm_publisher_deinit(shm_publisher_t *publisher, uint8_t unlink)
+{
+    uint8_t res;
+    
+    /* check the param */
+    if ((publisher == NULL) || (publisher->header == NULL))
+    {
+        return 1;
+    }
+    
+    res = 0;
+    if (munmap(publisher->header, publisher->size) != 0)
+    {
+        res = 1;
+    }
+    if (close(publisher->fd) != 0)
+    {
+        res = 1;
+    }
+    if ((unlink != 0) && (shm_unlink(publisher->name) != 0))
+    {
+        res = 1;
+    }
+    publisher->header = NULL;
+    publisher->slot = NULL;
+    
+    return res;
+}
+
+/**
+ * @brief     publish a sample
+ * @param[in] *publisher pointer to a shm publisher structure
+ * @param[in] *sample pointer to a sample
+ * @return    status code
+ *            - 0 success
+ *            - 1 sensor index is invalid
+ * @note      the sample replaces the last one of its sensor slot, there must be only one publisher thread,
+ *            it never blocks and makes no syscall
+ */
+uint8_t shm_publisher_write(shm_publisher_t *publisher, const bmp180_sample_t *sample)
+{
+    uint32_t word[SHM_SAMPLE_WORDS];
+    shm_slot_t *slot;
+    uint32_t sequence;
+    uint32_t i;
+    
+    /* check the param */
+    if ((publisher == NULL) || (publisher->header == NULL) || (sample == NULL) || 
+        (sample->sensor >= publisher->header->slots))
+    {
+        return 1;
+    }
+    slot = &publisher->slot[sample->sensor];
+    memset(word, 0, sizeof(word));
+    memcpy(word, sample, sizeof(bmp180_sample_t));
+    
+    /* an odd sequence tells the readers to retry, the release fence keeps the words after it */
+    sequence = __atomic_load_n(&slot->sequence, __ATOMIC_RELAXED);
+    __atomic_store_n(&slot->sequence, sequence + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    for (i = 0; i < SHM_SAMPLE_WORDS; i++)
+    {
+        __atomic_store_n(&slot->word[i], word[i], __ATOMIC_RELAXED);
+    }
+    
+    /* the even sequence publishes the words */
+    __atomic_store_n(&slot->sequence, sequence + 2, __ATOMIC_RELEASE);
+    __atomic_store_n(&publisher->header->publishes, publisher->header->publishes + 1, __ATOMIC_RELAXED);
+    
+    return 0;
+}
+
+/**
+ * @brief     shm reader init
+ * @param[in] *reader pointer to a shm reader structure
+ * @param[in] *name pointer to a segment name, NULL means SHM_DEFAULT_NAME
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ *            - 4 segment is invalid
+ * @note      the segment is mapped read only and the fd is closed
+ */
+uint8_t shm_reader_init(shm_reader_t *reader, const char *name)
+{
+    const shm_header_t *header;
+    struct stat st;
+    void *addr;
+    int fd;
+    
+    /* check the param */
+    if (reader == NULL)
+    {
+        return 1;
+    }
+    memset(reader, 0, sizeof(shm_reader_t));
+    
+    /* map the segment */
+    fd = shm_open((name != NULL) ? name : SHM_DEFAULT_NAME, O_RDONLY | O_CLOEXEC, 0);
+    if (fd < 0)
+    {
+        perror("shm: shm_open failed.\n");
+        
+        return 1;
+    }
+    if ((fstat(fd, &st) != 0) || ((size_t)st.st_size < sizeof(shm_header_t)))
+    {
+        (void)close(fd);
+        
+        return 4;
+    }
+    addr = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    (void)close(fd);
+    if (addr == MAP_FAILED)
+    {
+        perror("shm: mmap failed.\n");
+        
+        return 1;
+    }
+    
+    /* check the layout */
+    header = (const shm_header_t *)addr;
+    if ((__atomic_load_n(&header->magic, __ATOMIC_ACQUIRE) != SHM_MAGIC) || 
+        (header->version != SHM_VERSION) || 
+        (header->header_size != sizeof(shm_header_t)) || 
+        (header->slot_size != sizeof(shm_slot_t)) || 
+        (a_shm_size(header->slots) > (size_t)st.st_size))
+    {
+        (void)munmap(addr, (size_t)st.st_size);
+        
+        return 4;
+    }
+    reader->size = (size_t)st.st_size;
+    reader->header = header;
+    reader->slot = (const shm_slot_t *)((const uint8_t *)addr + sizeof(shm_header_t));
+    
+    return 0;
+}
+
+/**
+ * @brief     shm reader deinit
+ * @param[in] *reader pointer to a shm reader structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      none
+ */
+uint8_t shm_reader_deinit(shm_reader_t *reader)
+{
+    /* check the param */
+    if ((reader == NULL) || (reader->header == NULL))
+    {
+        return 1;
+    }
+    
+    if (munmap((void *)reader->header, reader->size) != 0)
+    {
+        return 1;
+    }
+    reader->header = NULL;
+    reader->slot = NULL;
+    
+    return 0;
+}
+
+/**
+ * @brief      read the latest sample of a sensor
+ * @param[in]  *reader pointer to a shm reader structure
+ * @param[in]  index sensor index
+ * @param[out] *sample pointer to a sample buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 sensor index is invalid
+ *             - 4 no sample has been published
+ *             - 5 the slot was written during every retry
+ * @note       it makes no syscall and takes no lock, a reader never delays the publisher
+ */
+uint8_t shm_reader_read(shm_reader_t *reader, uint32_t index, bmp180_sample_t *sample)
+{
+    uint32_t word[SHM_SAMPLE_WORDS];
+    const shm_slot_t *slot;
+    uint32_t first;
+    uint32_t second;
+    uint32_t retry;
+    uint32_t i;
+    
+    /* check the param */
+    if ((reader == NULL) || (reader->header == NULL) || (sample == NULL) || 
+        (index >= reader->header->slots))
+    {
+        return 1;
+    }
+    slot = &reader->slot[index];
+    
+    for (retry = 0; retry < SHM_READ_RETRIES; retry++)
+    {
+        /* an odd sequence is being written */
+        first = __atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE);
+        if (first == 0)
+        {
+            return 4;
+        }
+        if ((first & 1) != 0)
+        {
+            reader->retries++;
+            
+            continue;
+        }
+        for (i = 0; i < SHM_SAMPLE_WORDS; i++)
+        {
+            word[i] = __atomic_load_n(&slot->word[i], __ATOMIC_RELAXED);
+        }
+        
+        /* the acquire fence keeps the words before the second sequence load */
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        second = __atomic_load_n(&slot->sequence, __ATOMIC_RELAXED);
+        if (first == second)
+        {
+            memcpy(sample, word, sizeof(bmp180_sample_t));
+            
+            return 0;
+        }
+        reader->retries++;
+    }
+    
+    return 5;
+}
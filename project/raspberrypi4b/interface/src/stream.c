@@ -0,0 +1,300 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      stream.c
+ * @brief     sample stream source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "stream.h"
+#include <fcntl.h>
+#include <errno.h>
+#include <unistd.h>
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * @brief stream record definition
+ */
+#define STREAM_RECORD_MAX        256        /**< buffer room kept for one text record */
+
+/**
+ * @brief     write a buffer to the fd
+ * @param[in] *stream pointer to a stream structure
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len data length
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      short writes and interrupted calls are retried
+ */
+static uint8_t a_stream_write_all(stream_t *stream, const char *buf, uint32_t len)
+{
+    ssize_t res;
+    
+    while (len != 0)
+    {
+        res = write(stream->fd, buf, len);
+        if (res < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            perror("stream: write failed.\n");
+            
+            return 1;
+        }
+        stream->writes++;
+        stream->bytes += (uint64_t)res;
+        buf += res;
+        len -= (uint32_t)res;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      put a little endian value
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  value value to put
+ * @param[in]  bytes value size
+ * @note       the binary format doesn't depend on the host byte order
+ */
+static void a_stream_put_le(char *buf, uint64_t value, uint8_t bytes)
+{
+    uint8_t i;
+    
+    for (i = 0; i < bytes; i++)
+    {
+        buf[i] = (char)(value >> (8 * i));
+    }
+}
+
+/**
+ * @brief     stream init
+ * @param[in] *stream pointer to a stream structure
+ * @param[in] *path pointer to an output path, NULL or "-" means stdout
+ * @param[in] format output format
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      an existing file is truncated, the csv header line or the binary file header is written first
+ */
+uint8_t stream_init(stream_t *stream, const char *path, stream_format_t format)
+{
+    /* check the param */
+    if ((stream == NULL) || (format > STREAM_FORMAT_BINARY))
+    {
+        return 1;
+    }
+    memset(stream, 0, sizeof(stream_t));
+    stream->format = (uint8_t)format;
+    
+    /* open the output */
+    if ((path == NULL) || (strcmp(path, "-") == 0))
+    {
+        stream->fd = STDOUT_FILENO;
+        stream->owned = 0;
+    }
+    else
+    {
+        stream->fd = open(path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if (stream->fd < 0)
+        {
+            perror("stream: open failed.\n");
+            
+            return 1;
+        }
+        stream->owned = 1;
+    }
+    
+    /* buffer the header */
+    if (format == STREAM_FORMAT_CSV)
+    {
+        stream->len = (uint32_t)snprintf(stream->buf, STREAM_BUFFER_SIZE,
+                                         "timestamp_us,sequence,sensor,mode,ut,up,temperature_c,pressure_pa\n");
+    }
+    else if (format == STREAM_FORMAT_BINARY)
+    {
+        memcpy(stream->buf, STREAM_BINARY_MAGIC, 4);
+        a_stream_put_le(&stream->buf[4], STREAM_BINARY_VERSION, 2);
+        a_stream_put_le(&stream->buf[6], STREAM_BINARY_RECORD_SIZE, 2);
+        stream->len = STREAM_BINARY_HEADER_SIZE;
+    }
+    else
+    {
+        stream->len = 0;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     stream deinit
+ * @param[in] *stream pointer to a stream structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      the buffered records are flushed first
+ */
+uint8_t stream_deinit(stream_t *stream)
+{
+    uint8_t res;
+    
+    /* check the param */
+    if ((stream == NULL) || (stream->fd < 0))
+    {
+        return 1;
+    }
+    
+    /* flush and close */
+    res = stream_flush(stream);
+    if ((stream->owned != 0) && (close(stream->fd) < 0))
+    {
+        res = 1;
+    }
+    stream->fd = -1;
+    
+    return res;
+}
+
+/**
+ * @brief     append a sample to the stream
+ * @param[in] *stream pointer to a stream structure
+ * @param[in] *sample pointer to a sample
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      the record is formatted into the buffer, the buffer is written when it is full
+ *            or when the oldest record is STREAM_FLUSH_US old
+ */
+uint8_t stream_write(stream_t *stream, const bmp180_sample_t *sample)
+{
+    char *p;
+    uint32_t t;
+    int len;
+    
+    /* check the param */
+    if ((stream == NULL) || (sample == NULL) || (stream->fd < 0))
+    {
+        return 1;
+    }
+    
+    /* make room for one record */
+    if (STREAM_BUFFER_SIZE - stream->len < STREAM_RECORD_MAX)
+    {
+        if (stream_flush(stream) != 0)
+        {
+            return 1;
+        }
+    }
+    if ((stream->records == 0) || (stream->len == 0))
+    {
+        stream->first_us = sample->timestamp_us;
+    }
+    p = &stream->buf[stream->len];
+    
+    /* format the record, one call per record */
+    t = (uint32_t)((sample->temperature < 0) ? -sample->temperature : sample->temperature);
+    if (stream->format == STREAM_FORMAT_CSV)
+    {
+        len = snprintf(p, STREAM_RECORD_MAX, "%llu,%u,%u,%u,%u,%u,%s%u.%u,%u\n",
+                       (unsigned long long)sample->timestamp_us, (unsigned)sample->sequence, (unsigned)sample->sensor,
+                       (unsigned)sample->mode, (unsigned)sample->ut, (unsigned)sample->up, 
+                       (sample->temperature < 0) ? "-" : "", (unsigned)(t / 10), (unsigned)(t % 10),
+                       (unsigned)sample->pa);
+    }
+    else if (stream->format == STREAM_FORMAT_JSONL)
+    {
+        len = snprintf(p, STREAM_RECORD_MAX, "{\"timestamp_us\":%llu,\"sequence\":%u,\"sensor\":%u,\"mode\":%u,"
+                       "\"ut\":%u,\"up\":%u,\"temperature_c\":%s%u.%u,\"pressure_pa\":%u}\n",
+                       (unsigned long long)sample->timestamp_us, (unsigned)sample->sequence, (unsigned)sample->sensor,
+                       (unsigned)sample->mode, (unsigned)sample->ut, (unsigned)sample->up, 
+                       (sample->temperature < 0) ? "-" : "", (unsigned)(t / 10), (unsigned)(t % 10),
+                       (unsigned)sample->pa);
+    }
+    else
+    {
+        a_stream_put_le(&p[0], sample->timestamp_us, 8);
+        a_stream_put_le(&p[8], sample->sequence, 4);
+        a_stream_put_le(&p[12], sample->up, 4);
+        a_stream_put_le(&p[16], (uint32_t)sample->temperature, 4);
+        a_stream_put_le(&p[20], sample->pa, 4);
+        a_stream_put_le(&p[24], sample->ut, 2);
+        p[26] = (char)sample->mode;
+        p[27] = (char)sample->sensor;
+        len = STREAM_BINARY_RECORD_SIZE;
+    }
+    if ((len < 0) || (len >= STREAM_RECORD_MAX))
+    {
+        return 1;
+    }
+    stream->len += (uint32_t)len;
+    stream->records++;
+    
+    /* bound the age of the buffered records at low rates */
+    if (sample->timestamp_us - stream->first_us >= STREAM_FLUSH_US)
+    {
+        return stream_flush(stream);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     write the buffered records
+ * @param[in] *stream pointer to a stream structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 flush failed
+ * @note      none
+ */
+uint8_t stream_flush(stream_t *stream)
+{
+    uint32_t len;
+    
+    /* check the param */
+    if ((stream == NULL) || (stream->fd < 0))
+    {
+        return 1;
+    }
+    
+    /* write the buffer */
+    len = stream->len;
+    stream->len = 0;
+    if (len == 0)
+    {
+        return 0;
+    }
+    
+    return a_stream_write_all(stream, stream->buf, len);
+}
@@ -36,9 +36,1111 @@
 
 #include "driver_bmp180_read_test.h"
 #include "driver_bmp180_register_test.h"
+#include "driver_bmp180_simulator_test.h"
+#include "driver_bmp180_benchmark_test.h"
+#include "driver_bmp180_equivalence_test.h"
+#include "driver_bmp180_concurrency_test.h"
 #include "driver_bmp180_basic.h"
+#include "driver_bmp180_shared.h"
+#include "driver_bmp180_ring.h"
+#include "gpio.h"
+#include "iic_bus.h"
+#include "periodic.h"
+#include "reactor.h"
+#include "rt.h"
+#include "sensor_ctx.h"
+#include "shm.h"
+#include "stream.h"
+#include "sample_log.h"
 #include <getopt.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <stdarg.h>
 #include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+/**
+ * @brief reactor example max sensors definition
+ */
+#define REACTOR_EXAMPLE_MAX_SENSORS 8        /**< max buses of the reactor example */
+
+/**
+ * @brief shared example threads definition
+ */
+#define SHARED_EXAMPLE_THREADS 4        /**< threads reading one sensor */
+
+/**
+ * @brief read example ring capacity definition
+ */
+#define READ_EXAMPLE_RING_CAPACITY 256        /**< samples between the read loop and the output thread */
+
+/**
+ * @brief  get the monotonic time
+ * @return monotonic time in ns
+ * @note   none
+ */
+static uint64_t a_timestamp_ns(void)
+{
+    struct timespec ts;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief  get the monotonic time in us
+ * @return monotonic time in us
+ * @note   none
+ */
+static uint64_t a_timestamp_us(void)
+{
+    return a_timestamp_ns() / 1000;
+}
+
+/**
+ * @brief  get the process cpu time
+ * @return user and system time of the process in ns
+ * @note   none
+ */
+static uint64_t a_cputime_ns(void)
+{
+    struct timespec ts;
+    
+    (void)clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief     skip the conversion delay
+ * @param[in] time unused delay time
+ * @note      the iic benchmark measures the bus cost only
+ */
+static void a_delay_none(uint32_t time)
+{
+    (void)time;
+}
+
+/**
+ * @brief     iic backend benchmark
+ * @param[in] index bus index of /dev/i2c-N
+ * @param[in] times samples of every backend
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      it also runs against the i2c-stub module: modprobe i2c-stub chip_addr=0x77,
+ *            an empty stub is loaded with the chip id and the datasheet calibration,
+ *            the stub only implements smbus, so the rdwr backend is reported as unsupported there
+ */
+static uint8_t a_iic_benchmark(uint32_t index, uint32_t times)
+{
+    const uint8_t calibration[22] = {0x01, 0x98, 0xFF, 0xB8, 0xC7, 0xD1, 0x7F, 0xE5, 0x7F, 0xF5, 0x5A,
+                                     0x71, 0x18, 0x2E, 0x00, 0x04, 0x80, 0x00, 0xDD, 0xF9, 0x0B, 0x34};
+    const uint8_t out[3] = {0x6C, 0xFA, 0x00};
+    const char *const name[2] = {"rdwr", "smbus"};
+    static bmp180_handle_t handle;
+    iic_bus_t bus;
+    sensor_ctx_t ctx = {&bus, NULL};
+    uint8_t id = 0;
+    uint8_t chip_id = 0x55;
+    uint32_t backend;
+    uint32_t i;
+    
+    /* load an empty i2c-stub at 0xEE, a real sensor answers 0x55 and is never written */
+    if ((iic_bus_init(&bus, index) != 0) || (iic_bus_set_backend(&bus, IIC_BUS_BACKEND_SMBUS) != 0))
+    {
+        return 1;
+    }
+    if (iic_bus_open(&bus) != 0)
+    {
+        (void)iic_bus_deinit(&bus);
+        
+        return 1;
+    }
+    if ((iic_bus_read(&bus, 0xEE, 0xD0, &id, 1) == 0) && (id == 0x00))
+    {
+        bmp180_interface_debug_print("bmp180: empty i2c-stub found, load the datasheet calibration.\n");
+        (void)iic_bus_write(&bus, 0xEE, 0xD0, &chip_id, 1);
+        (void)iic_bus_write(&bus, 0xEE, 0xAA, (uint8_t *)calibration, 22);
+        (void)iic_bus_write(&bus, 0xEE, 0xF6, (uint8_t *)out, 3);
+    }
+    (void)iic_bus_close(&bus);
+    (void)iic_bus_deinit(&bus);
+    
+    for (backend = 0; backend < 2; backend++)
+    {
+        uint8_t res;
+        uint16_t temperature_raw;
+        int32_t temperature;
+        uint32_t pressure_raw;
+        uint32_t pa;
+        uint32_t read_count;
+        uint32_t write_count;
+        uint64_t start_ns;
+        uint64_t start_cpu;
+        uint64_t ns;
+        uint64_t cpu;
+        
+        /* link the ctx functions without conversion delays */
+        (void)iic_bus_init(&bus, index);
+        (void)iic_bus_set_backend(&bus, (iic_bus_backend_t)backend);
+        DRIVER_BMP180_LINK_INIT(&handle, bmp180_handle_t);
+        DRIVER_BMP180_LINK_IIC_INIT_CTX(&handle, bmp180_interface_iic_init_ctx);
+        DRIVER_BMP180_LINK_IIC_DEINIT_CTX(&handle, bmp180_interface_iic_deinit_ctx);
+        DRIVER_BMP180_LINK_IIC_READ_CTX(&handle, bmp180_interface_iic_read_ctx);
+        DRIVER_BMP180_LINK_IIC_WRITE_CTX(&handle, bmp180_interface_iic_write_ctx);
+        DRIVER_BMP180_LINK_USER(&handle, &ctx);
+        DRIVER_BMP180_LINK_DELAY_MS(&handle, a_delay_none);
+        DRIVER_BMP180_LINK_DELAY_US(&handle, a_delay_none);
+        DRIVER_BMP180_LINK_DEBUG_PRINT(&handle, bmp180_interface_debug_print);
+        if (bmp180_init(&handle) != 0)
+        {
+            bmp180_interface_debug_print("bmp180: %s backend is not supported by %s.\n", name[backend], bus.name);
+            (void)iic_bus_deinit(&bus);
+            
+            continue;
+        }
+        
+        /* the timed mode doesn't poll the status, so the stub works as well */
+        (void)bmp180_set_wait_mode(&handle, BMP180_WAIT_MODE_TIMED);
+        (void)bmp180_set_mode(&handle, BMP180_MODE_ULTRA_LOW);
+        (void)bmp180_clear_iic_count(&handle);
+        res = 0;
+        start_ns = a_timestamp_ns();
+        start_cpu = a_cputime_ns();
+        for (i = 0; i < times; i++)
+        {
+            res = bmp180_read_temperature_pressure_fixed(&handle, &temperature_raw, &temperature, &pressure_raw, &pa);
+            if (res != 0)
+            {
+                break;
+            }
+        }
+        cpu = a_cputime_ns() - start_cpu;
+        ns = a_timestamp_ns() - start_ns;
+        (void)bmp180_get_iic_count(&handle, &read_count, &write_count);
+        (void)bmp180_deinit(&handle);
+        (void)iic_bus_deinit(&bus);
+        if (res != 0)
+        {
+            bmp180_interface_debug_print("bmp180: %s backend read failed.\n", name[backend]);
+            
+            return 1;
+        }
+        
+        /* output the result */
+        bmp180_interface_debug_print("bmp180: %s backend %d samples, %.1f ioctls per sample.\n", name[backend], times, 
+                                     (double)(read_count + write_count) / (double)times);
+        bmp180_interface_debug_print("bmp180: %s backend %.1fus latency per sample, %.1fus cpu time per sample.\n", name[backend],
+                                     (double)ns / (double)times / 1000.0, (double)cpu / (double)times / 1000.0);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief reactor example context structure definition
+ */
+typedef struct reactor_example_s
+{
+    reactor_t *reactor;              /**< running reactor */
+    shm_publisher_t *publisher;      /**< optional shared memory publisher */
+    uint32_t samples;                /**< received samples */
+    uint32_t total;                  /**< samples to receive */
+} reactor_example_t;
+
+/**
+ * @brief     reactor example sample callback
+ * @param[in] *arg pointer to a reactor example context
+ * @param[in] *sample pointer to a finished sample
+ * @note      it runs on the reactor thread, so it must not block
+ */
+static void a_reactor_callback(void *arg, const bmp180_sample_t *sample)
+{
+    reactor_example_t *example = (reactor_example_t *)arg;
+    
+    /* publish the latest sample to the other processes */
+    if (example->publisher != NULL)
+    {
+        (void)shm_publisher_write(example->publisher, sample);
+    }
+    
+    /* output */
+    bmp180_interface_debug_print("bmp180: sensor %d sequence %d temperature is %0.1fC pressure is %dPa.\n",
+                                 sample->sensor, sample->sequence, (float)sample->temperature / 10.0f, sample->pa);
+    
+    /* stop after the last sample */
+    example->samples++;
+    if (example->samples >= example->total)
+    {
+        (void)reactor_stop(example->reactor);
+    }
+}
+
+/**
+ * @brief     reactor example
+ * @param[in] *index pointer to a bus index buffer of /dev/i2c-N
+ * @param[in] count bus count
+ * @param[in] times samples of every sensor
+ * @param[in] rate sample rate of every sensor in hz
+ * @param[in] eoc eoc flag of the first sensor
+ * @param[in] *shm pointer to a shared memory segment name, NULL means no publisher
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      one sensor per bus, all of them run on this thread,
+ *            the eoc pin is only wired to the first sensor
+ */
+static uint8_t a_reactor_example(uint32_t *index, uint8_t count, uint32_t times, double rate, uint8_t eoc, const char *shm)
+{
+    static bmp180_handle_t handle[REACTOR_EXAMPLE_MAX_SENSORS];
+    static iic_bus_t bus[REACTOR_EXAMPLE_MAX_SENSORS];
+    static sensor_ctx_t ctx[REACTOR_EXAMPLE_MAX_SENSORS];
+    bmp180_scheduler_sensor_t slot[REACTOR_EXAMPLE_MAX_SENSORS];
+    reactor_sensor_t sensor[REACTOR_EXAMPLE_MAX_SENSORS];
+    reactor_example_t example;
+    shm_publisher_t publisher;
+    gpio_eoc_line_t line;
+    reactor_t reactor;
+    uint64_t samples;
+    uint64_t overruns;
+    uint32_t errors;
+    uint8_t res;
+    uint8_t id;
+    uint8_t i;
+    uint8_t n;
+    
+    /* eoc init */
+    if ((eoc != 0) && (gpio_eoc_line_init(&line, GPIO_DEVICE_NAME, GPIO_DEVICE_LINE) != 0))
+    {
+        return 1;
+    }
+    
+    /* publisher init */
+    example.publisher = NULL;
+    if (shm != NULL)
+    {
+        if (shm_publisher_init(&publisher, shm, REACTOR_EXAMPLE_MAX_SENSORS) != 0)
+        {
+            if (eoc != 0)
+            {
+                (void)gpio_eoc_line_deinit(&line);
+            }
+            
+            return 1;
+        }
+        example.publisher = &publisher;
+        bmp180_interface_debug_print("bmp180: publish the samples to %s.\n", publisher.name);
+    }
+    
+    /* reactor init */
+    example.reactor = &reactor;
+    example.samples = 0;
+    example.total = times * count;
+    if (reactor_init(&reactor, sensor, slot, REACTOR_EXAMPLE_MAX_SENSORS, a_reactor_callback, &example) != 0)
+    {
+        if (example.publisher != NULL)
+        {
+            (void)shm_publisher_deinit(&publisher, 1);
+        }
+        if (eoc != 0)
+        {
+            (void)gpio_eoc_line_deinit(&line);
+        }
+        
+        return 1;
+    }
+    
+    /* one handle per bus */
+    res = 0;
+    for (n = 0; n < count; n++)
+    {
+        (void)iic_bus_init(&bus[n], index[n]);
+        ctx[n].bus = &bus[n];
+        ctx[n].eoc = NULL;
+        DRIVER_BMP180_LINK_INIT(&handle[n], bmp180_handle_t);
+        DRIVER_BMP180_LINK_IIC_INIT_CTX(&handle[n], bmp180_interface_iic_init_ctx);
+        DRIVER_BMP180_LINK_IIC_DEINIT_CTX(&handle[n], bmp180_interface_iic_deinit_ctx);
+        DRIVER_BMP180_LINK_IIC_READ_CTX(&handle[n], bmp180_interface_iic_read_ctx);
+        DRIVER_BMP180_LINK_IIC_WRITE_CTX(&handle[n], bmp180_interface_iic_write_ctx);
+        DRIVER_BMP180_LINK_USER(&handle[n], &ctx[n]);
+        DRIVER_BMP180_LINK_DELAY_MS(&handle[n], bmp180_interface_delay_ms);
+        DRIVER_BMP180_LINK_DELAY_US(&handle[n], bmp180_interface_delay_us);
+        DRIVER_BMP180_LINK_DEBUG_PRINT(&handle[n], bmp180_interface_debug_print);
+        if (bmp180_init(&handle[n]) != 0)
+        {
+            (void)iic_bus_deinit(&bus[n]);
+            res = 1;
+            
+            break;
+        }
+        if (reactor_add(&reactor, &handle[n], ((eoc != 0) && (n == 0)) ? &line : NULL,
+                        (uint64_t)(1000000000.0 / rate), &id) != 0)
+        {
+            (void)bmp180_deinit(&handle[n]);
+            (void)iic_bus_deinit(&bus[n]);
+            res = 1;
+            
+            break;
+        }
+        bmp180_interface_debug_print("bmp180: sensor %d is on %s.\n", id, bus[n].name);
+    }
+    
+    /* run until every sensor has its samples */
+    if (res == 0)
+    {
+        res = reactor_run(&reactor);
+        for (i = 0; i < count; i++)
+        {
+            (void)reactor_get_sensor_stats(&reactor, i, &samples, &overruns, &errors);
+            bmp180_interface_debug_print("bmp180: sensor %d %d samples, %d overruns, %d errors.\n",
+                                         i, (uint32_t)samples, (uint32_t)overruns, errors);
+        }
+        bmp180_interface_debug_print("bmp180: %d samples in %d wakes on one thread.\n",
+                                     (uint32_t)reactor.samples, (uint32_t)reactor.wakes);
+    }
+    
+    /* deinit */
+    (void)reactor_deinit(&reactor);
+    for (i = 0; i < n; i++)
+    {
+        (void)bmp180_deinit(&handle[i]);
+        (void)iic_bus_deinit(&bus[i]);
+    }
+    if (example.publisher != NULL)
+    {
+        (void)shm_publisher_deinit(&publisher, 1);
+    }
+    if (eoc != 0)
+    {
+        (void)gpio_eoc_line_deinit(&line);
+    }
+    
+    return res;
+}
+
+/**
+ * @brief     shared memory reader example
+ * @param[in] *shm pointer to a shared memory segment name
+ * @param[in] times read times
+ * @param[in] rate read rate in hz
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      it never touches the bus, any number of them can run beside one publisher
+ */
+static uint8_t a_shm_example(const char *shm, uint32_t times, double rate)
+{
+    shm_reader_t reader;
+    bmp180_sample_t sample;
+    uint64_t now_us;
+    uint32_t i;
+    uint32_t j;
+    uint8_t res;
+    
+    /* reader init */
+    if (shm_reader_init(&reader, shm) != 0)
+    {
+        bmp180_interface_debug_print("bmp180: no publisher on %s.\n", shm);
+        
+        return 1;
+    }
+    
+    for (i = 0; i < times; i++)
+    {
+        /* the latest sample of every sensor */
+        for (j = 0; j < reader.header->slots; j++)
+        {
+            res = shm_reader_read(&reader, j, &sample);
+            if (res == 0)
+            {
+                now_us = a_timestamp_ns() / 1000;
+                bmp180_interface_debug_print("bmp180: sensor %d sequence %d age %dms temperature is %0.1fC pressure is %dPa.\n",
+                                             sample.sensor, sample.sequence, (uint32_t)((now_us - sample.timestamp_us) / 1000), 
+                                             (float)sample.temperature / 10.0f, sample.pa);
+            }
+            else if (res == 5)
+            {
+                bmp180_interface_debug_print("bmp180: sensor %d is busy.\n", j);
+            }
+            else
+            {
+                /* no sample yet */
+            }
+        }
+        
+        /* wait the next read */
+        if (i + 1 < times)
+        {
+            (void)usleep((useconds_t)(1000000.0 / rate));
+        }
+    }
+    bmp180_interface_debug_print("bmp180: %d publishes, %d retries.\n", 
+                                 (uint32_t)reader.header->publishes, reader.retries);
+    
+    /* deinit */
+    (void)shm_reader_deinit(&reader);
+    
+    return 0;
+}
+
+/**
+ * @brief shared example worker structure definition
+ */
+typedef struct shared_example_worker_s
+{
+    bmp180_shared_t *shared;         /**< shared handle */
+    uint32_t times;                  /**< reads of this thread */
+    uint32_t max_age_us;             /**< max age of a cached sample */
+    uint32_t errors;                 /**< failed reads */
+} shared_example_worker_t;
+
+/**
+ * @brief     shared example worker thread
+ * @param[in] *arg pointer to a shared example worker
+ * @return    NULL
+ * @note      every thread reads as fast as it can, the shared handle serializes the bus
+ */
+static void *a_shared_worker(void *arg)
+{
+    shared_example_worker_t *worker = (shared_example_worker_t *)arg;
+    bmp180_sample_t sample;
+    uint32_t i;
+    
+    for (i = 0; i < worker->times; i++)
+    {
+        if (bmp180_shared_read(worker->shared, worker->max_age_us, &sample) != 0)
+        {
+            worker->errors++;
+        }
+    }
+    
+    return NULL;
+}
+
+/**
+ * @brief     shared handle example
+ * @param[in] index bus index of /dev/i2c-N
+ * @param[in] times reads of every thread
+ * @param[in] max_age_ms max age of a cached sample in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      SHARED_EXAMPLE_THREADS threads read one sensor at the same time
+ */
+static uint8_t a_shared_example(uint32_t index, uint32_t times, uint32_t max_age_ms)
+{
+    static bmp180_handle_t handle;
+    static iic_bus_t bus;
+    static sensor_ctx_t ctx = {&bus, NULL};
+    bmp180_shared_t shared;
+    shared_example_worker_t worker[SHARED_EXAMPLE_THREADS];
+    pthread_t thread[SHARED_EXAMPLE_THREADS];
+    uint32_t conversions;
+    uint32_t joined;
+    uint32_t hits;
+    uint32_t errors;
+    uint64_t start;
+    uint8_t started;
+    uint8_t i;
+    
+    /* link the ctx functions */
+    (void)iic_bus_init(&bus, index);
+    DRIVER_BMP180_LINK_INIT(&handle, bmp180_handle_t);
+    DRIVER_BMP180_LINK_IIC_INIT_CTX(&handle, bmp180_interface_iic_init_ctx);
+    DRIVER_BMP180_LINK_IIC_DEINIT_CTX(&handle, bmp180_interface_iic_deinit_ctx);
+    DRIVER_BMP180_LINK_IIC_READ_CTX(&handle, bmp180_interface_iic_read_ctx);
+    DRIVER_BMP180_LINK_IIC_WRITE_CTX(&handle, bmp180_interface_iic_write_ctx);
+    DRIVER_BMP180_LINK_USER(&handle, &ctx);
+    DRIVER_BMP180_LINK_DELAY_MS(&handle, bmp180_interface_delay_ms);
+    DRIVER_BMP180_LINK_DELAY_US(&handle, bmp180_interface_delay_us);
+    DRIVER_BMP180_LINK_DEBUG_PRINT(&handle, bmp180_interface_debug_print);
+    if (bmp180_init(&handle) != 0)
+    {
+        (void)iic_bus_deinit(&bus);
+        
+        return 1;
+    }
+    if (bmp180_shared_init(&shared, &handle, a_timestamp_us, bmp180_interface_delay_us) != 0)
+    {
+        (void)bmp180_deinit(&handle);
+        (void)iic_bus_deinit(&bus);
+        
+        return 1;
+    }
+    
+    /* read from all threads at once */
+    start = a_timestamp_ns();
+    for (started = 0; started < SHARED_EXAMPLE_THREADS; started++)
+    {
+        worker[started].shared = &shared;
+        worker[started].times = times;
+        worker[started].max_age_us = max_age_ms * 1000;
+        worker[started].errors = 0;
+        if (pthread_create(&thread[started], NULL, a_shared_worker, &worker[started]) != 0)
+        {
+            break;
+        }
+    }
+    errors = 0;
+    for (i = 0; i < started; i++)
+    {
+        (void)pthread_join(thread[i], NULL);
+        errors += worker[i].errors;
+    }
+    
+    /* every read is a conversion, a joined conversion or a cached sample */
+    (void)bmp180_shared_get_counter(&shared, &conversions, &joined, &hits);
+    bmp180_interface_debug_print("bmp180: %d threads %d reads, %d conversions, %d joined, %d cached, %d errors in %dms.\n",
+                                 started, started * times, conversions, joined, hits, errors, 
+                                 (uint32_t)((a_timestamp_ns() - start) / 1000000));
+    
+    /* deinit */
+    (void)bmp180_deinit(&handle);
+    (void)iic_bus_deinit(&bus);
+    
+    return (started == SHARED_EXAMPLE_THREADS) ? 0 : 1;
+}
+
+/**
+ * @brief stream example config structure definition
+ */
+typedef struct stream_example_config_s
+{
+    const char *path;                /**< output path, "-" means stdout */
+    stream_format_t format;          /**< output format */
+    uint8_t log;                     /**< sample log output flag, format is ignored */
+    bmp180_mode_t mode;              /**< oversampling mode */
+    uint16_t refresh;                /**< pressure samples per temperature, 0 means every sample */
+    uint32_t bus;                    /**< bus index of /dev/i2c-N */
+    uint32_t times;                  /**< samples to write */
+    double duration;                 /**< stream duration in s, 0 means times */
+    double rate;                     /**< sample rate in hz */
+    uint8_t eoc;                     /**< eoc flag */
+} stream_example_config_t;
+
+/**
+ * @brief stream example context structure definition
+ */
+typedef struct stream_example_s
+{
+    reactor_t *reactor;              /**< running reactor */
+    stream_t *stream;                /**< output stream or NULL */
+    sample_log_writer_t *log;        /**< output sample log or NULL */
+    uint64_t offset_us;              /**< realtime minus monotonic of the sample log */
+    uint64_t start_us;               /**< timestamp of the first sample */
+    uint64_t duration_us;            /**< stream duration, 0 means total samples */
+    uint32_t samples;                /**< written samples */
+    uint32_t total;                  /**< samples to write */
+    uint8_t failed;                  /**< output failed flag */
+} stream_example_t;
+
+/**
+ * @brief     print to stderr
+ * @param[in] *fmt pointer to a format buffer
+ * @note      stdout carries the samples while streaming
+ */
+static void a_stderr_print(const char *const fmt, ...)
+{
+    va_list args;
+    
+    va_start(args, fmt);
+    (void)vfprintf(stderr, fmt, args);
+    va_end(args);
+}
+
+/**
+ * @brief     stream example sample callback
+ * @param[in] *arg pointer to a stream example context
+ * @param[in] *sample pointer to a finished sample
+ * @note      none
+ */
+static void a_stream_callback(void *arg, const bmp180_sample_t *sample)
+{
+    stream_example_t *example = (stream_example_t *)arg;
+    bmp180_sample_t s;
+    
+    /* stop on the duration */
+    if (example->samples == 0)
+    {
+        example->start_us = sample->timestamp_us;
+    }
+    if ((example->duration_us != 0) && (sample->timestamp_us - example->start_us >= example->duration_us))
+    {
+        (void)reactor_stop(example->reactor);
+        
+        return;
+    }
+    
+    /* append the sample, the sample log keeps the wall clock time */
+    if (example->log != NULL)
+    {
+        s = *sample;
+        s.timestamp_us += example->offset_us;
+        if (sample_log_writer_write(example->log, &s) != 0)
+        {
+            example->failed = 1;
+            (void)reactor_stop(example->reactor);
+            
+            return;
+        }
+    }
+    else if (stream_write(example->stream, sample) != 0)
+    {
+        example->failed = 1;
+        (void)reactor_stop(example->reactor);
+        
+        return;
+    }
+    
+    /* stop on the count */
+    example->samples++;
+    if ((example->duration_us == 0) && (example->samples >= example->total))
+    {
+        (void)reactor_stop(example->reactor);
+    }
+}
+
+/**
+ * @brief     close the output of the stream example
+ * @param[in] *example pointer to a stream example context
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      none
+ */
+static uint8_t a_stream_output_deinit(stream_example_t *example)
+{
+    uint8_t res;
+    
+    res = 0;
+    if ((example->stream != NULL) && (stream_deinit(example->stream) != 0))
+    {
+        res = 1;
+    }
+    if ((example->log != NULL) && (sample_log_writer_close(example->log) != 0))
+    {
+        res = 1;
+    }
+    
+    return res;
+}
+
+/**
+ * @brief     stream example
+ * @param[in] *config pointer to a stream example config
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      the samples go to stdout or a file, the messages go to stderr
+ */
+static uint8_t a_stream_example(const stream_example_config_t *config)
+{
+    static bmp180_handle_t handle;
+    static iic_bus_t bus;
+    static sensor_ctx_t ctx = {&bus, NULL};
+    static stream_t stream;
+    static sample_log_writer_t writer;
+    uint8_t calibration[BMP180_CALIBRATION_SIZE];
+    struct timespec realtime;
+    bmp180_scheduler_sensor_t slot;
+    reactor_sensor_t sensor;
+    stream_example_t example;
+    gpio_eoc_line_t line;
+    reactor_t reactor;
+    uint64_t samples = 0;
+    uint64_t overruns = 0;
+    uint32_t errors = 0;
+    uint8_t res;
+    uint8_t id;
+    
+    /* open the output, the sample log is opened with the calibration */
+    example.stream = NULL;
+    example.log = NULL;
+    if (config->log == 0)
+    {
+        if (stream_init(&stream, config->path, config->format) != 0)
+        {
+            return 1;
+        }
+        example.stream = &stream;
+    }
+    
+    /* eoc init */
+    if ((config->eoc != 0) && (gpio_eoc_line_init(&line, GPIO_DEVICE_NAME, GPIO_DEVICE_LINE) != 0))
+    {
+        (void)a_stream_output_deinit(&example);
+        
+        return 1;
+    }
+    
+    /* link the ctx functions, the driver messages go to stderr as well */
+    (void)iic_bus_init(&bus, config->bus);
+    DRIVER_BMP180_LINK_INIT(&handle, bmp180_handle_t);
+    DRIVER_BMP180_LINK_IIC_INIT_CTX(&handle, bmp180_interface_iic_init_ctx);
+    DRIVER_BMP180_LINK_IIC_DEINIT_CTX(&handle, bmp180_interface_iic_deinit_ctx);
+    DRIVER_BMP180_LINK_IIC_READ_CTX(&handle, bmp180_interface_iic_read_ctx);
+    DRIVER_BMP180_LINK_IIC_WRITE_CTX(&handle, bmp180_interface_iic_write_ctx);
+    DRIVER_BMP180_LINK_USER(&handle, &ctx);
+    DRIVER_BMP180_LINK_DELAY_MS(&handle, bmp180_interface_delay_ms);
+    DRIVER_BMP180_LINK_DELAY_US(&handle, bmp180_interface_delay_us);
+    DRIVER_BMP180_LINK_DEBUG_PRINT(&handle, a_stderr_print);
+    if (bmp180_init(&handle) != 0)
+    {
+        (void)iic_bus_deinit(&bus);
+        if (config->eoc != 0)
+        {
+            (void)gpio_eoc_line_deinit(&line);
+        }
+        (void)a_stream_output_deinit(&example);
+        
+        return 1;
+    }
+    
+    /* set the mode and the temperature refresh */
+    if ((bmp180_set_mode(&handle, config->mode) != 0) ||
+        (bmp180_set_temperature_reuse(&handle, config->refresh, 0) != 0))
+    {
+        (void)bmp180_deinit(&handle);
+        (void)iic_bus_deinit(&bus);
+        if (config->eoc != 0)
+        {
+            (void)gpio_eoc_line_deinit(&line);
+        }
+        (void)a_stream_output_deinit(&example);
+        
+        return 1;
+    }
+    
+    /* open the sample log */
+    if (config->log != 0)
+    {
+        if ((bmp180_export_calibration(&handle, calibration, BMP180_CALIBRATION_SIZE) != 0) ||
+            (sample_log_writer_open(&writer, config->path, calibration, 0) != 0))
+        {
+            (void)bmp180_deinit(&handle);
+            (void)iic_bus_deinit(&bus);
+            if (config->eoc != 0)
+            {
+                (void)gpio_eoc_line_deinit(&line);
+            }
+            
+            return 1;
+        }
+        example.log = &writer;
+    }
+    (void)clock_gettime(CLOCK_REALTIME, &realtime);
+    example.offset_us = (uint64_t)realtime.tv_sec * 1000000 + (uint64_t)realtime.tv_nsec / 1000 - a_timestamp_us();
+    
+    /* run the sensor on the period grid */
+    example.reactor = &reactor;
+    example.start_us = 0;
+    example.duration_us = (uint64_t)(config->duration * 1000000.0);
+    example.samples = 0;
+    example.total = config->times;
+    example.failed = 0;
+    res = 1;
+    if (reactor_init(&reactor, &sensor, &slot, 1, a_stream_callback, &example) == 0)
+    {
+        if (reactor_add(&reactor, &handle, (config->eoc != 0) ? &line : NULL, 
+                        (uint64_t)(1000000000.0 / config->rate), &id) == 0)
+        {
+            res = reactor_run(&reactor);
+            (void)reactor_get_sensor_stats(&reactor, id, &samples, &overruns, &errors);
+        }
+        (void)reactor_deinit(&reactor);
+    }
+    
+    /* deinit */
+    if (a_stream_output_deinit(&example) != 0)
+    {
+        res = 1;
+    }
+    if (config->log != 0)
+    {
+        a_stderr_print("bmp180: %d samples, %d overruns, %d errors, %d blocks sealed, %d blocks in the log.\n",
+                       example.samples, (uint32_t)overruns, errors, (uint32_t)writer.sealed, (uint32_t)writer.blocks);
+    }
+    else
+    {
+        a_stderr_print("bmp180: %d samples, %d overruns, %d errors, %d bytes in %d writes.\n",
+                       example.samples, (uint32_t)overruns, errors, (uint32_t)stream.bytes, (uint32_t)stream.writes);
+    }
+    (void)bmp180_deinit(&handle);
+    (void)iic_bus_deinit(&bus);
+    if (config->eoc != 0)
+    {
+        (void)gpio_eoc_line_deinit(&line);
+    }
+    
+    return ((res != 0) || (example.failed != 0)) ? 1 : 0;
+}
+
+/**
+ * @brief     replay example
+ * @param[in] *input pointer to a sample log path
+ * @param[in] from start in s after the first record
+ * @param[in] to end in s after the first record, 0 means the last record
+ * @param[in] *output pointer to an output path, "-" means stdout
+ * @param[in] format output format
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      the blocks before the start are skipped by the block index, a corrupted block is reported and skipped
+ */
+static uint8_t a_replay_example(const char *input, double from, double to, const char *output, stream_format_t format)
+{
+    static sample_log_reader_t reader;
+    static stream_t stream;
+    static bmp180_sample_t sample[SAMPLE_LOG_BLOCK_RECORDS];
+    uint64_t start_us;
+    uint64_t end_us;
+    uint64_t block;
+    uint64_t first;
+    uint32_t samples;
+    uint32_t count;
+    uint32_t i;
+    uint8_t res;
+    
+    /* map the log and open the output */
+    if (sample_log_reader_open(&reader, input) != 0)
+    {
+        return 1;
+    }
+    if (stream_init(&stream, output, format) != 0)
+    {
+        (void)sample_log_reader_close(&reader);
+        
+        return 1;
+    }
+    start_us = reader.first_us + (uint64_t)(from * 1000000.0);
+    end_us = (to > 0.0) ? reader.first_us + (uint64_t)(to * 1000000.0) : reader.last_us;
+    
+    /* seek the first block and decode until the end */
+    res = 0;
+    samples = 0;
+    first = reader.blocks;
+    if (sample_log_reader_seek(&reader, start_us, &block) == 0)
+    {
+        first = block;
+        for (; block < reader.blocks; block++)
+        {
+            if (sample_log_reader_decode(&reader, block, sample, SAMPLE_LOG_BLOCK_RECORDS, &count) != 0)
+            {
+                a_stderr_print("bmp180: block %d is corrupted.\n", (uint32_t)block);
+                
+                continue;
+            }
+            if (sample[0].timestamp_us > end_us)
+            {
+                break;
+            }
+            for (i = 0; i < count; i++)
+            {
+                if ((sample[i].timestamp_us < start_us) || (sample[i].timestamp_us > end_us))
+                {
+                    continue;
+                }
+                if (stream_write(&stream, &sample[i]) != 0)
+                {
+                    res = 1;
+                    
+                    break;
+                }
+                samples++;
+            }
+            if (res != 0)
+            {
+                break;
+            }
+        }
+    }
+    
+    /* deinit */
+    if (stream_deinit(&stream) != 0)
+    {
+        res = 1;
+    }
+    a_stderr_print("bmp180: %d samples replayed from block %d, %d blocks in the log.\n",
+                   samples, (uint32_t)first, (uint32_t)reader.blocks);
+    (void)sample_log_reader_close(&reader);
+    
+    return res;
+}
+
+/**
+ * @brief read example output structure definition
+ */
+typedef struct read_output_s
+{
+    bmp180_ring_t ring;                                     /**< samples of the read loop */
+    bmp180_sample_t buf[READ_EXAMPLE_RING_CAPACITY];        /**< ring samples */
+    sem_t ready;                                            /**< posted after every sample */
+    pthread_t thread;                                       /**< output thread */
+    uint32_t times;                                         /**< samples to read */
+    uint32_t count;                                         /**< printed samples */
+    uint32_t next;                                          /**< expected period of the next sample */
+    uint8_t running;                                        /**< running flag */
+} read_output_t;
+
+/**
+ * @brief     read example output thread
+ * @param[in] *arg pointer to a read example output
+ * @return    NULL
+ * @note      it sleeps on the semaphore and prints the queued samples, it stops when the ring is drained after the stop,
+ *            the sequence is the period index, so a gap is an overrun of the read loop or a sample dropped by the ring
+ */
+static void *a_read_output_thread(void *arg)
+{
+    read_output_t *output = (read_output_t *)arg;
+    bmp180_sample_t sample[16];
+    uint32_t count;
+    uint32_t i;
+    uint8_t running;
+    
+    while (1)
+    {
+        /* wait for the next sample or the stop */
+        if (sem_wait(&output->ready) != 0)
+        {
+            continue;
+        }
+        running = __atomic_load_n(&output->running, __ATOMIC_ACQUIRE);
+        
+        /* print all queued samples */
+        while ((bmp180_ring_pop(&output->ring, sample, 16, &count) == 0) && (count != 0))
+        {
+            for (i = 0; i < count; i++)
+            {
+                if (sample[i].sequence != output->next)
+                {
+                    bmp180_interface_debug_print("bmp180: %d periods missed.\n", sample[i].sequence - output->next);
+                }
+                output->next = sample[i].sequence + 1;
+                output->count++;
+                bmp180_interface_debug_print("bmp180: %d/%d.\n", output->count, output->times);
+                bmp180_interface_debug_print("bmp180: temperature is %0.1fC.\n", (float)sample[i].temperature / 10.0f);
+                bmp180_interface_debug_print("bmp180: pressure is %dPa.\n", sample[i].pa);
+            }
+        }
+        if (running == 0)
+        {
+            break;
+        }
+    }
+    
+    return NULL;
+}
+
+/**
+ * @brief     start the read example output thread
+ * @param[in] *output pointer to a read example output
+ * @param[in] times samples to read
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      call it before rt_enter, so the output thread keeps SCHED_OTHER and its stack is locked too
+ */
+static uint8_t a_read_output_init(read_output_t *output, uint32_t times)
+{
+    if (bmp180_ring_init(&output->ring, output->buf, READ_EXAMPLE_RING_CAPACITY, BMP180_RING_POLICY_DROP_OLDEST) != 0)
+    {
+        return 1;
+    }
+    if (sem_init(&output->ready, 0, 0) != 0)
+    {
+        return 1;
+    }
+    output->times = times;
+    output->count = 0;
+    output->next = 0;
+    output->running = 1;
+    if (pthread_create(&output->thread, NULL, a_read_output_thread, output) != 0)
+    {
+        (void)sem_destroy(&output->ready);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     hand a sample to the read example output thread
+ * @param[in] *output pointer to a read example output
+ * @param[in] *sample pointer to a sample
+ * @note      it never blocks, a slow output loses the oldest samples
+ */
+static void a_read_output_push(read_output_t *output, const bmp180_sample_t *sample)
+{
+    (void)bmp180_ring_push(&output->ring, sample);
+    (void)sem_post(&output->ready);
+}
+
+/**
+ * @brief     print the queued samples and stop the read example output thread
+ * @param[in] *output pointer to a read example output
+ * @note      none
+ */
+static void a_read_output_deinit(read_output_t *output)
+{
+    uint32_t published;
+    uint32_t dropped;
+    
+    __atomic_store_n(&output->running, 0, __ATOMIC_RELEASE);
+    (void)sem_post(&output->ready);
+    (void)pthread_join(output->thread, NULL);
+    (void)sem_destroy(&output->ready);
+    (void)bmp180_ring_get_counter(&output->ring, &published, &dropped);
+    if (dropped != 0)
+    {
+        bmp180_interface_debug_print("bmp180: %d of %d samples dropped by the output.\n", dropped, published);
+    }
+}
+
+/**
+ * @brief     print a latency histogram
+ * @param[in] *name pointer to a latency name buffer
+ * @param[in] *histogram pointer to a rt histogram structure
+ * @note      none
+ */
+static void a_histogram_print(const char *name, rt_histogram_t *histogram)
+{
+    const uint32_t edge[9] = {0, 5, 10, 20, 50, 100, 200, 500, RT_HISTOGRAM_BUCKETS};
+    uint32_t p50;
+    uint32_t p90;
+    uint32_t p99;
+    uint32_t p999;
+    uint64_t count;
+    uint32_t i;
+    
+    /* check the samples */
+    if (rt_histogram_get_percentile(histogram, 50.0, &p50) != 0)
+    {
+        return;
+    }
+    (void)rt_histogram_get_percentile(histogram, 90.0, &p90);
+    (void)rt_histogram_get_percentile(histogram, 99.0, &p99);
+    (void)rt_histogram_get_percentile(histogram, 99.9, &p999);
+    
+    /* output the percentiles and the buckets */
+    bmp180_interface_debug_print("bmp180: %s latency p50 <= %dus p90 <= %dus p99 <= %dus p99.9 <= %dus max %.1fus.\n",
+                                 name, p50, p90, p99, p999, (double)histogram->max_ns / 1000.0);
+    for (i = 0; i < 8; i++)
+    {
+        (void)rt_histogram_get_range(histogram, edge[i], edge[i + 1], &count);
+        if (i < 7)
+        {
+            bmp180_interface_debug_print("bmp180: %s latency %3d - %3dus %d.\n", name, edge[i], edge[i + 1], (uint32_t)count);
+        }
+        else
+        {
+            bmp180_interface_debug_print("bmp180: %s latency %3dus and more %d.\n", name, edge[i], (uint32_t)count);
+        }
+    }
+}
 
 /**
  * @brief     bmp180 full function
@@ -63,10 +1165,41 @@ uint8_t bmp180(uint8_t argc, char **argv)
         {"example", required_argument, NULL, 'e'},
         {"test", required_argument, NULL, 't'},
         {"times", required_argument, NULL, 1},
+        {"eoc", no_argument, NULL, 2},
+        {"bus", required_argument, NULL, 3},
+        {"rate", required_argument, NULL, 4},
+        {"rt", required_argument, NULL, 5},
+        {"cpu", required_argument, NULL, 6},
+        {"mode", required_argument, NULL, 7},
+        {"refresh", required_argument, NULL, 8},
+        {"duration", required_argument, NULL, 9},
+        {"format", required_argument, NULL, 10},
+        {"output", required_argument, NULL, 11},
+        {"shm", required_argument, NULL, 12},
+        {"max-age", required_argument, NULL, 13},
+        {"input", required_argument, NULL, 14},
+        {"from", required_argument, NULL, 15},
+        {"to", required_argument, NULL, 16},
         {NULL, 0, NULL, 0},
     };
     char type[33] = "unknown";
     uint32_t times = 3;
+    uint8_t eoc = 0;
+    uint32_t bus[REACTOR_EXAMPLE_MAX_SENSORS] = {1};
+    uint8_t bus_count = 1;
+    double rate = 1.0;
+    int32_t priority = 0;
+    int32_t cpu = -1;
+    char mode[33] = "standard";
+    char format[33] = "csv";
+    char output[256] = "-";
+    char input[256] = "";
+    char shm[64] = "";
+    uint32_t max_age = 0;
+    uint32_t refresh = 0;
+    double duration = 0.0;
+    double from = 0.0;
+    double to = 0.0;
     
     /* if no params */
     if (argc == 1)
@@ -90,61 +1223,212 @@ uint8_t bmp180(uint8_t argc, char **argv)
             /* help */
             case 'h' :
             {
-                /* set the type */
-                memset(type, 0, sizeof(char) * 33);
-                snprintf(type, 32, "h");
+                /* set the type */
+                memset(type, 0, sizeof(char) * 33);
+                snprintf(type, 32, "h");
+                
+                break;
+            }
+            
+            /* information */
+            case 'i' :
+            {
+                /* set the type */
+                memset(type, 0, sizeof(char) * 33);
+                snprintf(type, 32, "i");
+                
+                break;
+            }
+            
+            /* port */
+            case 'p' :
+            {
+                /* set the type */
+                memset(type, 0, sizeof(char) * 33);
+                snprintf(type, 32, "p");
+                
+                break;
+            }
+            
+            /* example */
+            case 'e' :
+            {
+                /* set the type */
+                memset(type, 0, sizeof(char) * 33);
+                snprintf(type, 32, "e_%s", optarg);
+                
+                break;
+            }
+            
+            /* test */
+            case 't' :
+            {
+                /* set the type */
+                memset(type, 0, sizeof(char) * 33);
+                snprintf(type, 32, "t_%s", optarg);
+                
+                break;
+            }
+            
+            /* running times */
+            case 1 :
+            {
+                /* set the times */
+                times = atol(optarg);
+                
+                break;
+            } 
+            
+            /* eoc pin */
+            case 2 :
+            {
+                /* enable the eoc pin */
+                eoc = 1;
+                
+                break;
+            }
+            
+            /* iic bus */
+            case 3 :
+            {
+                /* set the bus index list */
+                char *p = optarg;
+                
+                bus_count = 0;
+                while (bus_count < REACTOR_EXAMPLE_MAX_SENSORS)
+                {
+                    bus[bus_count++] = strtoul(p, &p, 10);
+                    if (*p != ',')
+                    {
+                        break;
+                    }
+                    p++;
+                }
+                
+                break;
+            }
+            
+            /* sample rate */
+            case 4 :
+            {
+                /* set the rate */
+                rate = atof(optarg);
+                
+                break;
+            }
+            
+            /* real-time priority */
+            case 5 :
+            {
+                /* set the priority */
+                priority = atol(optarg);
+                
+                break;
+            }
+            
+            /* cpu affinity */
+            case 6 :
+            {
+                /* set the cpu */
+                cpu = atol(optarg);
+                
+                break;
+            }
+            
+            /* oversampling mode */
+            case 7 :
+            {
+                /* set the mode */
+                memset(mode, 0, sizeof(char) * 33);
+                strncpy(mode, optarg, 32);
+                
+                break;
+            }
+            
+            /* temperature refresh */
+            case 8 :
+            {
+                /* set the refresh */
+                refresh = atol(optarg);
+                
+                break;
+            }
+            
+            /* stream duration */
+            case 9 :
+            {
+                /* set the duration */
+                duration = atof(optarg);
+                
+                break;
+            }
+            
+            /* output format */
+            case 10 :
+            {
+                /* set the format */
+                memset(format, 0, sizeof(char) * 33);
+                strncpy(format, optarg, 32);
                 
                 break;
             }
             
-            /* information */
-            case 'i' :
+            /* output path */
+            case 11 :
             {
-                /* set the type */
-                memset(type, 0, sizeof(char) * 33);
-                snprintf(type, 32, "i");
+                /* set the output */
+                memset(output, 0, sizeof(char) * 256);
+                strncpy(output, optarg, 255);
                 
                 break;
             }
             
-            /* port */
-            case 'p' :
+            /* shared memory name */
+            case 12 :
             {
-                /* set the type */
-                memset(type, 0, sizeof(char) * 33);
-                snprintf(type, 32, "p");
+                /* set the shared memory name */
+                memset(shm, 0, sizeof(char) * 64);
+                strncpy(shm, optarg, 63);
                 
                 break;
             }
             
-            /* example */
-            case 'e' :
+            /* max sample age */
+            case 13 :
             {
-                /* set the type */
-                memset(type, 0, sizeof(char) * 33);
-                snprintf(type, 32, "e_%s", optarg);
+                /* set the max age */
+                max_age = atol(optarg);
                 
                 break;
             }
             
-            /* test */
-            case 't' :
+            /* input path */
+            case 14 :
             {
-                /* set the type */
-                memset(type, 0, sizeof(char) * 33);
-                snprintf(type, 32, "t_%s", optarg);
+                /* set the input */
+                memset(input, 0, sizeof(char) * 256);
+                strncpy(input, optarg, 255);
                 
                 break;
             }
             
-            /* running times */
-            case 1 :
+            /* replay start */
+            case 15 :
             {
-                /* set the times */
-                times = atol(optarg);
+                /* set the start */
+                from = atof(optarg);
                 
                 break;
-            } 
+            }
+            
+            /* replay end */
+            case 16 :
+            {
+                /* set the end */
+                to = atof(optarg);
+                
+                break;
+            }
             
             /* the end */
             case -1 :
@@ -175,8 +1459,97 @@ uint8_t bmp180(uint8_t argc, char **argv)
     }
     else if (strcmp("t_read", type) == 0)
     {
+        uint8_t res;
+        
+        /* eoc init */
+        if ((eoc != 0) && (gpio_eoc_init(GPIO_DEVICE_NAME, GPIO_DEVICE_LINE) != 0))
+        {
+            return 1;
+        }
+        
         /* run read test */
-        if (bmp180_read_test(times) != 0)
+        res = bmp180_read_test(times);
+        
+        /* eoc deinit */
+        if (eoc != 0)
+        {
+            (void)gpio_eoc_deinit();
+        }
+        
+        if (res != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_sim", type) == 0)
+    {
+        /* run simulator test */
+        if (bmp180_simulator_test(times) != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_bench", type) == 0)
+    {
+        /* run benchmark test */
+        if (bmp180_benchmark_test(times, a_timestamp_ns) != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_iic", type) == 0)
+    {
+        /* run iic backend benchmark */
+        if (a_iic_benchmark(bus[0], times) != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_equiv", type) == 0)
+    {
+        long cores;
+        
+        /* use all online cores */
+        cores = sysconf(_SC_NPROCESSORS_ONLN);
+        if (cores < 1)
+        {
+            cores = 1;
+        }
+        if (cores > 64)
+        {
+            cores = 64;
+        }
+        
+        /* run equivalence test */
+        if (bmp180_equivalence_test((uint32_t)cores) != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_concurrency", type) == 0)
+    {
+        /* run concurrency test */
+        if (bmp180_concurrency_test(times) != 0)
         {
             return 1;
         }
@@ -189,39 +1562,343 @@ uint8_t bmp180(uint8_t argc, char **argv)
     {
         uint8_t res;
         uint32_t i;
-        float temperature;
-        uint32_t pressure;
+        uint64_t missed;
+        uint64_t period;
+        uint64_t lateness;
+        periodic_t periodic;
+        periodic_stats_t stats;
+        bmp180_sample_t sample;
+        static read_output_t output;
+        static rt_histogram_t histogram;
+        static rt_histogram_t eoc_histogram;
+        
+        /* check the rate */
+        if ((rate <= 0.0) || (rate > 1000.0))
+        {
+            bmp180_interface_debug_print("bmp180: rate is invalid.\n");
+            
+            return 5;
+        }
+        
+        /* check the priority */
+        if ((priority < 0) || (priority > 99))
+        {
+            bmp180_interface_debug_print("bmp180: rt priority is invalid.\n");
+            
+            return 5;
+        }
+        
+        /* eoc init */
+        if ((eoc != 0) && (gpio_eoc_init(GPIO_DEVICE_NAME, GPIO_DEVICE_LINE) != 0))
+        {
+            return 1;
+        }
         
         /* basic init */
         res = bmp180_basic_init();
         if (res != 0)
         {
+            if (eoc != 0)
+            {
+                (void)gpio_eoc_deinit();
+            }
+            
             return 1;
         }
         
-        /* loop */
-        for (i = 0; i < times; i++)
+        /* wait for the eoc pin */
+        if (eoc != 0)
         {
-            /* delay 1000ms */
-            bmp180_interface_delay_ms(1000);
-            
-            /* read data */
-            res = bmp180_basic_read((float *)&temperature, (uint32_t *)&pressure);
+            res = bmp180_basic_set_wait_mode(BMP180_WAIT_MODE_EOC);
             if (res != 0)
             {
                 (void)bmp180_basic_deinit();
+                (void)gpio_eoc_deinit();
                 
                 return 1;
             }
+        }
+        
+        /* start the periodic timer */
+        if (periodic_init(&periodic, (uint64_t)(1000000000.0 / rate)) != 0)
+        {
+            (void)bmp180_basic_deinit();
+            if (eoc != 0)
+            {
+                (void)gpio_eoc_deinit();
+            }
+            
+            return 1;
+        }
+        (void)rt_histogram_clear(&histogram);
+        (void)rt_histogram_clear(&eoc_histogram);
+        
+        /* the samples are printed by the output thread, so printing never delays the next deadline */
+        if (a_read_output_init(&output, times) != 0)
+        {
+            (void)periodic_deinit(&periodic);
+            (void)bmp180_basic_deinit();
+            if (eoc != 0)
+            {
+                (void)gpio_eoc_deinit();
+            }
+            
+            return 1;
+        }
+        
+        /* the output thread stays a normal thread while this one runs real-time */
+        if (priority != 0)
+        {
+            rt_config_t config;
+            
+            config.priority = priority;
+            config.cpu = cpu;
+            config.lock_memory = 1;
+            config.prefault_stack = 1;
+            if (rt_enter(&config) != 0)
+            {
+                bmp180_interface_debug_print("bmp180: real-time profile is incomplete.\n");
+            }
+        }
+        
+        /* loop, the sequence counts the periods so the output sees the overruns as gaps */
+        period = 0;
+        for (i = 0; i < times; i++)
+        {
+            /* wait for the next absolute deadline */
+            if (periodic_wait(&periodic, &missed) != 0)
+            {
+                break;
+            }
+            if (periodic_get_lateness(&periodic, &lateness) == 0)
+            {
+                (void)rt_histogram_add(&histogram, lateness);
+            }
+            period += missed;
+            
+            /* read data */
+            memset(&sample, 0, sizeof(bmp180_sample_t));
+            res = bmp180_basic_read_fixed(&sample.temperature, &sample.pa);
+            if (res != 0)
+            {
+                break;
+            }
             
             /* output */
-            bmp180_interface_debug_print("bmp180: %d/%d.\n", (uint32_t)(i + 1), (uint32_t)times);
-            bmp180_interface_debug_print("bmp180: temperature is %0.2fC.\n", temperature);
-            bmp180_interface_debug_print("bmp180: pressure is %dPa.\n", pressure);
+            sample.timestamp_us = a_timestamp_us();
+            sample.sequence = (uint32_t)period++;
+            sample.mode = (uint8_t)BMP180_BASIC_DEFAULT_MODE;
+            a_read_output_push(&output, &sample);
+            
+            /* collect the latency from the end of conversion to the sample */
+            if (eoc != 0)
+            {
+                uint64_t edge;
+                
+                if (gpio_eoc_get_timestamp(&edge) == 0)
+                {
+                    (void)rt_histogram_add(&eoc_histogram, a_timestamp_ns() - edge);
+                }
+            }
+        }
+        
+        /* back to a normal thread and print the queued samples */
+        if (priority != 0)
+        {
+            (void)rt_leave();
+        }
+        a_read_output_deinit(&output);
+        if (i != times)
+        {
+            (void)periodic_deinit(&periodic);
+            (void)bmp180_basic_deinit();
+            if (eoc != 0)
+            {
+                (void)gpio_eoc_deinit();
+            }
+            
+            return 1;
         }
         
+        /* output the timing statistics */
+        (void)periodic_get_stats(&periodic, &stats);
+        bmp180_interface_debug_print("bmp180: %d samples at %.3fHz, %d overruns.\n", 
+                                     (uint32_t)stats.ticks, rate, (uint32_t)stats.overruns);
+        bmp180_interface_debug_print("bmp180: lateness min %.1fus mean %.1fus max %.1fus stddev %.1fus.\n", 
+                                     stats.lateness_min_us, stats.lateness_mean_us, stats.lateness_max_us, stats.lateness_stddev_us);
+        bmp180_interface_debug_print("bmp180: period jitter min %.1fus max %.1fus stddev %.1fus.\n", 
+                                     stats.jitter_min_us, stats.jitter_max_us, stats.jitter_stddev_us);
+        a_histogram_print("wake", &histogram);
+        a_histogram_print("eoc", &eoc_histogram);
+        
         /* deinit */
+        (void)periodic_deinit(&periodic);
         (void)bmp180_basic_deinit();
+        if (eoc != 0)
+        {
+            (void)gpio_eoc_deinit();
+        }
+        
+        return 0;
+    }
+    else if (strcmp("e_reactor", type) == 0)
+    {
+        /* check the rate */
+        if ((rate <= 0.0) || (rate > 1000.0))
+        {
+            bmp180_interface_debug_print("bmp180: rate is invalid.\n");
+            
+            return 5;
+        }
+        
+        /* run the sensors of every bus on one thread */
+        if (a_reactor_example(bus, bus_count, times, rate, eoc, (shm[0] != 0) ? shm : NULL) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("e_replay", type) == 0)
+    {
+        const char *const format_name[3] = {"csv", "jsonl", "bin"};
+        uint8_t i;
+        
+        /* check the input and the range */
+        if ((input[0] == '\0') || (from < 0.0) || ((to != 0.0) && (to < from)))
+        {
+            a_stderr_print("bmp180: input or range is invalid.\n");
+            
+            return 5;
+        }
+        
+        /* parse the format */
+        for (i = 0; i < 3; i++)
+        {
+            if (strcmp(format, format_name[i]) == 0)
+            {
+                break;
+            }
+        }
+        if (i == 3)
+        {
+            a_stderr_print("bmp180: format is invalid.\n");
+            
+            return 5;
+        }
+        
+        /* replay the log */
+        if (a_replay_example(input, from, to, output, (stream_format_t)i) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("e_shared", type) == 0)
+    {
+        /* read one sensor from several threads */
+        if (a_shared_example(bus[0], times, max_age) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("e_shm", type) == 0)
+    {
+        /* check the rate */
+        if ((rate <= 0.0) || (rate > 1000.0))
+        {
+            bmp180_interface_debug_print("bmp180: rate is invalid.\n");
+            
+            return 5;
+        }
+        
+        /* read the published samples */
+        if (a_shm_example((shm[0] != 0) ? shm : SHM_DEFAULT_NAME, times, rate) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("e_stream", type) == 0)
+    {
+        const char *const mode_name[4] = {"ultra_low", "standard", "high", "ultra_high"};
+        const char *const format_name[4] = {"csv", "jsonl", "bin", "log"};
+        stream_example_config_t config;
+        uint8_t i;
+        
+        /* check the rate, the refresh and the duration */
+        if ((rate <= 0.0) || (rate > 1000.0) || (refresh > 65535) || (duration < 0.0))
+        {
+            a_stderr_print("bmp180: rate, refresh or duration is invalid.\n");
+            
+            return 5;
+        }
+        config.path = output;
+        config.format = STREAM_FORMAT_CSV;
+        config.log = 0;
+        config.mode = BMP180_MODE_STANDARD;
+        config.refresh = (uint16_t)refresh;
+        config.bus = bus[0];
+        config.times = times;
+        config.duration = duration;
+        config.rate = rate;
+        config.eoc = eoc;
+        
+        /* parse the mode */
+        for (i = 0; i < 4; i++)
+        {
+            if (strcmp(mode, mode_name[i]) == 0)
+            {
+                config.mode = (bmp180_mode_t)i;
+                
+                break;
+            }
+        }
+        if (i == 4)
+        {
+            a_stderr_print("bmp180: mode is invalid.\n");
+            
+            return 5;
+        }
+        
+        /* parse the format, the sample log needs a file */
+        for (i = 0; i < 4; i++)
+        {
+            if (strcmp(format, format_name[i]) == 0)
+            {
+                break;
+            }
+        }
+        if (i == 4)
+        {
+            a_stderr_print("bmp180: format is invalid.\n");
+            
+            return 5;
+        }
+        if (i == 3)
+        {
+            if (strcmp(output, "-") == 0)
+            {
+                a_stderr_print("bmp180: log format needs an output file.\n");
+                
+                return 5;
+            }
+            config.log = 1;
+        }
+        else
+        {
+            config.format = (stream_format_t)i;
+        }
+        
+        /* stream the samples */
+        if (a_stream_example(&config) != 0)
+        {
+            return 1;
+        }
         
         return 0;
     }
@@ -233,17 +1910,46 @@ uint8_t bmp180(uint8_t argc, char **argv)
         bmp180_interface_debug_print("  bmp180 (-h | --help)\n");
         bmp180_interface_debug_print("  bmp180 (-p | --port)\n");
         bmp180_interface_debug_print("  bmp180 (-t reg | --test=reg)\n");
-        bmp180_interface_debug_print("  bmp180 (-t read | --test=read) [--times=<num>]\n");
-        bmp180_interface_debug_print("  bmp180 (-e read | --example=read) [--times=<num>]\n");
+        bmp180_interface_debug_print("  bmp180 (-t read | --test=read) [--times=<num>] [--eoc]\n");
+        bmp180_interface_debug_print("  bmp180 (-t sim | --test=sim) [--times=<num>]\n");
+        bmp180_interface_debug_print("  bmp180 (-t bench | --test=bench) [--times=<num>]\n");
+        bmp180_interface_debug_print("  bmp180 (-t equiv | --test=equiv)\n");
+        bmp180_interface_debug_print("  bmp180 (-t concurrency | --test=concurrency) [--times=<num>]\n");
+        bmp180_interface_debug_print("  bmp180 (-t iic | --test=iic) [--bus=<num>] [--times=<num>]\n");
+        bmp180_interface_debug_print("  bmp180 (-e read | --example=read) [--times=<num>] [--rate=<hz>] [--eoc] [--rt=<priority>] [--cpu=<num>]\n");
+        bmp180_interface_debug_print("  bmp180 (-e stream | --example=stream) [--bus=<num>] [--rate=<hz>] [--mode=<ultra_low | standard | high | ultra_high>]\n");
+        bmp180_interface_debug_print("         [--refresh=<num>] [--times=<num> | --duration=<s>] [--format=<csv | jsonl | bin | log>] [--output=<path>] [--eoc]\n");
+        bmp180_interface_debug_print("  bmp180 (-e reactor | --example=reactor) [--bus=<num[,num...]>] [--times=<num>] [--rate=<hz>] [--eoc] [--shm=<name>]\n");
+        bmp180_interface_debug_print("  bmp180 (-e replay | --example=replay) --input=<path> [--from=<s>] [--to=<s>] [--format=<csv | jsonl | bin>] [--output=<path>]\n");
+        bmp180_interface_debug_print("  bmp180 (-e shm | --example=shm) [--shm=<name>] [--times=<num>] [--rate=<hz>]\n");
+        bmp180_interface_debug_print("  bmp180 (-e shared | --example=shared) [--bus=<num>] [--times=<num>] [--max-age=<ms>]\n");
         bmp180_interface_debug_print("\n");
         bmp180_interface_debug_print("Options:\n");
-        bmp180_interface_debug_print("  -e <read>, --example=<read>     Run the driver example.\n");
+        bmp180_interface_debug_print("      --bus=<num[,num...]>        Set the iic bus index of /dev/i2c-N, the reactor example takes a list.([default: 1])\n");
+        bmp180_interface_debug_print("      --cpu=<num>                 Pin the real-time read loop to a cpu.\n");
+        bmp180_interface_debug_print("      --duration=<s>              Stream for a duration instead of a sample count.\n");
+        bmp180_interface_debug_print("  -e <read | stream | reactor | replay | shm | shared>, --example=<read | stream | reactor | replay | shm | shared>\n");
+        bmp180_interface_debug_print("                                  Run the driver example.\n");
+        bmp180_interface_debug_print("      --eoc                       Wait for the EOC pin instead of polling the status.\n");
+        bmp180_interface_debug_print("      --format=<csv | jsonl | bin | log>\n");
+        bmp180_interface_debug_print("                                  Set the stream output format, log appends to a packed sample log.([default: csv])\n");
+        bmp180_interface_debug_print("      --from=<s>                  Start the replay this long after the first record of the log.([default: 0])\n");
         bmp180_interface_debug_print("  -h, --help                      Show the help.\n");
         bmp180_interface_debug_print("  -i, --information               Show the chip information.\n");
+        bmp180_interface_debug_print("      --input=<path>              Set the sample log of the replay example.\n");
+        bmp180_interface_debug_print("      --max-age=<ms>              Accept a cached sample of the shared example up to this age, 0 means none.([default: 0])\n");
+        bmp180_interface_debug_print("      --mode=<ultra_low | standard | high | ultra_high>\n");
+        bmp180_interface_debug_print("                                  Set the stream oversampling mode.([default: standard])\n");
+        bmp180_interface_debug_print("      --output=<path>             Set the stream and replay output file, - means stdout.([default: -])\n");
         bmp180_interface_debug_print("  -p, --port                      Display the pin connections of the current board.\n");
-        bmp180_interface_debug_print("  -t <reg | read>, --test=<reg | read>\n");
+        bmp180_interface_debug_print("      --rate=<hz>                 Set the sample rate of the read, stream and reactor examples and the shm read rate.([default: 1])\n");
+        bmp180_interface_debug_print("      --refresh=<num>             Measure the temperature every num stream samples, 0 means every sample.([default: 0])\n");
+        bmp180_interface_debug_print("      --rt=<priority>             Run the read loop with SCHED_FIFO 1 - 99, locked memory and a non real-time output thread.\n");
+        bmp180_interface_debug_print("      --shm=<name>                Publish the reactor samples to or read them from a shared memory segment.([default: /bmp180])\n");
+        bmp180_interface_debug_print("  -t <reg | read | sim | bench | equiv | concurrency | iic>, --test=<reg | read | sim | bench | equiv | concurrency | iic>\n");
         bmp180_interface_debug_print("                                  Run the driver test.\n");
         bmp180_interface_debug_print("      --times=<num>               Set the running times.([default: 3])\n");
+        bmp180_interface_debug_print("      --to=<s>                    End the replay this long after the first record of the log, 0 means the last record.([default: 0])\n");
         
         return 0;
     }
@@ -270,6 +1976,7 @@ uint8_t bmp180(uint8_t argc, char **argv)
         /* print pin connection */
         bmp180_interface_debug_print("bmp180: SCL connected to GPIO3(BCM).\n");
         bmp180_interface_debug_print("bmp180: SDA connected to GPIO2(BCM).\n");
+        bmp180_interface_debug_print("bmp180: EOC connected to GPIO17(BCM).\n");
         
         return 0;
     }
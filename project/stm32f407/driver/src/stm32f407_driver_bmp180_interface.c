@@ -97,6 +97,74 @@ uint8_t bmp180_interface_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint
     return iic_write(addr, reg, buf, len);
 }
 
+/**
+ * @brief     interface iic bus init with a user context
+ * @param[in] *user pointer to the user context
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic init failed
+ * @note      this board has one bus, the user context is ignored
+ */
+uint8_t bmp180_interface_iic_init_ctx(void *user)
+{
+    (void)user;
+    
+    return bmp180_interface_iic_init();
+}
+
+/**
+ * @brief     interface iic bus deinit with a user context
+ * @param[in] *user pointer to the user context
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic deinit failed
+ * @note      this board has one bus, the user context is ignored
+ */
+uint8_t bmp180_interface_iic_deinit_ctx(void *user)
+{
+    (void)user;
+    
+    return bmp180_interface_iic_deinit();
+}
+
+/**
+ * @brief      interface iic bus read with a user context
+ * @param[in]  *user pointer to the user context
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       this board has one bus, the user context is ignored
+ */
+uint8_t bmp180_interface_iic_read_ctx(void *user, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    (void)user;
+    
+    return bmp180_interface_iic_read(addr, reg, buf, len);
+}
+
+/**
+ * @brief     interface iic bus write with a user context
+ * @param[in] *user pointer to the user context
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      this board has one bus, the user context is ignored
+ */
+uint8_t bmp180_interface_iic_write_ctx(void *user, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    (void)user;
+    
+    return bmp180_interface_iic_write(addr, reg, buf, len);
+}
+
 /**
  * @brief     interface delay ms
  * @param[in] ms time
@@ -107,6 +175,67 @@ void bmp180_interface_delay_ms(uint32_t ms)
     delay_ms(ms);
 }
 
+/**
+ * @brief     interface delay us
+ * @param[in] us time
+ * @note      none
+ */
+void bmp180_interface_delay_us(uint32_t us)
+{
+    delay_us(us);
+}
+
+/**
+ * @brief  interface timestamp ms
+ * @return monotonic time in ms
+ * @note   none
+ */
+uint32_t bmp180_interface_timestamp_ms(void)
+{
+    return HAL_GetTick();
+}
+
+/**
+ * @brief  interface timestamp ns
+ * @return monotonic time in ns
+ * @note   the resolution is the 1ms systick
+ */
+uint64_t bmp180_interface_timestamp_ns(void)
+{
+    return (uint64_t)HAL_GetTick() * 1000000ULL;
+}
+
+/**
+ * @brief     interface wait eoc
+ * @param[in] us timeout in us
+ * @return    status code
+ *            - 0 success
+ *            - 1 timeout or failed
+ * @note      the EOC pin is not connected on this board, the driver falls back to polling
+ */
+uint8_t bmp180_interface_wait_eoc(uint32_t us)
+{
+    (void)us;
+    
+    return 1;
+}
+
+/**
+ * @brief     interface wait eoc with a user context
+ * @param[in] *user pointer to the user context
+ * @param[in] us timeout in us
+ * @return    status code
+ *            - 0 success
+ *            - 1 timeout or failed
+ * @note      this board has one sensor, the user context is ignored
+ */
+uint8_t bmp180_interface_wait_eoc_ctx(void *user, uint32_t us)
+{
+    (void)user;
+    
+    return bmp180_interface_wait_eoc(us);
+}
+
 /**
  * @brief     interface print format data
  * @param[in] fmt format data
@@ -23,13 +23,14 @@
  *
  * @file      driver_bmp180.c
  * @brief     driver bmp180 source file
- * @version   2.0.0
+ * @version   2.1.0
  * @author    Shifeng Li
  * @date      2021-02-21
  *
  * <h3>history</h3>
  * <table>
  * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>2.1      <td>Shifeng Li  <td>add the split-phase api and performance modules
  * <tr><td>2021/02/21  <td>2.0      <td>Shifeng Li  <td>format the code
  * <tr><td>2020/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
  * </table>
@@ -47,7 +48,7 @@
 #define MAX_CURRENT               0.65f                 /**< chip max current */
 #define TEMPERATURE_MIN           -40.0f                /**< chip min operating temperature */
 #define TEMPERATURE_MAX           85.0f                 /**< chip max operating temperature */
-#define DRIVER_VERSION            2000                  /**< driver version */
+#define DRIVER_VERSION            2100                  /**< driver version */
 
 /**
  * @brief chip address definition
@@ -86,33 +87,173 @@
 #define BMP180_REG_SOFT             0xE0        /**< soft reset register */
 #define BMP180_REG_ID               0xD0        /**< chip id register */
 
+/**
+ * @brief chip command definition
+ */
+#define BMP180_CMD_TEMPERATURE      0x2E        /**< temperature measurement command */
+#define BMP180_CMD_PRESSURE         0x34        /**< pressure measurement command */
+#define BMP180_CTRL_MEAS_SCO        0x20        /**< start of conversion bit */
+#define BMP180_TIMEOUT_MS           5000        /**< conversion timeout in ms */
+#define BMP180_TEMPERATURE_TIME_US  4500        /**< temperature conversion time in us */
+#define BMP180_EOC_MARGIN_US        10000       /**< EOC edge timeout margin in us */
+
+/**
+ * @brief pressure conversion time table in us, indexed by oss
+ */
+static const uint32_t gs_pressure_time_us[4] =
+{
+    4500, 7500, 13500, 25500,
+};
+
+/**
+ * @brief metrics counter definition
+ */
+#if (BMP180_METRICS_ENABLE == 1)
+    #define BMP180_METRICS_INC(HANDLE, FIELD)    ((HANDLE)->metrics.FIELD++)        /**< count a metrics event */
+#else
+    #define BMP180_METRICS_INC(HANDLE, FIELD)                                        /**< metrics are compiled out */
+#endif
+
+#if (BMP180_METRICS_ENABLE == 1)
+/**
+ * @brief     get the metrics time
+ * @param[in] *handle pointer to a bmp180 handle structure
+ * @return    time in ns, 0 when timestamp_ns is not linked
+ * @note      none
+ */
+static uint64_t a_bmp180_metrics_now(bmp180_handle_t *handle)
+{
+    if (handle->timestamp_ns_ctx != NULL)                     /* check timestamp_ns_ctx */
+    {
+        return handle->timestamp_ns_ctx(handle->user);        /* get time with the context */
+    }
+    if (handle->timestamp_ns == NULL)                         /* check timestamp_ns */
+    {
+        return 0;                                             /* no clock */
+    }
+    
+    return handle->timestamp_ns();                            /* get time */
+}
+
+/**
+ * @brief     add the time since start to a log2 histogram
+ * @param[in] *handle pointer to a bmp180 handle structure
+ * @param[in] *histogram pointer to a histogram buffer
+ * @param[in] start start time in ns
+ * @note      nothing is added when timestamp_ns is not linked
+ */
+static void a_bmp180_metrics_record(bmp180_handle_t *handle, uint32_t *histogram, uint64_t start)
+{
+    uint64_t ns;
+    uint8_t i;
+    
+    if ((handle->timestamp_ns == NULL) && 
+        (handle->timestamp_ns_ctx == NULL))                     /* check timestamp_ns */
+    {
+        return;                                                 /* no clock */
+    }
+    ns = a_bmp180_metrics_now(handle) - start;                  /* get duration */
+    i = 0;                                                      /* first bucket */
+    while ((ns > 1) && (i < (BMP180_METRICS_BUCKETS - 1)))      /* find the highest bit */
+    {
+        ns = ns >> 1;                                           /* right shift 1 */
+        i++;                                                    /* next bucket */
+    }
+    histogram[i]++;                                             /* count */
+}
+
+/**
+ * @brief     count an iic transaction
+ * @param[in] *handle pointer to a bmp180 handle structure
+ * @param[in] start start time in ns
+ * @param[in] len transferred bytes
+ * @param[in] res transaction result
+ * @param[in] write write flag
+ * @note      none
+ */
+static void a_bmp180_metrics_iic(bmp180_handle_t *handle, uint64_t start, uint16_t len, uint8_t res, uint8_t write)
+{
+    a_bmp180_metrics_record(handle, handle->metrics.iic_ns, start);        /* bus latency */
+    if (write != 0)                                                        /* write */
+    {
+        handle->metrics.iic_writes++;                                      /* count the transaction */
+        if (res != 0)                                                      /* check the result */
+        {
+            handle->metrics.iic_write_errors++;                            /* count the error */
+        }
+        else
+        {
+            handle->metrics.iic_write_bytes += len;                        /* count the bytes */
+        }
+    }
+    else
+    {
+        handle->metrics.iic_reads++;                                       /* count the transaction */
+        if (res != 0)                                                      /* check the result */
+        {
+            handle->metrics.iic_read_errors++;                             /* count the error */
+        }
+        else
+        {
+            handle->metrics.iic_read_bytes += len;                         /* count the bytes */
+        }
+    }
+}
+
+/**
+ * @brief     count a finished conversion
+ * @param[in] *handle pointer to a bmp180 handle structure
+ * @note      none
+ */
+static void a_bmp180_metrics_conversion(bmp180_handle_t *handle)
+{
+    handle->metrics.conversions++;                                                          /* count the conversion */
+    if (handle->conversion_polls > handle->metrics.polls_max)                               /* check max polls */
+    {
+        handle->metrics.polls_max = handle->conversion_polls;                               /* save max polls */
+    }
+    a_bmp180_metrics_record(handle, handle->metrics.conversion_ns, 
+                            handle->conversion_start_ns);                                   /* conversion latency */
+}
+#endif
+
 /**
  * @brief      read bytes
  * @param[in]  *handle pointer to a bmp180 handle structure
- * @param[in]  addr iic device address
  * @param[in]  reg iic register address
- * @param[out] *data pointer to a data buffer
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
  * @return     status code
  *             - 0 success
  *             - 1 read failed
  * @note       none
  */
-static uint8_t a_bmp180_iic_read(bmp180_handle_t *handle, uint8_t addr, uint8_t reg, uint8_t *data)
+static uint8_t a_bmp180_iic_read(bmp180_handle_t *handle, uint8_t reg, uint8_t *buf, uint16_t len)
 {
-    if (handle->iic_read(addr, reg, data, 1) != 0)        /* read */
+    uint8_t res;
+#if (BMP180_METRICS_ENABLE == 1)
+    uint64_t start = a_bmp180_metrics_now(handle);
+#endif
+    
+    handle->iic_read_count++;                                                           /* count the transaction */
+    if (handle->iic_read_ctx != NULL)                                                   /* check iic_read_ctx */
     {
-        return 1;                                         /* return error */
+        res = handle->iic_read_ctx(handle->user, BMP180_ADDRESS, reg, buf, len);        /* read with the context */
     }
     else
     {
-        return 0;                                         /* success return 0 */
+        res = handle->iic_read(BMP180_ADDRESS, reg, buf, len);                          /* read */
     }
+#if (BMP180_METRICS_ENABLE == 1)
+    a_bmp180_metrics_iic(handle, start, len, res, 0);                                   /* count the read */
+#endif
+    
+    return (res != 0) ? 1 : 0;                                                          /* return the result */
 }
 
 /**
  * @brief     write bytes
  * @param[in] *handle pointer to a bmp180 handle structure
- * @param[in] addr iic device address
  * @param[in] reg iic register address
  * @param[in] data written data
  * @return    status code
@@ -120,114 +261,784 @@ static uint8_t a_bmp180_iic_read(bmp180_handle_t *handle, uint8_t addr, uint8_t
  *            - 1 write failed
  * @note      none
  */
-static uint8_t a_bmp180_iic_write(bmp180_handle_t *handle, uint8_t addr, uint8_t reg, uint8_t data)
+static uint8_t a_bmp180_iic_write(bmp180_handle_t *handle, uint8_t reg, uint8_t data)
 {
-    if (handle->iic_write(addr, reg, &data, 1) != 0)        /* write */
+    uint8_t res;
+#if (BMP180_METRICS_ENABLE == 1)
+    uint64_t start = a_bmp180_metrics_now(handle);
+#endif
+    
+    handle->iic_write_count++;                                                           /* count the transaction */
+    if (handle->iic_write_ctx != NULL)                                                   /* check iic_write_ctx */
     {
-        return 1;                                           /* return error */
+        res = handle->iic_write_ctx(handle->user, BMP180_ADDRESS, reg, &data, 1);        /* write with the context */
     }
     else
     {
-        return 0;                                           /* success return 0 */
+        res = handle->iic_write(BMP180_ADDRESS, reg, &data, 1);                          /* write */
     }
+#if (BMP180_METRICS_ENABLE == 1)
+    a_bmp180_metrics_iic(handle, start, 1, res, 1);                                      /* count the write */
+#endif
+    
+    return (res != 0) ? 1 : 0;                                                           /* return the result */
 }
 
 /**
- * @brief     initialize the chip
+ * @brief     init the iic bus
  * @param[in] *handle pointer to a bmp180 handle structure
  * @return    status code
  *            - 0 success
- *            - 1 iic initialization failed
- *            - 2 handle is NULL
- *            - 3 linked functions is NULL
- *            - 4 id is error
-  *           - 5 read calibration failed
+ *            - 1 iic init failed
  * @note      none
  */
-uint8_t bmp180_init(bmp180_handle_t *handle)
+static uint8_t a_bmp180_iic_init(bmp180_handle_t *handle)
 {
-    uint8_t buf[22];
-    int16_t temp1 = 0;
-    uint16_t temp2 = 0;
-    uint8_t id;
+    uint8_t res;
     
-    if (handle == NULL)                                                                  /* check handle */
+    if (handle->iic_init_ctx != NULL)                    /* check iic_init_ctx */
     {
-        return 2;                                                                        /* return error */
+        res = handle->iic_init_ctx(handle->user);        /* init with the context */
     }
-    if (handle->debug_print == NULL)                                                     /* check debug_print */
+    else
     {
-        return 3;                                                                        /* return error */
+        res = handle->iic_init();                        /* init */
+    }
+    
+    return (res != 0) ? 1 : 0;                           /* return the result */
+}
+
+/**
+ * @brief     deinit the iic bus
+ * @param[in] *handle pointer to a bmp180 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic deinit failed
+ * @note      none
+ */
+static uint8_t a_bmp180_iic_deinit(bmp180_handle_t *handle)
+{
+    uint8_t res;
+    
+    if (handle->iic_deinit_ctx != NULL)                    /* check iic_deinit_ctx */
+    {
+        res = handle->iic_deinit_ctx(handle->user);        /* deinit with the context */
     }
-    if (handle->iic_init == NULL)                                                        /* check iic_init */
+    else
     {
-        handle->debug_print("bmp180: iic_init is null.\n");                              /* iic_init is nul */
-        
-        return 3;                                                                        /* return error */
+        res = handle->iic_deinit();                        /* deinit */
     }
-    if (handle->iic_deinit == NULL)                                                      /* check iic_deinit */
+    
+    return (res != 0) ? 1 : 0;                             /* return the result */
+}
+
+/**
+ * @brief     delay in ms
+ * @param[in] *handle pointer to a bmp180 handle structure
+ * @param[in] ms time
+ * @note      none
+ */
+static void a_bmp180_delay_ms(bmp180_handle_t *handle, uint32_t ms)
+{
+    if (handle->delay_ms_ctx != NULL)               /* check delay_ms_ctx */
     {
-        handle->debug_print("bmp180: iic_deinit is null.\n");                            /* iic_deinit is null */
-        
-        return 3;                                                                        /* return error */
+        handle->delay_ms_ctx(handle->user, ms);     /* delay with the context */
     }
-    if (handle->iic_read == NULL)                                                        /* check iic_read */
+    else
     {
-        handle->debug_print("bmp180: iic_read is null.\n");                              /* iic_read is null */
-        
-        return 3;                                                                        /* return error */
+        handle->delay_ms(ms);                       /* delay */
+    }
+}
+
+/**
+ * @brief     delay in us
+ * @param[in] *handle pointer to a bmp180 handle structure
+ * @param[in] us time
+ * @note      it rounds up to ms when no delay_us is linked
+ */
+static void a_bmp180_delay_us(bmp180_handle_t *handle, uint32_t us)
+{
+    if (handle->delay_us_ctx != NULL)                     /* check delay_us_ctx */
+    {
+        handle->delay_us_ctx(handle->user, us);           /* delay with the context */
     }
-    if (handle->iic_write == NULL)                                                       /* check iic_write */
+    else if (handle->delay_us != NULL)                    /* check delay_us */
     {
-        handle->debug_print("bmp180: iic_write is null.\n");                             /* iic_write is null */
+        handle->delay_us(us);                             /* delay */
+    }
+    else
+    {
+        a_bmp180_delay_ms(handle, (us + 999) / 1000);     /* round up to ms */
+    }
+}
+
+/**
+ * @brief      get the timestamp in ms
+ * @param[in]  *handle pointer to a bmp180 handle structure
+ * @param[out] *ms pointer to a timestamp buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 no timestamp is linked
+ * @note       none
+ */
+static uint8_t a_bmp180_timestamp_ms(bmp180_handle_t *handle, uint32_t *ms)
+{
+    if (handle->timestamp_ms_ctx != NULL)                /* check timestamp_ms_ctx */
+    {
+        *ms = handle->timestamp_ms_ctx(handle->user);    /* get time with the context */
         
-        return 3;                                                                        /* return error */
+        return 0;                                        /* success return 0 */
     }
-    if (handle->delay_ms == NULL)                                                        /* check delay_ms */
+    if (handle->timestamp_ms != NULL)                    /* check timestamp_ms */
     {
-        handle->debug_print("bmp180: delay_ms is null.\n");                              /* delay_ms is null */
+        *ms = handle->timestamp_ms();                    /* get time */
         
-        return 3;                                                                        /* return error */
+        return 0;                                        /* success return 0 */
     }
     
-    if (handle->iic_init() != 0)                                                         /* iic init */
+    return 1;                                            /* no clock */
+}
+
+/**
+ * @brief     wait for the eoc rising edge
+ * @param[in] *handle pointer to a bmp180 handle structure
+ * @param[in] us timeout in us
+ * @return    status code
+ *            - 0 success
+ *            - 1 timeout or failed
+ * @note      a zero timeout only checks for an edge that is already seen
+ */
+static uint8_t a_bmp180_wait_eoc(bmp180_handle_t *handle, uint32_t us)
+{
+    uint8_t res;
+    
+    if (handle->wait_eoc_ctx != NULL)                    /* check wait_eoc_ctx */
     {
-        handle->debug_print("bmp180: iic init failed.\n");                               /* iic init failed */
+        res = handle->wait_eoc_ctx(handle->user, us);    /* wait with the context */
+    }
+    else
+    {
+        res = handle->wait_eoc(us);                      /* wait */
+    }
+    
+    return (res != 0) ? 1 : 0;                           /* return the result */
+}
+
+/**
+ * @brief     write a measurement command
+ * @param[in] *handle pointer to a bmp180 handle structure
+ * @param[in] cmd measurement command
+ * @param[in] state conversion state after the command
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+static uint8_t a_bmp180_start(bmp180_handle_t *handle, uint8_t cmd, bmp180_state_t state)
+{
+    if (a_bmp180_iic_write(handle, BMP180_REG_CTRL_MEAS, cmd) != 0)            /* write measurement command */
+    {
+        handle->debug_print("bmp180: write CTRL_MEAS failed.\n");              /* write CTRL_MEAS failed */
+        handle->state = BMP180_STATE_IDLE;                                     /* nothing is running */
         
-        return 1;                                                                        /* return error */
+        return 1;                                                              /* return error */
     }
-    if (a_bmp180_iic_read(handle, BMP180_ADDRESS, BMP180_REG_ID, (uint8_t *)&id) != 0)   /* read chip id */
+    handle->out_valid = 0;                                                     /* drop the old burst data */
+    handle->state = (uint8_t)state;                                            /* set the conversion state */
+    (void)a_bmp180_timestamp_ms(handle, &handle->conversion_timestamp);        /* save the start timestamp */
+#if (BMP180_METRICS_ENABLE == 1)
+    handle->conversion_start_ns = a_bmp180_metrics_now(handle);                /* conversion start time */
+    handle->conversion_polls = 0;                                              /* no polls yet */
+#endif
+    
+    return 0;                                                                  /* success return 0 */
+}
+
+/**
+ * @brief      check whether the running conversion is finished
+ * @param[in]  *handle pointer to a bmp180 handle structure
+ * @param[out] *done pointer to a finished flag buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+static uint8_t a_bmp180_check(bmp180_handle_t *handle, bmp180_bool_t *done)
+{
+    uint8_t buf[5];
+    uint16_t len;
+    
+    len = (handle->burst != 0) ? 5 : 1;                                                      /* status or status and data */
+    BMP180_METRICS_INC(handle, polls);                                                       /* count the poll */
+#if (BMP180_METRICS_ENABLE == 1)
+    handle->conversion_polls++;                                                              /* count the conversion poll */
+#endif
+    if (a_bmp180_iic_read(handle, BMP180_REG_CTRL_MEAS, (uint8_t *)buf, len) != 0)           /* read ctrl status */
     {
-        handle->debug_print("bmp180: read id failed.\n");                                /* read id failed */
-        (void)handle->iic_deinit();                                                      /* iic deinit */
+        handle->debug_print("bmp180: read CTRL_MEAS failed.\n");                            /* read CTRL_MEAS failed */
+        handle->state = BMP180_STATE_IDLE;                                                   /* drop the conversion */
         
-        return 1;                                                                        /* return error */
+        return 1;                                                                            /* return error */
     }
-    if (id != 0x55)                                                                      /* check id */
+    if ((buf[0] & BMP180_CTRL_MEAS_SCO) == 0)                                                /* check finished flag */
     {
-        handle->debug_print("bmp180: id is error.\n");                                   /* id is error */
-        (void)handle->iic_deinit();                                                      /* iic deinit */
+        if (handle->burst != 0)                                                              /* burst readout */
+        {
+            memcpy(handle->out, &buf[2], 3);                                                 /* save OUT_MSB-OUT_XLSB */
+            handle->out_valid = 1;                                                           /* flag data valid */
+        }
+        handle->state = handle->state + 1;                                                   /* converting -> ready */
+        *done = BMP180_BOOL_TRUE;                                                            /* finished */
+#if (BMP180_METRICS_ENABLE == 1)
+        a_bmp180_metrics_conversion(handle);                                                 /* count the conversion */
+#endif
+    }
+    else
+    {
+        *done = BMP180_BOOL_FALSE;                                                           /* still running */
+    }
+    
+    return 0;                                                                                /* success return 0 */
+}
+
+/**
+ * @brief     get the datasheet time of the running conversion
+ * @param[in] *handle pointer to a bmp180 handle structure
+ * @return    conversion time in us
+ * @note      none
+ */
+static uint32_t a_bmp180_conversion_time(bmp180_handle_t *handle)
+{
+    if ((handle->state == BMP180_STATE_PRESSURE_CONVERTING) || 
+        (handle->state == BMP180_STATE_PRESSURE_READY))                /* pressure */
+    {
+        return gs_pressure_time_us[handle->conv_oss & 0x03];           /* oss time */
+    }
+    else
+    {
+        return BMP180_TEMPERATURE_TIME_US;                             /* temperature time */
+    }
+}
+
+/**
+ * @brief     wait until the running conversion is finished
+ * @param[in] *handle pointer to a bmp180 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 read failed
+ *            - 2 timeout
+ * @note      none
+ */
+static uint8_t a_bmp180_wait(bmp180_handle_t *handle)
+{
+    uint16_t num;
+    uint32_t us;
+    bmp180_bool_t done;
+    
+    if (handle->wait_mode == (uint8_t)BMP180_WAIT_MODE_TIMED)                 /* timed mode */
+    {
+        us = a_bmp180_conversion_time(handle);                                /* get conversion time */
+        a_bmp180_delay_us(handle, us);                                        /* wait the exact time */
+        handle->state = handle->state + 1;                                    /* converting -> ready */
+#if (BMP180_METRICS_ENABLE == 1)
+        a_bmp180_metrics_conversion(handle);                                  /* count the conversion */
+#endif
         
-        return 4;                                                                        /* return error */
+        return 0;                                                             /* success return 0 */
     }
-    if (handle->iic_read(BMP180_ADDRESS, BMP180_REG_AC1_MSB, (uint8_t *)buf, 22) != 0)   /* read ac1-md */
+    if (handle->wait_mode == (uint8_t)BMP180_WAIT_MODE_EOC)                   /* eoc mode */
     {
-        handle->debug_print("bmp180: read AC1_MSB-MD_LSB failed.\n");                    /* read ac1 -md failed */
-        (void)handle->iic_deinit();                                                      /* deinit iic */
+        us = a_bmp180_conversion_time(handle);                                /* get conversion time */
+        if (a_bmp180_wait_eoc(handle, us + BMP180_EOC_MARGIN_US) == 0)        /* wait the eoc rising edge */
+        {
+            handle->state = handle->state + 1;                                /* converting -> ready */
+#if (BMP180_METRICS_ENABLE == 1)
+            a_bmp180_metrics_conversion(handle);                              /* count the conversion */
+#endif
+            
+            return 0;                                                         /* success return 0 */
+        }
+        handle->debug_print("bmp180: wait eoc failed.\n");                    /* wait eoc failed */
+        BMP180_METRICS_INC(handle, eoc_fallbacks);                            /* count the fallback */
+    }
+    
+    num = BMP180_TIMEOUT_MS;                                                  /* set timeout 5000 ms */
+    while (num != 0)                                                          /* check times */
+    {
+        a_bmp180_delay_ms(handle, 1);                                         /* wait 1 ms */
+        if (a_bmp180_check(handle, &done) != 0)                               /* read status */
+        {
+            return 1;                                                         /* return error */
+        }
+        if (done == BMP180_BOOL_TRUE)                                         /* check flag */
+        {
+            return 0;                                                         /* success return 0 */
+        }
+        num = num - 1;                                                        /* times-1 */
+    }
+    handle->state = BMP180_STATE_IDLE;                                        /* drop the conversion */
+    BMP180_METRICS_INC(handle, timeouts);                                     /* count the timeout */
+    
+    return 2;                                                                 /* return timeout */
+}
+
+/**
+ * @brief      check whether the running conversion can be fetched
+ * @param[in]  *handle pointer to a bmp180 handle structure
+ * @param[out] *done pointer to a finished flag buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the timed mode compares the time since the start with the datasheet time,
+ *             timestamp_ms has a 1 ms resolution, so 1 ms is added to the datasheet time,
+ *             the EOC mode checks for the edge with a zero timeout and reads CTRL_MEAS once
+ *             the edge is later than the datasheet time and the margin or timestamp_ms is missing
+ */
+static uint8_t a_bmp180_fetch_check(bmp180_handle_t *handle, bmp180_bool_t *done)
+{
+    uint32_t elapsed;
+    uint32_t now;
+    
+    if (handle->wait_mode == (uint8_t)BMP180_WAIT_MODE_TIMED)                       /* timed mode */
+    {
+        if (a_bmp180_timestamp_ms(handle, &now) == 0)                               /* check timestamp_ms */
+        {
+            elapsed = now - handle->conversion_timestamp;                           /* get the elapsed time */
+            if ((uint64_t)elapsed * 1000 < 
+                (uint64_t)a_bmp180_conversion_time(handle) + 1000)                  /* check the datasheet time */
+            {
+                *done = BMP180_BOOL_FALSE;                                          /* still running */
+                
+                return 0;                                                           /* success return 0 */
+            }
+        }
+        handle->state = handle->state + 1;                                          /* converting -> ready */
+#if (BMP180_METRICS_ENABLE == 1)
+        a_bmp180_metrics_conversion(handle);                                        /* count the conversion */
+#endif
+        *done = BMP180_BOOL_TRUE;                                                   /* finished */
         
-        return 5;                                                                        /* return error */
+        return 0;                                                                   /* success return 0 */
     }
-    temp1 = buf[0] << 8;                                                                 /* get MSB */
-    temp1 = temp1 | buf[1];                                                              /* get LSB */
-    handle->ac1 = temp1;                                                                 /* save ac1 */
-    temp1 = 0;                                                                           /* reset temp1 */
-    temp1 = buf[2] << 8;                                                                 /* get MSB */
-    temp1 = temp1 | buf[3];                                                              /* get LSB */
-    handle->ac2 = temp1;                                                                 /* save ac2 */
-    temp1 = 0;                                                                           /* reset temp1 */
-    temp1 = buf[4] << 8;                                                                 /* get MSB */
-    temp1 = temp1 | buf[5];                                                              /* get LSB */
-    handle->ac3 = temp1;                                                                 /* save ac3 */
+    if (handle->wait_mode == (uint8_t)BMP180_WAIT_MODE_EOC)                         /* eoc mode */
+    {
+        if (a_bmp180_wait_eoc(handle, 0) == 0)                                      /* check the eoc rising edge */
+        {
+            handle->state = handle->state + 1;                                      /* converting -> ready */
+#if (BMP180_METRICS_ENABLE == 1)
+            a_bmp180_metrics_conversion(handle);                                    /* count the conversion */
+#endif
+            *done = BMP180_BOOL_TRUE;                                               /* finished */
+            
+            return 0;                                                               /* success return 0 */
+        }
+        if (a_bmp180_timestamp_ms(handle, &now) == 0)                               /* check timestamp_ms */
+        {
+            elapsed = now - handle->conversion_timestamp;                           /* get the elapsed time */
+            if ((uint64_t)elapsed * 1000 < 
+                (uint64_t)a_bmp180_conversion_time(handle) + 
+                BMP180_EOC_MARGIN_US + 1000)                                        /* the edge may still come */
+            {
+                *done = BMP180_BOOL_FALSE;                                          /* still running */
+                
+                return 0;                                                           /* success return 0 */
+            }
+        }
+        BMP180_METRICS_INC(handle, eoc_fallbacks);                                  /* count the fallback */
+    }
+    
+    return a_bmp180_check(handle, done);                                            /* read status */
+}
+
+/**
+ * @brief      compensate the raw temperature
+ * @param[in]  *handle pointer to a bmp180 handle structure
+ * @param[in]  ut raw temperature
+ * @param[out] *b5 pointer to a temperature compensation term buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 divisor is zero
+ * @note       none
+ */
+static uint8_t a_bmp180_compensate_temperature(bmp180_handle_t *handle, int32_t ut, int32_t *b5)
+{
+    int32_t x1, x2;
+    
+    x1 = (((ut - (int32_t)handle->ac6) * (int32_t)handle->ac5)) >> 15;                 /* calculate x1 */
+    if ((x1 + (int32_t)handle->md) == 0)                                               /* check the divisor */
+    {
+        return 1;                                                                      /* return error */
+    }
+    x2 = (int32_t)((((int32_t)handle->mc) << 11) / (x1 + (int32_t)handle->md));        /* calculate x2 */
+    *b5 = x1 + x2;                                                                     /* calculate b5 */
+    
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief      calculate the temperature dependent pressure coefficients
+ * @param[in]  *handle pointer to a bmp180 handle structure
+ * @param[in]  b5 temperature compensation term
+ * @param[in]  oss oversampling setting of the conversion
+ * @param[out] *b3 pointer to a b3 buffer
+ * @param[out] *b4 pointer to a b4 buffer
+ * @note       none
+ */
+static void a_bmp180_calculate_coefficients(bmp180_handle_t *handle, int32_t b5, uint8_t oss, int32_t *b3, uint32_t *b4)
+{
+    int32_t x1, x2, x3, b6;
+    
+    b6 = b5 - 4000;                                                                    /* calculate b6 */
+    x1 = ((int32_t)handle->b2 * ((b6 * b6) >> 12)) >> 11;                              /* calculate x1 */
+    x2 = ((int32_t)handle->ac2 * b6) >> 11;                                            /* calculate x2 */
+    x3 = x1 + x2;                                                                      /* calculate x3 */
+    *b3 = (((((int32_t)handle->ac1) * 4 + x3) << oss) + 2) >> 2;                       /* calculate b3 */
+    x1 = ((int32_t)handle->ac3 * b6) >> 13;                                            /* calculate x1 */
+    x2 = ((int32_t)handle->b1 * (((b6 * b6)) >> 12)) >> 16;                            /* calculate x2 */
+    x3 = ((x1 + x2) + 2) >> 2;                                                         /* calculate x3 */
+    *b4 = (uint32_t)((((uint32_t)handle->ac4 * (uint32_t)(x3 + 32768))) >> 15);       /* calculate b4 */
+}
+
+/**
+ * @brief     update the temperature dependent pressure coefficients
+ * @param[in] *handle pointer to a bmp180 handle structure
+ * @param[in] b5 temperature compensation term
+ * @param[in] oss oversampling setting of the conversion
+ * @note      the coefficients are only recalculated when b5 or oss changes
+ */
+static void a_bmp180_update_coefficients(bmp180_handle_t *handle, int32_t b5, uint8_t oss)
+{
+    if ((handle->coef_valid == 1) && (handle->coef_b5 == b5) && (handle->coef_oss == oss))  /* check the cache */
+    {
+        return;                                                                             /* same temperature epoch */
+    }
+    a_bmp180_calculate_coefficients(handle, b5, oss, 
+                                    &handle->coef_b3, &handle->coef_b4);                    /* calculate b3 and b4 */
+    handle->coef_scale = (uint32_t)(50000 >> oss);                                          /* calculate scale */
+    handle->coef_b5 = b5;                                                                   /* save b5 */
+    handle->coef_oss = oss;                                                                 /* save oss */
+    handle->coef_valid = 1;                                                                 /* flag cache valid */
+}
+
+/**
+ * @brief      compensate the shifted raw pressure
+ * @param[in]  up shifted raw pressure
+ * @param[in]  b3 pressure coefficient b3
+ * @param[in]  b4 pressure coefficient b4
+ * @param[in]  scale pressure scale of the oversampling setting
+ * @param[out] *pa pointer to a pressure buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 divisor is zero
+ * @note       none
+ */
+static uint8_t a_bmp180_compensate_pressure(int32_t up, int32_t b3, uint32_t b4, uint32_t scale, uint32_t *pa)
+{
+    int32_t x1, x2, p;
+    uint32_t b7;
+    
+    if (b4 == 0)                                                                   /* check the divisor */
+    {
+        return 1;                                                                  /* return error */
+    }
+    b7 = (uint32_t)((uint32_t)(up - b3) * scale);                                  /* calculate b7 */
+    if (b7 < 0x80000000U)
+    {
+        p = (int32_t)((b7 << 1) / b4);                                             /* calculate p */
+    }
+    else
+    {
+        p = (int32_t)((b7 / b4) << 1);                                             /* calculate p */
+    }
+    x1 = (p >> 8) * (p >> 8);                                                      /* calculate x1 */
+    x1 = (x1 * 3038) >> 16;                                                        /* calculate x1 */
+    x2 = (-7357 * p) >> 16;                                                        /* calculate x2 */
+    *pa = (uint32_t)(p + ((x1 + x2 + 3791) >> 4));                                 /* calculate pressure */
+    
+    return 0;                                                                      /* success return 0 */
+}
+
+/**
+ * @brief      read and compensate the finished temperature conversion
+ * @param[in]  *handle pointer to a bmp180 handle structure
+ * @param[out] *raw pointer to a raw temperature buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+static uint8_t a_bmp180_read_ut(bmp180_handle_t *handle, uint16_t *raw)
+{
+    uint8_t res;
+    uint8_t buf[2];
+    int32_t ut;
+#if (BMP180_METRICS_ENABLE == 1)
+    uint64_t start;
+#endif
+    
+    handle->state = BMP180_STATE_IDLE;                                                 /* conversion is consumed */
+    memset(buf, 0, sizeof(uint8_t) * 2);                                               /* clear the buffer */
+    if (handle->out_valid == 1)                                                        /* data came with the status */
+    {
+        handle->out_valid = 0;                                                         /* data is consumed */
+        memcpy(buf, handle->out, 2);                                                   /* copy OUT_MSB-OUT_LSB */
+    }
+    else if (a_bmp180_iic_read(handle, BMP180_REG_OUT_MSB, (uint8_t *)buf, 2) != 0)    /* read raw temperature */
+    {
+        handle->debug_print("bmp180: read OUT MSB LSB failed.\n");                     /* read OUT MSB LSB failed */
+        
+        return 1;                                                                      /* return error */
+    }
+    ut = buf[0] << 8;                                                                  /* get MSB */
+    ut = ut | buf[1];                                                                  /* get LSB */
+    ut = ut & 0x0000FFFFU;                                                             /* set mask */
+#if (BMP180_METRICS_ENABLE == 1)
+    start = a_bmp180_metrics_now(handle);                                              /* compensation start time */
+#endif
+    res = a_bmp180_compensate_temperature(handle, ut, &handle->b5);                    /* compensate */
+#if (BMP180_METRICS_ENABLE == 1)
+    a_bmp180_metrics_record(handle, handle->metrics.compensation_ns, start);           /* compensation latency */
+#endif
+    if (res != 0)                                                                      /* check the result */
+    {
+        BMP180_METRICS_INC(handle, compensation_errors);                               /* count the error */
+        handle->debug_print("bmp180: compensate temperature failed.\n");              /* compensate temperature failed */
+        
+        return 1;                                                                      /* return error */
+    }
+    handle->ut = (uint16_t)ut;                                                         /* save raw temperature */
+    handle->temperature_valid = 1;                                                     /* flag temperature valid */
+    handle->reuse_count = 0;                                                           /* reset reuse counter */
+    (void)a_bmp180_timestamp_ms(handle, &handle->temperature_timestamp);               /* save timestamp */
+    *raw = (uint16_t)ut;                                                               /* get raw temperature */
+    
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief      read and compensate the finished pressure conversion
+ * @param[in]  *handle pointer to a bmp180 handle structure
+ * @param[out] *raw pointer to a raw pressure buffer
+ * @param[out] *pa pointer to a converted pressure buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+static uint8_t a_bmp180_read_up(bmp180_handle_t *handle, uint32_t *raw, uint32_t *pa)
+{
+    uint8_t res;
+    uint8_t buf[3];
+    int32_t up;
+#if (BMP180_METRICS_ENABLE == 1)
+    uint64_t start;
+#endif
+    
+    handle->state = BMP180_STATE_IDLE;                                                 /* conversion is consumed */
+    memset(buf, 0, sizeof(uint8_t) * 3);                                               /* clear the buffer */
+    if (handle->out_valid == 1)                                                        /* data came with the status */
+    {
+        handle->out_valid = 0;                                                         /* data is consumed */
+        memcpy(buf, handle->out, 3);                                                   /* copy OUT_MSB-OUT_XLSB */
+    }
+    else if (a_bmp180_iic_read(handle, BMP180_REG_OUT_MSB, (uint8_t *)buf, 3) != 0)    /* read raw pressure */
+    {
+        handle->debug_print("bmp180: read OUT MSB LSB XLSB failed.\n");                /* read OUT MSB LSB XLSB failed */
+        
+        return 1;                                                                      /* return error */
+    }
+    up = buf[0] << 8;                                                                  /* get MSB */
+    up = up | buf[1];                                                                  /* get LSB */
+    up = up << 8;                                                                      /* left shift 8 */
+    up = up | buf[2];                                                                  /* get XLSB */
+    *raw = (uint32_t)up;                                                               /* get raw data */
+    up = up >> (8 - handle->conv_oss);                                                 /* shift */
+    up = up & (int32_t)(0x0007FFFFU >> (3 - handle->conv_oss));                        /* set mask */
+#if (BMP180_METRICS_ENABLE == 1)
+    start = a_bmp180_metrics_now(handle);                                              /* compensation start time */
+#endif
+    a_bmp180_update_coefficients(handle, handle->b5, handle->conv_oss);                /* update the coefficients */
+    res = a_bmp180_compensate_pressure(up, handle->coef_b3, handle->coef_b4, 
+                                       handle->coef_scale, pa);                        /* compensate */
+#if (BMP180_METRICS_ENABLE == 1)
+    a_bmp180_metrics_record(handle, handle->metrics.compensation_ns, start);           /* compensation latency */
+#endif
+    if (res != 0)                                                                      /* check the result */
+    {
+        BMP180_METRICS_INC(handle, compensation_errors);                               /* count the error */
+        handle->debug_print("bmp180: compensate pressure failed.\n");                 /* compensate pressure failed */
+        
+        return 1;                                                                      /* return error */
+    }
+    if (handle->reuse_count < 0xFFFFU)                                                 /* check counter */
+    {
+        handle->reuse_count++;                                                         /* count the pressure sample */
+    }
+    
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief     check whether the cached temperature must be refreshed
+ * @param[in] *handle pointer to a bmp180 handle structure
+ * @return    expired flag
+ * @note      none
+ */
+static bmp180_bool_t a_bmp180_temperature_expired(bmp180_handle_t *handle)
+{
+    uint32_t now;
+    
+    if (handle->temperature_valid != 1)                                                   /* no temperature */
+    {
+        return BMP180_BOOL_TRUE;                                                          /* expired */
+    }
+    if ((handle->reuse_samples == 0) && (handle->reuse_ms == 0))                          /* reuse is disabled */
+    {
+        return BMP180_BOOL_TRUE;                                                          /* expired */
+    }
+    if ((handle->reuse_samples != 0) && (handle->reuse_count >= handle->reuse_samples))   /* check samples */
+    {
+        return BMP180_BOOL_TRUE;                                                          /* expired */
+    }
+    if ((handle->reuse_ms != 0) && (a_bmp180_timestamp_ms(handle, &now) == 0) &&
+        ((uint32_t)(now - handle->temperature_timestamp) >= 
+         handle->reuse_ms))                                                               /* check age */
+    {
+        return BMP180_BOOL_TRUE;                                                          /* expired */
+    }
+    
+    return BMP180_BOOL_FALSE;                                                             /* reuse the temperature */
+}
+
+/**
+ * @brief     run a temperature conversion and wait for it
+ * @param[in] *handle pointer to a bmp180 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 conversion failed
+ * @note      none
+ */
+static uint8_t a_bmp180_convert_temperature(bmp180_handle_t *handle)
+{
+    uint8_t res;
+    
+    if (a_bmp180_start(handle, BMP180_CMD_TEMPERATURE, 
+                       BMP180_STATE_TEMPERATURE_CONVERTING) != 0)        /* write temperature measurement command */
+    {
+        return 1;                                                        /* return error */
+    }
+    res = a_bmp180_wait(handle);                                         /* wait the conversion */
+    if (res == 2)                                                        /* timeout */
+    {
+        handle->debug_print("bmp180: read temperature failed.\n");       /* read temperature failed */
+    }
+    
+    return (res != 0) ? 1 : 0;                                           /* return the result */
+}
+
+/**
+ * @brief     run a pressure conversion and wait for it
+ * @param[in] *handle pointer to a bmp180 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 conversion failed
+ * @note      none
+ */
+static uint8_t a_bmp180_convert_pressure(bmp180_handle_t *handle)
+{
+    uint8_t res;
+    
+    if (handle->oss > 3)                                                 /* check oss */
+    {
+        handle->debug_print("bmp180: oss param error.\n");               /* oss param error */
+        
+        return 1;                                                        /* return error */
+    }
+    handle->conv_oss = handle->oss;                                      /* latch oss */
+    if (a_bmp180_start(handle, (uint8_t)(BMP180_CMD_PRESSURE + (handle->oss << 6)), 
+                       BMP180_STATE_PRESSURE_CONVERTING) != 0)           /* write pressure measurement command */
+    {
+        return 1;                                                        /* return error */
+    }
+    res = a_bmp180_wait(handle);                                         /* wait the conversion */
+    if (res == 2)                                                        /* timeout */
+    {
+        handle->debug_print("bmp180: read pressure failed.\n");          /* read pressure failed */
+    }
+    
+    return (res != 0) ? 1 : 0;                                           /* return the result */
+}
+
+/**
+ * @brief     check the linked functions
+ * @param[in] *handle pointer to a bmp180 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 3 linked functions is NULL
+ * @note      none
+ */
+static uint8_t a_bmp180_check_link(bmp180_handle_t *handle)
+{
+    if (handle->debug_print == NULL)                                                     /* check debug_print */
+    {
+        return 3;                                                                        /* return error */
+    }
+    if ((handle->iic_init == NULL) && (handle->iic_init_ctx == NULL))                    /* check iic_init */
+    {
+        handle->debug_print("bmp180: iic_init is null.\n");                              /* iic_init is nul */
+        
+        return 3;                                                                        /* return error */
+    }
+    if ((handle->iic_deinit == NULL) && (handle->iic_deinit_ctx == NULL))                /* check iic_deinit */
+    {
+        handle->debug_print("bmp180: iic_deinit is null.\n");                            /* iic_deinit is null */
+        
+        return 3;                                                                        /* return error */
+    }
+    if ((handle->iic_read == NULL) && (handle->iic_read_ctx == NULL))                    /* check iic_read */
+    {
+        handle->debug_print("bmp180: iic_read is null.\n");                              /* iic_read is null */
+        
+        return 3;                                                                        /* return error */
+    }
+    if ((handle->iic_write == NULL) && (handle->iic_write_ctx == NULL))                  /* check iic_write */
+    {
+        handle->debug_print("bmp180: iic_write is null.\n");                             /* iic_write is null */
+        
+        return 3;                                                                        /* return error */
+    }
+    if ((handle->delay_ms == NULL) && (handle->delay_ms_ctx == NULL))                    /* check delay_ms */
+    {
+        handle->debug_print("bmp180: delay_ms is null.\n");                              /* delay_ms is null */
+        
+        return 3;                                                                        /* return error */
+    }
+    
+    return 0;                                                                            /* success return 0 */
+}
+
+/**
+ * @brief     parse the calibration block
+ * @param[in] *handle pointer to a bmp180 handle structure
+ * @param[in] *buf pointer to the 22 bytes of ac1-md
+ * @note      none
+ */
+static void a_bmp180_parse_calibration(bmp180_handle_t *handle, const uint8_t *buf)
+{
+    int16_t temp1 = 0;
+    uint16_t temp2 = 0;
+    
+    temp1 = buf[0] << 8;                                                                 /* get MSB */
+    temp1 = temp1 | buf[1];                                                              /* get LSB */
+    handle->ac1 = temp1;                                                                 /* save ac1 */
+    temp1 = 0;                                                                           /* reset temp1 */
+    temp1 = buf[2] << 8;                                                                 /* get MSB */
+    temp1 = temp1 | buf[3];                                                              /* get LSB */
+    handle->ac2 = temp1;                                                                 /* save ac2 */
+    temp1 = 0;                                                                           /* reset temp1 */
+    temp1 = buf[4] << 8;                                                                 /* get MSB */
+    temp1 = temp1 | buf[5];                                                              /* get LSB */
+    handle->ac3 = temp1;                                                                 /* save ac3 */
     temp1 = 0;                                                                           /* reset temp1 */
     temp2 = buf[6] << 8;                                                                 /* get MSB */
     temp2 = temp2 | buf[7];                                                              /* get LSB */
@@ -259,506 +1070,1199 @@ uint8_t bmp180_init(bmp180_handle_t *handle)
     temp1 = buf[20] << 8;                                                                /* get MSB */
     temp1 = temp1 | buf[21];                                                             /* get LSB */
     handle->md = temp1;                                                                  /* save md */
-    handle->inited = 1;                                                                  /* flag finish initialization */
+}
+
+/**
+ * @brief     calculate the crc16 of the calibration blob
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len data length
+ * @return    crc16 ccitt
+ * @note      polynomial 0x1021, initial value 0xFFFF
+ */
+static uint16_t a_bmp180_crc16(const uint8_t *buf, uint16_t len)
+{
+    uint16_t crc = 0xFFFFU;
+    uint16_t i;
+    uint8_t j;
+    
+    for (i = 0; i < len; i++)                                                            /* run all bytes */
+    {
+        crc ^= (uint16_t)((uint16_t)buf[i] << 8);                                        /* xor the byte */
+        for (j = 0; j < 8; j++)                                                          /* run all bits */
+        {
+            if ((crc & 0x8000U) != 0)                                                    /* check msb */
+            {
+                crc = (uint16_t)((crc << 1) ^ 0x1021U);                                  /* shift and xor */
+            }
+            else
+            {
+                crc = (uint16_t)(crc << 1);                                              /* shift */
+            }
+        }
+    }
+    
+    return crc;                                                                          /* return crc */
+}
+
+/**
+ * @brief     initialize the chip
+ * @param[in] *handle pointer to a bmp180 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic initialization failed
+ *            - 2 handle is NULL
+ *            - 3 linked functions is NULL
+ *            - 4 id is error
+  *           - 5 read calibration failed
+ * @note      none
+ */
+uint8_t bmp180_init(bmp180_handle_t *handle)
+{
+    uint8_t buf[22];
+    uint8_t id;
+    
+    if (handle == NULL)                                                                  /* check handle */
+    {
+        return 2;                                                                        /* return error */
+    }
+    if (a_bmp180_check_link(handle) != 0)                                                /* check linked functions */
+    {
+        return 3;                                                                        /* return error */
+    }
+    
+    if (a_bmp180_iic_init(handle) != 0)                                                  /* iic init */
+    {
+        handle->debug_print("bmp180: iic init failed.\n");                               /* iic init failed */
+        
+        return 1;                                                                        /* return error */
+    }
+    if (a_bmp180_iic_read(handle, BMP180_REG_ID, (uint8_t *)&id, 1) != 0)                /* read chip id */
+    {
+        handle->debug_print("bmp180: read id failed.\n");                                /* read id failed */
+        (void)a_bmp180_iic_deinit(handle);                                               /* iic deinit */
+        
+        return 1;                                                                        /* return error */
+    }
+    if (id != 0x55)                                                                      /* check id */
+    {
+        handle->debug_print("bmp180: id is error.\n");                                   /* id is error */
+        (void)a_bmp180_iic_deinit(handle);                                               /* iic deinit */
+        
+        return 4;                                                                        /* return error */
+    }
+    if (a_bmp180_iic_read(handle, BMP180_REG_AC1_MSB, (uint8_t *)buf, 22) != 0)          /* read ac1-md */
+    {
+        handle->debug_print("bmp180: read AC1_MSB-MD_LSB failed.\n");                    /* read ac1 -md failed */
+        (void)a_bmp180_iic_deinit(handle);                                               /* deinit iic */
+        
+        return 5;                                                                        /* return error */
+    }
+    a_bmp180_parse_calibration(handle, (uint8_t *)buf);                                  /* parse ac1-md */
+    handle->state = BMP180_STATE_IDLE;                                                   /* no conversion in flight */
+    handle->temperature_valid = 0;                                                       /* no temperature yet */
+    handle->coef_valid = 0;                                                              /* no coefficients yet */
+    handle->out_valid = 0;                                                               /* no burst data yet */
+    handle->inited = 1;                                                                  /* flag finish initialization */
+    
+    return 0;                                                                            /* success return 0 */
+}
+
+/**
+ * @brief     initialize the chip with a saved calibration blob
+ * @param[in] *handle pointer to a bmp180 handle structure
+ * @param[in] *buf pointer to a calibration blob
+ * @param[in] len blob length
+ * @param[in] check_id bool value, false skips the chip id read
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic initialization failed
+ *            - 2 handle is NULL
+ *            - 3 linked functions is NULL
+ *            - 4 id is error
+ *            - 6 calibration blob is invalid
+ * @note      the blob comes from bmp180_export_calibration and skips the calibration burst read
+ */
+uint8_t bmp180_init_with_calibration(bmp180_handle_t *handle, const uint8_t *buf, uint16_t len, bmp180_bool_t check_id)
+{
+    uint16_t crc;
+    uint8_t id;
+    
+    if (handle == NULL)                                                                  /* check handle */
+    {
+        return 2;                                                                        /* return error */
+    }
+    if (a_bmp180_check_link(handle) != 0)                                                /* check linked functions */
+    {
+        return 3;                                                                        /* return error */
+    }
+    if ((len < BMP180_CALIBRATION_SIZE) || (buf[0] != 0x55) || 
+        (buf[1] != BMP180_CALIBRATION_VERSION))                                          /* check the header */
+    {
+        handle->debug_print("bmp180: calibration blob is invalid.\n");                   /* calibration blob is invalid */
+        
+        return 6;                                                                        /* return error */
+    }
+    crc = (uint16_t)(((uint16_t)buf[24] << 8) | buf[25]);                                /* get crc */
+    if (a_bmp180_crc16(buf, 24) != crc)                                                  /* check crc */
+    {
+        handle->debug_print("bmp180: calibration crc is error.\n");                      /* calibration crc is error */
+        
+        return 6;                                                                        /* return error */
+    }
+    
+    if (a_bmp180_iic_init(handle) != 0)                                                  /* iic init */
+    {
+        handle->debug_print("bmp180: iic init failed.\n");                               /* iic init failed */
+        
+        return 1;                                                                        /* return error */
+    }
+    if (check_id == BMP180_BOOL_TRUE)                                                    /* check the chip id */
+    {
+        if (a_bmp180_iic_read(handle, BMP180_REG_ID, (uint8_t *)&id, 1) != 0)            /* read chip id */
+        {
+            handle->debug_print("bmp180: read id failed.\n");                            /* read id failed */
+            (void)a_bmp180_iic_deinit(handle);                                           /* iic deinit */
+            
+            return 1;                                                                    /* return error */
+        }
+        if (id != 0x55)                                                                  /* check id */
+        {
+            handle->debug_print("bmp180: id is error.\n");                               /* id is error */
+            (void)a_bmp180_iic_deinit(handle);                                           /* iic deinit */
+            
+            return 4;                                                                    /* return error */
+        }
+    }
+    a_bmp180_parse_calibration(handle, &buf[2]);                                         /* parse ac1-md */
+    handle->state = BMP180_STATE_IDLE;                                                   /* no conversion in flight */
+    handle->temperature_valid = 0;                                                       /* no temperature yet */
+    handle->coef_valid = 0;                                                              /* no coefficients yet */
+    handle->out_valid = 0;                                                               /* no burst data yet */
+    handle->inited = 1;                                                                  /* flag finish initialization */
+    
+    return 0;                                                                            /* success return 0 */
+}
+
+/**
+ * @brief      export the calibration as a crc protected blob
+ * @param[in]  *handle pointer to a bmp180 handle structure
+ * @param[out] *buf pointer to a blob buffer
+ * @param[in]  len buffer length
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 buffer is too small
+ * @note       the blob is BMP180_CALIBRATION_SIZE bytes: 0x55, version, ac1-md in chip order and crc16
+ */
+uint8_t bmp180_export_calibration(bmp180_handle_t *handle, uint8_t *buf, uint16_t len)
+{
+    uint16_t crc;
+    
+    if (handle == NULL)                                                                  /* check handle */
+    {
+        return 2;                                                                        /* return error */
+    }
+    if (handle->inited != 1)                                                             /* check handle initialization */
+    {
+        return 3;                                                                        /* return error */
+    }
+    if (len < BMP180_CALIBRATION_SIZE)                                                   /* check length */
+    {
+        handle->debug_print("bmp180: buffer is too small.\n");                           /* buffer is too small */
+        
+        return 4;                                                                        /* return error */
+    }
+    
+    buf[0] = 0x55;                                                                       /* chip id */
+    buf[1] = BMP180_CALIBRATION_VERSION;                                                 /* version */
+    buf[2] = (uint8_t)(((uint16_t)handle->ac1 >> 8) & 0xFF);                             /* ac1 MSB */
+    buf[3] = (uint8_t)((uint16_t)handle->ac1 & 0xFF);                                    /* ac1 LSB */
+    buf[4] = (uint8_t)(((uint16_t)handle->ac2 >> 8) & 0xFF);                             /* ac2 MSB */
+    buf[5] = (uint8_t)((uint16_t)handle->ac2 & 0xFF);                                    /* ac2 LSB */
+    buf[6] = (uint8_t)(((uint16_t)handle->ac3 >> 8) & 0xFF);                             /* ac3 MSB */
+    buf[7] = (uint8_t)((uint16_t)handle->ac3 & 0xFF);                                    /* ac3 LSB */
+    buf[8] = (uint8_t)((handle->ac4 >> 8) & 0xFF);                                       /* ac4 MSB */
+    buf[9] = (uint8_t)(handle->ac4 & 0xFF);                                              /* ac4 LSB */
+    buf[10] = (uint8_t)((handle->ac5 >> 8) & 0xFF);                                      /* ac5 MSB */
+    buf[11] = (uint8_t)(handle->ac5 & 0xFF);                                             /* ac5 LSB */
+    buf[12] = (uint8_t)((handle->ac6 >> 8) & 0xFF);                                      /* ac6 MSB */
+    buf[13] = (uint8_t)(handle->ac6 & 0xFF);                                             /* ac6 LSB */
+    buf[14] = (uint8_t)(((uint16_t)handle->b1 >> 8) & 0xFF);                             /* b1 MSB */
+    buf[15] = (uint8_t)((uint16_t)handle->b1 & 0xFF);                                    /* b1 LSB */
+    buf[16] = (uint8_t)(((uint16_t)handle->b2 >> 8) & 0xFF);                             /* b2 MSB */
+    buf[17] = (uint8_t)((uint16_t)handle->b2 & 0xFF);                                    /* b2 LSB */
+    buf[18] = (uint8_t)(((uint16_t)handle->mb >> 8) & 0xFF);                             /* mb MSB */
+    buf[19] = (uint8_t)((uint16_t)handle->mb & 0xFF);                                    /* mb LSB */
+    buf[20] = (uint8_t)(((uint16_t)handle->mc >> 8) & 0xFF);                             /* mc MSB */
+    buf[21] = (uint8_t)((uint16_t)handle->mc & 0xFF);                                    /* mc LSB */
+    buf[22] = (uint8_t)(((uint16_t)handle->md >> 8) & 0xFF);                             /* md MSB */
+    buf[23] = (uint8_t)((uint16_t)handle->md & 0xFF);                                    /* md LSB */
+    crc = a_bmp180_crc16(buf, 24);                                                       /* calculate crc */
+    buf[24] = (uint8_t)((crc >> 8) & 0xFF);                                              /* crc MSB */
+    buf[25] = (uint8_t)(crc & 0xFF);                                                     /* crc LSB */
+    
+    return 0;                                                                            /* success return 0 */
+}
+
+/**
+ * @brief     close the chip
+ * @param[in] *handle pointer to a bmp180 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic deinit failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t bmp180_deinit(bmp180_handle_t *handle)
+{
+    if (handle == NULL)                                             /* check handle */
+    {
+        return 2;                                                   /* return error */
+    }
+    if (handle->inited != 1)                                        /* check handle initialization */
+    {
+        return 3;                                                   /* return error */
+    }
+    
+    if (a_bmp180_iic_deinit(handle) != 0)                           /* iic deinit */
+    {
+        handle->debug_print("bmp180: iic deinit failed.\n");        /* iic deinit failed */
+        
+        return 1;                                                   /* return error */
+    }   
+    handle->inited = 0;                                             /* flag close */
+    
+    return 0;                                                       /* success return 0 */
+}
+
+/**
+ * @brief     set the measurement mode
+ * @param[in] *handle pointer to a bmp180 handle structure
+ * @param[in] mode measurement mode
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t bmp180_set_mode(bmp180_handle_t *handle, bmp180_mode_t mode)
+{
+    if (handle == NULL)                 /* check handle */
+    {
+        return 2;                       /* return error */
+    }
+    if (handle->inited != 1)            /* check handle initialization */
+    {
+        return 3;                       /* return error */
+    }
+    
+    handle->oss = (uint8_t)mode;        /* set mode */
+    
+    return 0;                           /* success return 0 */
+}
+
+/**
+ * @brief      get the measurement mode
+ * @param[in]  *handle pointer to a bmp180 handle structure
+ * @param[out] *mode pointer to a measurement mode buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t bmp180_get_mode(bmp180_handle_t *handle, bmp180_mode_t *mode)
+{
+    if (handle == NULL)                        /* check handle */
+    {
+        return 2;                              /* return error */
+    }
+    if (handle->inited != 1)                   /* check handle initialization */
+    {
+        return 3;                              /* return error */
+    }
+    
+    *mode = (bmp180_mode_t)handle->oss;        /* get mode */
+    
+    return 0;                                  /* success return 0 */
+}
+
+/**
+ * @brief      read the pressure data
+ * @param[in]  *handle pointer to a bmp180 handle structure
+ * @param[out] *raw pointer to a raw pressure buffer
+ * @param[out] *pa pointer to a converted pressure buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 pressure read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the temperature conversion is skipped while the temperature reuse policy allows it
+ */
+uint8_t bmp180_read_pressure(bmp180_handle_t *handle, uint32_t *raw, uint32_t *pa)
+{
+    uint16_t ut;
+    
+    if (handle == NULL)                                             /* check handle */
+    {
+        return 2;                                                   /* return error */
+    }
+    if (handle->inited != 1)                                        /* check handle initialization */
+    {
+        return 3;                                                   /* return error */
+    }
+    
+    if (a_bmp180_temperature_expired(handle) == BMP180_BOOL_TRUE)   /* check the cached temperature */
+    {
+        if (a_bmp180_convert_temperature(handle) != 0)              /* run temperature conversion */
+        {
+            return 1;                                               /* return error */
+        }
+        if (a_bmp180_read_ut(handle, (uint16_t *)&ut) != 0)         /* read raw temperature */
+        {
+            return 1;                                               /* return error */
+        }
+    }
+    if (a_bmp180_convert_pressure(handle) != 0)                     /* run pressure conversion */
+    {
+        return 1;                                                   /* return error */
+    }
+    if (a_bmp180_read_up(handle, raw, pa) != 0)                     /* read pressure */
+    {
+        return 1;                                                   /* return error */
+    }
+    
+    return 0;                                                       /* success return 0 */
+}
+
+/**
+ * @brief      read the temperature data
+ * @param[in]  *handle pointer to a bmp180 handle structure
+ * @param[out] *raw pointer to a raw temperature buffer
+ * @param[out] *temperature pointer to a temperature buffer in 0.1 degrees celsius
+ * @return     status code
+ *             - 0 success
+ *             - 1 temperature read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t bmp180_read_temperature_fixed(bmp180_handle_t *handle, uint16_t *raw, int32_t *temperature)
+{
+    if (handle == NULL)                                              /* check handle */
+    {
+        return 2;                                                    /* return error */
+    }
+    if (handle->inited != 1)                                         /* check handle initialization */
+    {
+        return 3;                                                    /* return error */
+    }
+    
+    if (a_bmp180_convert_temperature(handle) != 0)                   /* run temperature conversion */
+    {
+        return 1;                                                    /* return error */
+    }
+    if (a_bmp180_read_ut(handle, raw) != 0)                          /* read raw temperature */
+    {
+        return 1;                                                    /* return error */
+    }
+    *temperature = (handle->b5 + 8) >> 4;                            /* calculate temperature */
+    
+    return 0;                                                        /* success return 0 */
+}
+
+#if (BMP180_FLOAT_ENABLE == 1)
+
+/**
+ * @brief      read the temperature data
+ * @param[in]  *handle pointer to a bmp180 handle structure
+ * @param[out] *raw pointer to a raw temperature buffer
+ * @param[out] *c pointer to a converted temperature buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 temperature read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       only built when BMP180_FLOAT_ENABLE is 1
+ */
+uint8_t bmp180_read_temperature(bmp180_handle_t *handle, uint16_t *raw, float *c)
+{
+    uint8_t res;
+    int32_t temperature;
+    
+    res = bmp180_read_temperature_fixed(handle, raw, &temperature);         /* read the fixed point temperature */
+    if (res != 0)                                                           /* check the result */
+    {
+        return res;                                                         /* return error */
+    }
+    *c = (float)temperature * 0.1f;                                         /* convert to float */
+    
+    return 0;                                                               /* success return 0 */
+}
+
+#endif
+
+/**
+ * @brief      read the temperature and pressure data
+ * @param[in]  *handle pointer to a bmp180 handle structure
+ * @param[out] *temperature_raw pointer to a raw temperature buffer
+ * @param[out] *temperature pointer to a temperature buffer in 0.1 degrees celsius
+ * @param[out] *pressure_raw pointer to a raw pressure buffer
+ * @param[out] *pressure_pa pointer to a converted pressure buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t bmp180_read_temperature_pressure_fixed(bmp180_handle_t *handle, uint16_t *temperature_raw, int32_t *temperature, 
+                                               uint32_t *pressure_raw, uint32_t *pressure_pa)
+{
+    if (handle == NULL)                                                        /* check handle */
+    {
+        return 2;                                                              /* return error */
+    }
+    if (handle->inited != 1)                                                   /* check handle initialization */
+    {
+        return 3;                                                              /* return error */
+    }
+    
+    if (a_bmp180_convert_temperature(handle) != 0)                             /* run temperature conversion */
+    {
+        return 1;                                                              /* return error */
+    }
+    if (a_bmp180_read_ut(handle, temperature_raw) != 0)                        /* read raw temperature */
+    {
+        return 1;                                                              /* return error */
+    }
+    if (a_bmp180_convert_pressure(handle) != 0)                                /* run pressure conversion */
+    {
+        return 1;                                                              /* return error */
+    }
+    if (a_bmp180_read_up(handle, pressure_raw, pressure_pa) != 0)              /* read raw pressure */
+    {
+        return 1;                                                              /* return error */
+    }
+    *temperature = (handle->b5 + 8) >> 4;                                      /* get temperature */
+    
+    return 0;                                                                  /* success return 0 */
+}
+
+#if (BMP180_FLOAT_ENABLE == 1)
+
+/**
+ * @brief      read the temperature and pressure data
+ * @param[in]  *handle pointer to a bmp180 handle structure
+ * @param[out] *temperature_raw pointer to a raw temperature buffer
+ * @param[out] *temperature_c pointer to a converted temperature buffer
+ * @param[out] *pressure_raw pointer to a raw pressure buffer
+ * @param[out] *pressure_pa pointer to a converted pressure buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       only built when BMP180_FLOAT_ENABLE is 1
+ */
+uint8_t bmp180_read_temperature_pressure(bmp180_handle_t *handle, uint16_t *temperature_raw, float *temperature_c, 
+                                         uint32_t *pressure_raw, uint32_t *pressure_pa)
+{
+    uint8_t res;
+    int32_t temperature;
+    
+    res = bmp180_read_temperature_pressure_fixed(handle, temperature_raw, &temperature, 
+                                                 pressure_raw, pressure_pa);        /* read the fixed point temperature */
+    if (res != 0)                                                           /* check the result */
+    {
+        return res;                                                         /* return error */
+    }
+    *temperature_c = (float)temperature * 0.1f;                             /* convert to float */
+    
+    return 0;                                                               /* success return 0 */
+}
+
+#endif
+
+/**
+ * @brief     start a temperature conversion without waiting
+ * @param[in] *handle pointer to a bmp180 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 conversion is running
+ * @note      fetch the result with bmp180_fetch_temperature
+ */
+uint8_t bmp180_start_temperature(bmp180_handle_t *handle)
+{
+    if (handle == NULL)                                                          /* check handle */
+    {
+        return 2;                                                                /* return error */
+    }
+    if (handle->inited != 1)                                                     /* check handle initialization */
+    {
+        return 3;                                                                /* return error */
+    }
+    if ((handle->state == BMP180_STATE_TEMPERATURE_CONVERTING) || 
+        (handle->state == BMP180_STATE_PRESSURE_CONVERTING))                     /* check state */
+    {
+        handle->debug_print("bmp180: conversion is running.\n");                 /* conversion is running */
+        
+        return 4;                                                                /* return error */
+    }
+    
+    return a_bmp180_start(handle, BMP180_CMD_TEMPERATURE, 
+                          BMP180_STATE_TEMPERATURE_CONVERTING);                  /* write temperature measurement command */
+}
+
+/**
+ * @brief     start a pressure conversion without waiting
+ * @param[in] *handle pointer to a bmp180 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 conversion is running
+ *            - 5 no temperature has been fetched
+ * @note      the pressure is compensated with the last fetched temperature
+ */
+uint8_t bmp180_start_pressure(bmp180_handle_t *handle)
+{
+    if (handle == NULL)                                                          /* check handle */
+    {
+        return 2;                                                                /* return error */
+    }
+    if (handle->inited != 1)                                                     /* check handle initialization */
+    {
+        return 3;                                                                /* return error */
+    }
+    if ((handle->state == BMP180_STATE_TEMPERATURE_CONVERTING) || 
+        (handle->state == BMP180_STATE_PRESSURE_CONVERTING))                     /* check state */
+    {
+        handle->debug_print("bmp180: conversion is running.\n");                 /* conversion is running */
+        
+        return 4;                                                                /* return error */
+    }
+    if (handle->temperature_valid != 1)                                          /* check temperature */
+    {
+        handle->debug_print("bmp180: no temperature has been fetched.\n");       /* no temperature */
+        
+        return 5;                                                                /* return error */
+    }
+    if (handle->oss > 3)                                                         /* check oss */
+    {
+        handle->debug_print("bmp180: oss param error.\n");                       /* oss param error */
+        
+        return 1;                                                                /* return error */
+    }
+    
+    handle->conv_oss = handle->oss;                                              /* latch oss */
+    
+    return a_bmp180_start(handle, (uint8_t)(BMP180_CMD_PRESSURE + (handle->oss << 6)), 
+                          BMP180_STATE_PRESSURE_CONVERTING);                     /* write pressure measurement command */
+}
+
+/**
+ * @brief      poll the running conversion
+ * @param[in]  *handle pointer to a bmp180 handle structure
+ * @param[out] *ready pointer to a ready flag buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 poll failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 no conversion is started
+ * @note       one status read is issued while the conversion is running
+ */
+uint8_t bmp180_poll_conversion(bmp180_handle_t *handle, bmp180_bool_t *ready)
+{
+    if (handle == NULL)                                                       /* check handle */
+    {
+        return 2;                                                             /* return error */
+    }
+    if (handle->inited != 1)                                                  /* check handle initialization */
+    {
+        return 3;                                                             /* return error */
+    }
+    
+    if ((handle->state == BMP180_STATE_TEMPERATURE_READY) || 
+        (handle->state == BMP180_STATE_PRESSURE_READY))                       /* already finished */
+    {
+        *ready = BMP180_BOOL_TRUE;                                            /* set ready */
+        
+        return 0;                                                             /* success return 0 */
+    }
+    if (handle->state == BMP180_STATE_IDLE)                                   /* check state */
+    {
+        handle->debug_print("bmp180: no conversion is started.\n");           /* no conversion is started */
+        
+        return 4;                                                             /* return error */
+    }
+    
+    return a_bmp180_check(handle, ready);                                     /* read status */
+}
+
+/**
+ * @brief      fetch and compensate a started temperature conversion
+ * @param[in]  *handle pointer to a bmp180 handle structure
+ * @param[out] *raw pointer to a raw temperature buffer
+ * @param[out] *temperature pointer to a temperature buffer in 0.1 degrees celsius
+ * @return     status code
+ *             - 0 success
+ *             - 1 fetch failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 no temperature conversion is started
+ *             - 5 conversion is not finished
+ * @note       the timed mode returns 5 until the datasheet time since the start has passed,
+ *             without timestamp_ms it can't check the time and an early fetch returns stale data,
+ *             the EOC mode returns 5 until wait_eoc has seen the edge and reads CTRL_MEAS for a late edge
+ */
+uint8_t bmp180_fetch_temperature_fixed(bmp180_handle_t *handle, uint16_t *raw, int32_t *temperature)
+{
+    bmp180_bool_t done;
+    
+    if (handle == NULL)                                                              /* check handle */
+    {
+        return 2;                                                                    /* return error */
+    }
+    if (handle->inited != 1)                                                         /* check handle initialization */
+    {
+        return 3;                                                                    /* return error */
+    }
+    
+    if (handle->state == BMP180_STATE_TEMPERATURE_CONVERTING)                        /* conversion is running */
+    {
+        if (a_bmp180_fetch_check(handle, &done) != 0)                                /* check the conversion */
+        {
+            return 1;                                                                /* return error */
+        }
+        if (done == BMP180_BOOL_FALSE)                                               /* check flag */
+        {
+            BMP180_METRICS_INC(handle, busy);                                        /* count the busy return */
+            
+            return 5;                                                                /* return busy */
+        }
+    }
+    if (handle->state != BMP180_STATE_TEMPERATURE_READY)                             /* check state */
+    {
+        handle->debug_print("bmp180: no temperature conversion is started.\n");      /* no temperature conversion */
+        
+        return 4;                                                                    /* return error */
+    }
+    if (a_bmp180_read_ut(handle, raw) != 0)                                          /* read raw temperature */
+    {
+        return 1;                                                                    /* return error */
+    }
+    *temperature = (handle->b5 + 8) >> 4;                                            /* calculate temperature */
+    
+    return 0;                                                                        /* success return 0 */
+}
+
+#if (BMP180_FLOAT_ENABLE == 1)
+
+/**
+ * @brief      fetch and compensate a started temperature conversion
+ * @param[in]  *handle pointer to a bmp180 handle structure
+ * @param[out] *raw pointer to a raw temperature buffer
+ * @param[out] *c pointer to a converted temperature buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 fetch failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 no temperature conversion is started
+ *             - 5 conversion is not finished
+ * @note       only built when BMP180_FLOAT_ENABLE is 1,
+ *             the timed mode returns 5 until the datasheet time since the start has passed,
+ *             without timestamp_ms it can't check the time and an early fetch returns stale data,
+ *             the EOC mode returns 5 until wait_eoc has seen the edge and reads CTRL_MEAS for a late edge
+ */
+uint8_t bmp180_fetch_temperature(bmp180_handle_t *handle, uint16_t *raw, float *c)
+{
+    uint8_t res;
+    int32_t temperature;
+    
+    res = bmp180_fetch_temperature_fixed(handle, raw, &temperature);        /* fetch the fixed point temperature */
+    if (res != 0)                                                           /* check the result */
+    {
+        return res;                                                         /* return error */
+    }
+    *c = (float)temperature * 0.1f;                                         /* convert to float */
+    
+    return 0;                                                               /* success return 0 */
+}
+
+#endif
+
+/**
+ * @brief      fetch and compensate a started pressure conversion
+ * @param[in]  *handle pointer to a bmp180 handle structure
+ * @param[out] *raw pointer to a raw pressure buffer
+ * @param[out] *pa pointer to a converted pressure buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 fetch failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 no pressure conversion is started
+ *             - 5 conversion is not finished
+ * @note       the timed mode returns 5 until the datasheet time since the start has passed,
+ *             without timestamp_ms it can't check the time and an early fetch returns stale data,
+ *             the EOC mode returns 5 until wait_eoc has seen the edge and reads CTRL_MEAS for a late edge
+ */
+uint8_t bmp180_fetch_pressure(bmp180_handle_t *handle, uint32_t *raw, uint32_t *pa)
+{
+    bmp180_bool_t done;
+    
+    if (handle == NULL)                                                              /* check handle */
+    {
+        return 2;                                                                    /* return error */
+    }
+    if (handle->inited != 1)                                                         /* check handle initialization */
+    {
+        return 3;                                                                    /* return error */
+    }
+    
+    if (handle->state == BMP180_STATE_PRESSURE_CONVERTING)                           /* conversion is running */
+    {
+        if (a_bmp180_fetch_check(handle, &done) != 0)                                /* check the conversion */
+        {
+            return 1;                                                                /* return error */
+        }
+        if (done == BMP180_BOOL_FALSE)                                               /* check flag */
+        {
+            BMP180_METRICS_INC(handle, busy);                                        /* count the busy return */
+            
+            return 5;                                                                /* return busy */
+        }
+    }
+    if (handle->state != BMP180_STATE_PRESSURE_READY)                                /* check state */
+    {
+        handle->debug_print("bmp180: no pressure conversion is started.\n");         /* no pressure conversion */
+        
+        return 4;                                                                    /* return error */
+    }
+    
+    return a_bmp180_read_up(handle, raw, pa);                                        /* read raw pressure */
+}
+
+/**
+ * @brief      get the conversion state
+ * @param[in]  *handle pointer to a bmp180 handle structure
+ * @param[out] *state pointer to a conversion state buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t bmp180_get_state(bmp180_handle_t *handle, bmp180_state_t *state)
+{
+    if (handle == NULL)                                  /* check handle */
+    {
+        return 2;                                        /* return error */
+    }
+    if (handle->inited != 1)                             /* check handle initialization */
+    {
+        return 3;                                        /* return error */
+    }
     
-    return 0;                                                                            /* success return 0 */
+    *state = (bmp180_state_t)handle->state;              /* get state */
+    
+    return 0;                                            /* success return 0 */
 }
 
 /**
- * @brief     close the chip
+ * @brief     set the conversion wait mode
  * @param[in] *handle pointer to a bmp180 handle structure
+ * @param[in] mode wait mode
  * @return    status code
  *            - 0 success
- *            - 1 iic deinit failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 4 wait_eoc is null
+ * @note      in the timed mode the fetch functions check the time since the start instead of CTRL_MEAS,
+ *            in the EOC mode they call wait_eoc with a zero timeout instead of reading CTRL_MEAS,
+ *            the EOC mode falls back to polling CTRL_MEAS when wait_eoc fails or the edge is late
  */
-uint8_t bmp180_deinit(bmp180_handle_t *handle)
+uint8_t bmp180_set_wait_mode(bmp180_handle_t *handle, bmp180_wait_mode_t mode)
 {
-    if (handle == NULL)                                             /* check handle */
+    if (handle == NULL)                                            /* check handle */
     {
-        return 2;                                                   /* return error */
+        return 2;                                                  /* return error */
     }
-    if (handle->inited != 1)                                        /* check handle initialization */
+    if (handle->inited != 1)                                       /* check handle initialization */
     {
-        return 3;                                                   /* return error */
+        return 3;                                                  /* return error */
     }
-    
-    if (handle->iic_deinit() != 0)                                  /* iic deinit */
+    if ((mode == BMP180_WAIT_MODE_EOC) && 
+        (handle->wait_eoc == NULL) && 
+        (handle->wait_eoc_ctx == NULL))                            /* check wait_eoc */
     {
-        handle->debug_print("bmp180: iic deinit failed.\n");        /* iic deinit failed */
+        handle->debug_print("bmp180: wait_eoc is null.\n");        /* wait_eoc is null */
         
-        return 1;                                                   /* return error */
-    }   
-    handle->inited = 0;                                             /* flag close */
+        return 4;                                                  /* return error */
+    }
     
-    return 0;                                                       /* success return 0 */
+    handle->wait_mode = (uint8_t)mode;                             /* set wait mode */
+    
+    return 0;                                                      /* success return 0 */
 }
 
 /**
- * @brief     set the measurement mode
+ * @brief      get the conversion wait mode
+ * @param[in]  *handle pointer to a bmp180 handle structure
+ * @param[out] *mode pointer to a wait mode buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t bmp180_get_wait_mode(bmp180_handle_t *handle, bmp180_wait_mode_t *mode)
+{
+    if (handle == NULL)                                   /* check handle */
+    {
+        return 2;                                         /* return error */
+    }
+    if (handle->inited != 1)                              /* check handle initialization */
+    {
+        return 3;                                         /* return error */
+    }
+    
+    *mode = (bmp180_wait_mode_t)handle->wait_mode;        /* get wait mode */
+    
+    return 0;                                             /* success return 0 */
+}
+
+/**
+ * @brief     enable or disable the status and data burst readout
  * @param[in] *handle pointer to a bmp180 handle structure
- * @param[in] mode measurement mode
+ * @param[in] enable bool value
  * @return    status code
  *            - 0 success
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ * @note      the status poll reads CTRL_MEAS and OUT_MSB-OUT_XLSB in one 5 bytes transfer,
+ *            so the data read after the poll is saved, it has no effect in the timed wait mode
  */
-uint8_t bmp180_set_mode(bmp180_handle_t *handle, bmp180_mode_t mode)
+uint8_t bmp180_set_burst_read(bmp180_handle_t *handle, bmp180_bool_t enable)
 {
-    if (handle == NULL)                 /* check handle */
+    if (handle == NULL)                              /* check handle */
     {
-        return 2;                       /* return error */
+        return 2;                                    /* return error */
     }
-    if (handle->inited != 1)            /* check handle initialization */
+    if (handle->inited != 1)                         /* check handle initialization */
     {
-        return 3;                       /* return error */
+        return 3;                                    /* return error */
     }
     
-    handle->oss = (uint8_t)mode;        /* set mode */
+    handle->burst = (uint8_t)enable;                 /* set burst readout */
+    handle->out_valid = 0;                           /* drop the old burst data */
     
-    return 0;                           /* success return 0 */
+    return 0;                                        /* success return 0 */
 }
 
 /**
- * @brief      get the measurement mode
+ * @brief      get the status and data burst readout status
  * @param[in]  *handle pointer to a bmp180 handle structure
- * @param[out] *mode pointer to a measurement mode buffer
+ * @param[out] *enable pointer to a bool value buffer
  * @return     status code
  *             - 0 success
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t bmp180_get_mode(bmp180_handle_t *handle, bmp180_mode_t *mode)
+uint8_t bmp180_get_burst_read(bmp180_handle_t *handle, bmp180_bool_t *enable)
 {
-    if (handle == NULL)                        /* check handle */
+    if (handle == NULL)                              /* check handle */
     {
-        return 2;                              /* return error */
+        return 2;                                    /* return error */
     }
-    if (handle->inited != 1)                   /* check handle initialization */
+    if (handle->inited != 1)                         /* check handle initialization */
     {
-        return 3;                              /* return error */
+        return 3;                                    /* return error */
     }
     
-    *mode = (bmp180_mode_t)handle->oss;        /* get mode */
+    *enable = (bmp180_bool_t)(handle->burst);        /* get burst readout */
     
-    return 0;                                  /* success return 0 */
+    return 0;                                        /* success return 0 */
 }
 
 /**
- * @brief      read the pressure data
+ * @brief      get the datasheet time of the running conversion
  * @param[in]  *handle pointer to a bmp180 handle structure
- * @param[out] *raw pointer to a raw pressure buffer
- * @param[out] *pa pointer to a converted pressure buffer
+ * @param[out] *us pointer to a conversion time buffer
  * @return     status code
  *             - 0 success
- *             - 1 pressure read failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       none
+ *             - 4 no conversion is started
+ * @note       4.5 ms for temperature and 4.5/7.5/13.5/25.5 ms for pressure
  */
-uint8_t bmp180_read_pressure(bmp180_handle_t *handle, uint32_t *raw, uint32_t *pa)
+uint8_t bmp180_get_conversion_time(bmp180_handle_t *handle, uint32_t *us)
 {
-    uint8_t buf[3];
-    uint8_t status;
-    uint16_t num;
-    int32_t ut = 0, up = 0, x1 ,x2, x3, b5, b6, b3, p;
-    uint32_t b4,b7;
-    
-    if (handle == NULL)                                                                                /* check handle */
+    if (handle == NULL)                                                  /* check handle */
     {
-        return 2;                                                                                      /* return error */
+        return 2;                                                        /* return error */
     }
-    if (handle->inited != 1)                                                                           /* check handle initialization */
+    if (handle->inited != 1)                                             /* check handle initialization */
     {
-        return 3;                                                                                      /* return error */
+        return 3;                                                        /* return error */
     }
-    
-    num = 5000;                                                                                        /* set timeout 5000 ms */
-    if (a_bmp180_iic_write(handle, BMP180_ADDRESS, BMP180_REG_CTRL_MEAS, 0x2E) != 0)                   /* write temperature measurement command */
+    if (handle->state == BMP180_STATE_IDLE)                              /* check state */
     {
-        handle->debug_print("bmp180: write CTRL_MEAS failed.\n");                                      /* write CTRL_MEAS failed */
+        handle->debug_print("bmp180: no conversion is started.\n");      /* no conversion is started */
         
-        return 1;                                                                                      /* return error */
-    }
-    while (num != 0)                                                                                   /* check times */
-    {
-        handle->delay_ms(1);                                                                           /* wait 1 ms */
-        if (a_bmp180_iic_read(handle, BMP180_ADDRESS, BMP180_REG_CTRL_MEAS, (uint8_t *)&status) != 0)  /* read ctrl status */
-        {
-            handle->debug_print("bmp180: read CTRL_MEAS failed.\n");                                   /* return ctrl meas failed */
-            
-            return 1;                                                                                  /* return error */
-        }
-        status = status & 0x20;                                                                        /* get finished flag */
-        if (status == 0)                                                                               /* check flag */
-        {
-            goto t_read;                                                                               /* goto next step */
-        }
-        else
-        {
-            num = num-1;                                                                               /* times-1 */
-        }
+        return 4;                                                        /* return error */
     }
-    handle->debug_print("bmp180: read temperature failed.\n");                                         /* read temperature failed */
     
-    return 1;                                                                                          /* return error */
+    *us = a_bmp180_conversion_time(handle);                              /* get conversion time */
     
-    t_read:
-    memset(buf, 0, sizeof(uint8_t) * 3);                                                               /* clear the buffer */
-    if (handle->iic_read(BMP180_ADDRESS, BMP180_REG_OUT_MSB, (uint8_t *)buf ,2) != 0)                  /* read raw temperature */
-    {
-        handle->debug_print("bmp180: read OUT MSB LSB failed.\n");                                     /* read OUT MSB LSB failed */
-        
-        return 1;                                                                                      /* return error */
-    }
-    ut = buf[0] << 8;                                                                                  /* get MSB */
-    ut = ut | buf[1];                                                                                  /* get LSB */
-    ut = ut & 0x0000FFFFU;                                                                             /* get valid part */
-    if (a_bmp180_iic_write(handle, BMP180_ADDRESS, BMP180_REG_CTRL_MEAS, 0x34+(handle->oss<<6)) != 0)  /* write pressure measurement command */
+    return 0;                                                            /* success return 0 */
+}
+
+/**
+ * @brief      get the iic transaction counters
+ * @param[in]  *handle pointer to a bmp180 handle structure
+ * @param[out] *read pointer to a read transaction counter buffer
+ * @param[out] *write pointer to a write transaction counter buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t bmp180_get_iic_count(bmp180_handle_t *handle, uint32_t *read, uint32_t *write)
+{
+    if (handle == NULL)                         /* check handle */
     {
-        handle->debug_print("bmp180: write CTRL_MEAS failed.\n");                                      /* write CTRL_MEAS failed */
-        
-        return 1;                                                                                      /* return error */
+        return 2;                               /* return error */
     }
-    num = 5000;                                                                                        /* set timeout 5000 ms */
-    while (num != 0)                                                                                   /* check times */
+    if (handle->inited != 1)                    /* check handle initialization */
     {
-        handle->delay_ms(1);                                                                           /* wait 1 ms */
-        if (a_bmp180_iic_read(handle, BMP180_ADDRESS, BMP180_REG_CTRL_MEAS, (uint8_t *)&status) != 0)  /* read status */
-        {
-            handle->debug_print("bmp180: read CTRL_MEAS failed.\n");                                   /* read CTRL_MEAS failed */
-            
-            return 1;                                                                                  /* return error */
-        }
-        status = status & 0x20;                                                                        /* get finished flag */
-        if (status == 0)                                                                               /* check flag */
-        {
-            goto p_read;                                                                               /* goto next step */
-        }
-        else
-        {
-            num = num-1;                                                                               /* times-1 */
-        }
+        return 3;                               /* return error */
     }
-    handle->debug_print("bmp180: read pressure failed.\n");                                            /* read pressure failed */
     
-    return 1;                                                                                          /* return error */
+    *read = handle->iic_read_count;             /* get read counter */
+    *write = handle->iic_write_count;           /* get write counter */
     
-    p_read:
-    memset(buf, 0, sizeof(uint8_t) * 3);                                                               /* clear the buffer */
-    if (handle->iic_read(BMP180_ADDRESS, BMP180_REG_OUT_MSB, (uint8_t *)buf ,3) != 0)                  /* read pressure */
-    {
-        handle->debug_print("bmp180: read OUT MSB LSB XLSB failed.\n");                                /* read OUT MSB LSB XLSB failed */
-        
-        return 1;                                                                                      /* return error */
-    }
-    up = buf[0] << 8;                                                                                  /* get MSB */
-    up = up | buf[1];                                                                                  /* get LSB */
-    up = up << 8;                                                                                      /* left shift 8 */
-    up = up | buf[2];                                                                                  /* get XLSB */
-    *raw = up;                                                                                         /* get raw data */
-    up = up >> (8-handle->oss);                                                                        /* shift */
-    if (handle->oss == 0)                                                                              /* ultra low */
-    {
-        up = up & 0x0000FFFFU;                                                                         /* set mask */
-    }
-    else if (handle->oss == 1)                                                                         /* standard */
-    {
-        up = up & 0x0001FFFFU;                                                                         /* set mask */
-    }
-    else if (handle->oss == 2)                                                                         /* high */
-    {
-        up= up & 0x0003FFFFU;                                                                          /* set mask */
-    }
-    else if (handle->oss == 3)                                                                         /* ultra high */
-    {
-        up = up & 0x0007FFFFU;                                                                         /* set mask */
-    }
-    else
-    {
-        handle->debug_print("bmp180: oss param error.\n");                                             /* oss param error */
-        
-        return 1;                                                                                      /* return error */
-    }
-    x1 = (((ut - (int32_t)handle->ac6) * (int32_t)handle->ac5)) >> 15;                                 /* calculate x1 */
-    x2 = (int32_t)((((int32_t)handle->mc) << 11) / (x1 + (int32_t)handle->md));                        /* calculate x2 */
-    b5 = x1 + x2;                                                                                      /* calculate b5 */
-    b6 = b5 - 4000;                                                                                    /* calculate b6 */
-    x1 = ((int32_t)handle->b2 * ((b6 * b6) >> 12)) >> 11;                                              /* calculate x1 */
-    x2 = ((int32_t)handle->ac2 * b6) >> 11;                                                            /* calculate x2 */
-    x3 = x1 + x2;                                                                                      /* calculate x3 */
-    b3 = (((((int32_t)handle->ac1) * 4 + x3) << handle->oss) + 2) >> 2;                                /* calculate b3 */
-    x1 = ((int32_t)handle->ac3 * b6) >> 13;                                                            /* calculate x1 */
-    x2 = ((int32_t)handle->b1*(((b6 * b6)) >> 12)) >> 16;                                              /* calculate x2 */
-    x3 = ((x1 + x2) + 2) >> 2;                                                                         /* calculate x3 */
-    b4 = (uint32_t)((((uint32_t)handle->ac4 * (uint32_t)(x3 + 32768))) >> 15);                         /* calculate b4 */
-    b7 = (uint32_t)((uint32_t)(up - b3) * (50000>>handle->oss));                                       /* calculate b7 */
-    if (b7 < 0x80000000U)
+    return 0;                                   /* success return 0 */
+}
+
+/**
+ * @brief     clear the iic transaction counters
+ * @param[in] *handle pointer to a bmp180 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t bmp180_clear_iic_count(bmp180_handle_t *handle)
+{
+    if (handle == NULL)                  /* check handle */
     {
-        p = (int32_t)((b7 << 1) / b4);                                                                 /* calculate p */
+        return 2;                        /* return error */
     }
-    else
+    if (handle->inited != 1)             /* check handle initialization */
     {
-        p = (int32_t)((b7 / b4) << 1);                                                                 /* calculate p */
+        return 3;                        /* return error */
     }
-    x1 = (p >> 8) * (p >> 8);                                                                          /* calculate x1 */
-    x1 = (x1 * 3038) >> 16;                                                                            /* calculate x1 */
-    x2 = (-7357 * p) >> 16;                                                                            /* calculate x2 */
-    *pa = p + ((x1 + x2 + 3791) >> 4);                                                                 /* calculate x2 */
     
-    return 0;                                                                                          /* success return 0 */
+    handle->iic_read_count = 0;          /* clear read counter */
+    handle->iic_write_count = 0;         /* clear write counter */
+    
+    return 0;                            /* success return 0 */
 }
 
+#if (BMP180_METRICS_ENABLE == 1)
 /**
- * @brief      read the temperature data
+ * @brief      get the metrics
  * @param[in]  *handle pointer to a bmp180 handle structure
- * @param[out] *raw pointer to a raw temperature buffer
- * @param[out] *c pointer to a converted temperature buffer
+ * @param[out] *metrics pointer to a metrics buffer
  * @return     status code
  *             - 0 success
- *             - 1 temperature read failed
  *             - 2 handle is NULL
- *             - 3 handle is not initialized
- * @note       none
+ * @note       the histograms stay empty when timestamp_ns is not linked
  */
-uint8_t bmp180_read_temperature(bmp180_handle_t *handle, uint16_t *raw, float *c)
+uint8_t bmp180_get_metrics(bmp180_handle_t *handle, bmp180_metrics_t *metrics)
 {
-    uint8_t buf[3];
-    uint8_t status;
-    uint16_t num;
-    int32_t ut = 0, x1 ,x2, b5;
-    
-    if (handle == NULL)                                                                                /* check handle */
+    if ((handle == NULL) || (metrics == NULL))                       /* check handle */
     {
-        return 2;                                                                                      /* return error */
+        return 2;                                                    /* return error */
     }
-    if (handle->inited != 1)                                                                           /* check handle initialization */
+    
+    memcpy(metrics, &handle->metrics, sizeof(bmp180_metrics_t));     /* copy the metrics */
+    
+    return 0;                                                        /* success return 0 */
+}
+
+/**
+ * @brief     clear the metrics
+ * @param[in] *handle pointer to a bmp180 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      none
+ */
+uint8_t bmp180_clear_metrics(bmp180_handle_t *handle)
+{
+    if (handle == NULL)                                            /* check handle */
     {
-        return 3;                                                                                      /* return error */
+        return 2;                                                  /* return error */
     }
     
-    num = 5000;                                                                                        /* set timeout 5000 */
-    if (a_bmp180_iic_write(handle, BMP180_ADDRESS, BMP180_REG_CTRL_MEAS, 0x2E) != 0)                   /* write temperature measurement command */
+    memset(&handle->metrics, 0, sizeof(bmp180_metrics_t));        /* clear the metrics */
+    handle->conversion_polls = 0;                                  /* clear the conversion polls */
+    
+    return 0;                                                      /* success return 0 */
+}
+#endif
+
+/**
+ * @brief     set the temperature reuse policy of bmp180_read_pressure
+ * @param[in] *handle pointer to a bmp180 handle structure
+ * @param[in] samples refresh the temperature every samples pressure reads, 0 means disable
+ * @param[in] ms refresh the temperature when it is older than ms, 0 means disable
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 timestamp_ms is null
+ * @note      the temperature is measured before every pressure when both are 0
+ */
+uint8_t bmp180_set_temperature_reuse(bmp180_handle_t *handle, uint16_t samples, uint32_t ms)
+{
+    if (handle == NULL)                                                 /* check handle */
     {
-        handle->debug_print("bmp180: write CTRL_MEAS failed.\n");                                      /* write CTRL_MEAS failed */
-        
-        return 1;                                                                                      /* return error */
+        return 2;                                                       /* return error */
     }
-    while (num != 0)                                                                                   /* check times */
+    if (handle->inited != 1)                                            /* check handle initialization */
     {
-        handle->delay_ms(1);                                                                           /* delay 1 ms */
-        if (a_bmp180_iic_read(handle, BMP180_ADDRESS, BMP180_REG_CTRL_MEAS, (uint8_t *)&status) != 0)  /* read status */
-        {
-            handle->debug_print("bmp180: read CTRL_MEAS failed.\n");                                   /* read CTRL_MEAS failed */
-            
-            return 1;                                                                                  /* return error */
-        }
-        status = status & 0x20;                                                                        /* get finished flag */
-        if (status == 0)                                                                               /* check flag */
-        {
-            goto t_read;                                                                               /* goto next step */
-        }
-        else
-        {
-            num = num-1;                                                                               /* times-1 */
-        }
+        return 3;                                                       /* return error */
     }
-    handle->debug_print("bmp180: read temperature failed.\n");                                         /* read temperature failed */
-    
-    return 1;                                                                                          /* return error */
-    
-    t_read:
-    memset(buf, 0, sizeof(uint8_t) * 3);                                                               /* clear the buffer */
-    if (handle->iic_read(BMP180_ADDRESS, BMP180_REG_OUT_MSB, (uint8_t *)buf ,2) != 0)                  /* read raw temperature */
+    if ((ms != 0) && (handle->timestamp_ms == NULL) && 
+        (handle->timestamp_ms_ctx == NULL))                             /* check timestamp_ms */
     {
-        handle->debug_print("bmp180: read OUT MSB LSB failed.\n");                                     /* read OUT MSB LSB failed */
+        handle->debug_print("bmp180: timestamp_ms is null.\n");         /* timestamp_ms is null */
         
-        return 1;                                                                                      /* return error */
+        return 4;                                                       /* return error */
     }
-    ut = buf[0] << 8;                                                                                  /* get MSB */
-    ut = ut | buf[1];                                                                                  /* get LSB */
-    ut = ut & 0x0000FFFFU;                                                                             /* set mask */
-    *raw = (uint16_t)ut;                                                                               /* get raw temperature */
-    x1 = (((ut - (int32_t)handle->ac6) * (int32_t)handle->ac5)) >> 15;                                 /* calculate x1 */
-    x2 =(int32_t)((((int32_t)handle->mc) << 11) / (x1 + (int32_t)handle->md));                         /* calculate x2 */
-    b5 = x1 + x2;                                                                                      /* calculate b5 */
-    *c = ((uint16_t)((b5 + 8) >> 4)) * 0.1f;                                                           /* calculate temperature */
     
-    return 0;                                                                                          /* success return 0 */
+    handle->reuse_samples = samples;                                    /* set reuse samples */
+    handle->reuse_ms = ms;                                              /* set reuse time */
+    
+    return 0;                                                           /* success return 0 */
 }
 
 /**
- * @brief      read the temperature and pressure data
+ * @brief      get the temperature reuse policy
  * @param[in]  *handle pointer to a bmp180 handle structure
- * @param[out] *temperature_raw pointer to a raw temperature buffer
- * @param[out] *temperature_c pointer to a converted temperature buffer
- * @param[out] *pressure_raw pointer to a raw pressure buffer
- * @param[out] *pressure_pa pointer to a converted pressure buffer
+ * @param[out] *samples pointer to a pressure samples buffer
+ * @param[out] *ms pointer to a reuse time buffer
  * @return     status code
  *             - 0 success
- *             - 1 read failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t bmp180_read_temperature_pressure(bmp180_handle_t *handle, uint16_t *temperature_raw, float *temperature_c, 
-                                         uint32_t *pressure_raw, uint32_t *pressure_pa)
+uint8_t bmp180_get_temperature_reuse(bmp180_handle_t *handle, uint16_t *samples, uint32_t *ms)
 {
-    uint8_t buf[3];
-    uint8_t status;
-    uint16_t num;
-    int32_t ut = 0, up = 0, x1 ,x2, x3, b5, b6, b3, p;
-    uint32_t b4,b7;
-    
-    if (handle == NULL)                                                                                /* check handle */
+    if (handle == NULL)                         /* check handle */
     {
-        return 2;                                                                                      /* return error */
+        return 2;                               /* return error */
     }
-    if (handle->inited != 1)                                                                           /* check handle initialization */
+    if (handle->inited != 1)                    /* check handle initialization */
     {
-        return 3;                                                                                      /* return error */
+        return 3;                               /* return error */
     }
     
-    num = 5000;                                                                                        /* set timeout 5000 */
-    if (a_bmp180_iic_write(handle, BMP180_ADDRESS, BMP180_REG_CTRL_MEAS, 0x2E) != 0)                   /* write temperature measurement command */
+    *samples = handle->reuse_samples;           /* get reuse samples */
+    *ms = handle->reuse_ms;                     /* get reuse time */
+    
+    return 0;                                   /* success return 0 */
+}
+
+/**
+ * @brief      check whether the cached temperature must be refreshed
+ * @param[in]  *handle pointer to a bmp180 handle structure
+ * @param[out] *expired pointer to an expired flag buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       split-phase callers use this to decide whether to start a temperature conversion
+ */
+uint8_t bmp180_get_temperature_expired(bmp180_handle_t *handle, bmp180_bool_t *expired)
+{
+    if (handle == NULL)                                          /* check handle */
     {
-        handle->debug_print("bmp180: write CTRL_MEAS failed.\n");                                      /* write CTRL_MEAS failed */
-        
-        return 1;                                                                                      /* return error */
+        return 2;                                                /* return error */
     }
-    while (num != 0)                                                                                   /* check times */
+    if (handle->inited != 1)                                     /* check handle initialization */
     {
-        handle->delay_ms(1);                                                                           /* wait 1 ms */
-        if (a_bmp180_iic_read(handle, BMP180_ADDRESS, BMP180_REG_CTRL_MEAS, (uint8_t *)&status) != 0)  /* read status */
-        {
-            handle->debug_print("bmp180: read CTRL_MEAS failed.\n");                                   /* read CTRL_MEAS failed */
-            
-            return 1;                                                                                  /* return error */
-        }
-        status = status & 0x20;                                                                        /* get finished flag */
-        if (status == 0)                                                                               /* check flag */
-        {
-            goto t_read;                                                                               /* goto next step */
-        }
-        else
-        {
-            num = num-1;                                                                               /* times-1 */
-        }
+        return 3;                                                /* return error */
     }
-    handle->debug_print("bmp180: read temperature failed.\n");                                         /* read temperature failed */
     
-    return 1;                                                                                          /* return error */
+    *expired = a_bmp180_temperature_expired(handle);             /* check the cached temperature */
     
-    t_read:
-    memset(buf, 0, sizeof(uint8_t) * 3);                                                               /* clear the buffer */
-    if (handle->iic_read(BMP180_ADDRESS, BMP180_REG_OUT_MSB, (uint8_t *)buf ,2) != 0)                  /* read raw temperature */
-    {
-        handle->debug_print("bmp180: read OUT MSB LSB failed.\n");                                     /* read OUT MSB LSB failed */
-        
-        return 1;                                                                                      /* return error */
-    }
-    ut = buf[0] << 8;                                                                                  /* get MSB */
-    ut = ut | buf[1];                                                                                  /* get LSB */
-    ut = ut & 0x0000FFFFU;                                                                             /* set mask */
-    *temperature_raw = (uint16_t)ut;                                                                   /* get temperature */
-    if (a_bmp180_iic_write(handle, BMP180_ADDRESS, BMP180_REG_CTRL_MEAS, 0x34+(handle->oss<<6)) != 0)  /* write pressure measurement command */
-    {
-        handle->debug_print("bmp180: write CTRL_MEAS failed.\n");                                      /* write CTRL_MEAS failed */
-        
-        return 1;                                                                                      /* return error */
-    }    
-    num = 5000;                                                                                        /* set timeout 5000 */
-    while (num != 0)                                                                                   /* check times */
-    {
-        handle->delay_ms(1);                                                                           /* wait 1 ms */
-        if (a_bmp180_iic_read(handle, BMP180_ADDRESS, BMP180_REG_CTRL_MEAS, (uint8_t *)&status) != 0)  /* read status */
-        {
-            handle->debug_print("bmp180: read CTRL_MEAS failed.\n");                                   /* read CTRL_MEAS failed */
-            
-            return 1;                                                                                  /* return error */
-        }
-        status = status & 0x20;                                                                        /* get finished flag */
-        if (status == 0)                                                                               /* check flag */
-        {
-            goto p_read;                                                                               /* goto next step */
-        }
-        else
-        {
-            num = num-1;                                                                               /* times-1 */
-        }
-    }
-    handle->debug_print("bmp180: read pressure failed.\n");                                            /* read pressure failed */
+    return 0;                                                    /* success return 0 */
+}
 
-    return 1;                                                                                          /* return error */
+/**
+ * @brief      compensate one raw sample with the calibration of the handle
+ * @param[in]  *handle pointer to a bmp180 handle structure
+ * @param[in]  mode oversampling mode of the raw pressure
+ * @param[in]  ut raw temperature
+ * @param[in]  up raw pressure
+ * @param[out] *temperature pointer to a temperature buffer in 0.1 degrees celsius
+ * @param[out] *pa pointer to a pressure buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 mode is invalid
+ *             - 2 handle is NULL
+ *             - 4 raw data can't be compensated
+ * @note       the raw values are the ones returned by the read functions
+ *             only the calibration is used, so the handle needs no bus and no initialization
+ *             this is the reference of the batch kernels in driver_bmp180_batch.h
+ */
+uint8_t bmp180_compensate(bmp180_handle_t *handle, bmp180_mode_t mode, uint16_t ut, uint32_t up, 
+                          int32_t *temperature, uint32_t *pa)
+{
+    int32_t b5, b3;
+    uint32_t b4;
+    uint8_t oss;
     
-    p_read:
-    memset(buf, 0, sizeof(uint8_t) * 3);                                                               /* clear the buffer */
-    if (handle->iic_read(BMP180_ADDRESS, BMP180_REG_OUT_MSB, (uint8_t *)buf ,3) != 0)                  /* read raw pressure */
-    {
-        handle->debug_print("bmp180: read OUT MSB LSB XLSB failed.\n");                                /* read OUT MSB LSB XLSB failed */
-        
-        return 1;                                                                                      /* return error */
-    }    
-    up = buf[0] << 8;                                                                                  /* get MSB */
-    up = up | buf[1];                                                                                  /* get LSB */
-    up = up << 8;                                                                                      /* left shit */
-    up = up | buf[2];                                                                                  /* get XLSB */
-    *pressure_raw = up;                                                                                /* get pressure */
-    up = up >> (8-handle->oss);                                                                        /* right shift */
-    if (handle->oss == 0)                                                                              /* ultra low */
-    {
-        up = up & 0x0000FFFFU;                                                                         /* set mask */
-    }
-    else if (handle->oss == 1)                                                                         /* standard */
-    {
-        up = up & 0x0001FFFFU;                                                                         /* set mask */
-    }
-    else if (handle->oss == 2)                                                                         /* high */
+    if (handle == NULL)                                                            /* check handle */
     {
-        up= up & 0x0003FFFFU;                                                                          /* set mask */
+        return 2;                                                                  /* return error */
     }
-    else if (handle->oss == 3)                                                                         /* ultra high */
+    if (mode > BMP180_MODE_ULTRA_HIGH)                                             /* check mode */
     {
-        up = up & 0x0007FFFFU;                                                                         /* set mask */
+        return 1;                                                                  /* return error */
     }
-    else
-    {
-        handle->debug_print("bmp180: oss param error.\n");                                             /* oss param error */
-        
-        return 1;                                                                                      /* return error */
-    }
-    x1 = (((ut - (int32_t)handle->ac6) * (int32_t)handle->ac5)) >> 15;                                 /* calculate x1 */
-    x2 = (int32_t)((((int32_t)handle->mc) << 11) / (x1 + (int32_t)handle->md));                        /* calculate x2 */
-    b5 = x1 + x2;                                                                                      /* calculate b5 */
-    *temperature_c = ((uint16_t)((b5 + 8) >> 4)) * 0.1f;                                               /* get temperature */
-    b6 = b5 - 4000;                                                                                    /* calculate b6 */
-    x1 = ((int32_t)handle->b2 * ((b6 * b6) >> 12)) >> 11;                                              /* calculate x1 */
-    x2 = ((int32_t)handle->ac2 * b6) >> 11;                                                            /* calculate x2 */
-    x3 = x1 + x2;                                                                                      /* calculate x3 */
-    b3 = (((((int32_t)handle->ac1) * 4 + x3)<<handle->oss) + 2) >> 2;                                  /* calculate b3 */
-    x1 = ((int32_t)handle->ac3 * b6) >> 13;                                                            /* calculate x1 */
-    x2 = ((int32_t)handle->b1 * (((b6 * b6)) >> 12)) >> 16;                                            /* calculate x2 */
-    x3 = ((x1 + x2) + 2) >> 2;                                                                         /* calculate x3 */
-    b4 = (uint32_t)((((uint32_t)handle->ac4 * (uint32_t)(x3 + 32768))) >> 15);                         /* calculate b4 */
-    b7 = (uint32_t)((uint32_t)(up - b3) * (50000 >> handle->oss));                                     /* calculate b7 */
-    if (b7 < 0x80000000U)
+    
+    oss = (uint8_t)mode;                                                           /* get oss */
+    if (a_bmp180_compensate_temperature(handle, (int32_t)ut, &b5) != 0)            /* compensate temperature */
     {
-        p = (int32_t)((b7 << 1) / b4);                                                                 /* calculate p */
+        return 4;                                                                  /* return error */
     }
-    else
+    a_bmp180_calculate_coefficients(handle, b5, oss, &b3, &b4);                    /* calculate b3 and b4 */
+    if (a_bmp180_compensate_pressure((int32_t)((up >> (8 - oss)) & (0x0007FFFFU >> (3 - oss))), 
+                                     b3, b4, (uint32_t)(50000 >> oss), pa) != 0)   /* compensate pressure */
     {
-        p = (int32_t)((b7 / b4) << 1);                                                                 /* calculate p */
+        return 4;                                                                  /* return error */
     }
-    x1 = (p >> 8) * (p >> 8);                                                                          /* calculate x1 */
-    x1 = (x1 * 3038) >> 16;                                                                            /* calculate x1 */
-    x2 = (-7357 * p) >> 16;                                                                            /* calculate x2 */
-    *pressure_pa = p + ((x1 + x2 + 3791) >> 4);                                                        /* set pressure */
+    *temperature = (b5 + 8) >> 4;                                                  /* get temperature */
     
-    return 0;                                                                                          /* success return 0 */
+    return 0;                                                                      /* success return 0 */
 }
 
 /**
@@ -784,7 +2288,7 @@ uint8_t bmp180_set_reg(bmp180_handle_t *handle, uint8_t reg, uint8_t value)
         return 3;                                                        /* return error */
     } 
 
-    return a_bmp180_iic_write(handle, BMP180_ADDRESS, reg, value);       /* write register */
+    return a_bmp180_iic_write(handle, reg, value);                       /* write register */
 }
 
 /**
@@ -810,7 +2314,7 @@ uint8_t bmp180_get_reg(bmp180_handle_t *handle, uint8_t reg, uint8_t *value)
         return 3;                                                       /* return error */
     } 
 
-    return a_bmp180_iic_read(handle, BMP180_ADDRESS, reg, value);       /* read register */
+    return a_bmp180_iic_read(handle, reg, value, 1);                    /* read register */
 }
 
 /**
@@ -23,13 +23,14 @@
  *
  * @file      driver_bmp180.h
  * @brief     driver bmp180 header file
- * @version   2.0.0
+ * @version   2.1.0
  * @author    Shifeng Li
  * @date      2021-02-21
  *
  * <h3>history</h3>
  * <table>
  * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>2.1      <td>Shifeng Li  <td>add the split-phase api and performance modules
  * <tr><td>2021/02/21  <td>2.0      <td>Shifeng Li  <td>format the code
  * <tr><td>2020/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
  * </table>
@@ -46,6 +47,31 @@
 extern "C"{
 #endif
 
+/**
+ * @brief bmp180 float api definition
+ * @note  set it to 0 to build the driver without float arithmetic,
+ *        the bmp180_*_fixed functions are always available
+ */
+#ifndef BMP180_FLOAT_ENABLE
+    #define BMP180_FLOAT_ENABLE    1
+#endif
+
+/**
+ * @brief bmp180 metrics definition
+ * @note  set it to 1 to count the bus traffic, the polls, the errors and the latencies of every handle,
+ *        the handle and the hot path are unchanged when it is 0
+ */
+#ifndef BMP180_METRICS_ENABLE
+    #define BMP180_METRICS_ENABLE    0
+#endif
+#define BMP180_METRICS_BUCKETS    32        /**< log2 histogram buckets, bucket n counts [2^n, 2^(n+1)) ns */
+
+/**
+ * @brief bmp180 calibration blob definition
+ */
+#define BMP180_CALIBRATION_SIZE       26          /**< calibration blob size */
+#define BMP180_CALIBRATION_VERSION    0x01        /**< calibration blob version */
+
 /**
  * @defgroup bmp180_driver bmp180 driver function
  * @brief    bmp180 driver modules
@@ -68,30 +94,127 @@ typedef enum
     BMP180_MODE_ULTRA_HIGH = 0x03,        /**< ultra high mode */
 } bmp180_mode_t;
 
+/**
+ * @brief bmp180 bool enumeration definition
+ */
+typedef enum
+{
+    BMP180_BOOL_FALSE = 0x00,        /**< false */
+    BMP180_BOOL_TRUE  = 0x01,        /**< true */
+} bmp180_bool_t;
+
+/**
+ * @brief bmp180 conversion state enumeration definition
+ */
+typedef enum
+{
+    BMP180_STATE_IDLE                   = 0x00,        /**< no conversion in flight */
+    BMP180_STATE_TEMPERATURE_CONVERTING = 0x01,        /**< temperature conversion is running */
+    BMP180_STATE_TEMPERATURE_READY      = 0x02,        /**< temperature conversion is finished */
+    BMP180_STATE_PRESSURE_CONVERTING    = 0x03,        /**< pressure conversion is running */
+    BMP180_STATE_PRESSURE_READY         = 0x04,        /**< pressure conversion is finished */
+} bmp180_state_t;
+
+/**
+ * @brief bmp180 wait mode enumeration definition
+ */
+typedef enum
+{
+    BMP180_WAIT_MODE_POLL  = 0x00,        /**< poll CTRL_MEAS every 1 ms until the conversion is finished */
+    BMP180_WAIT_MODE_TIMED = 0x01,        /**< sleep the datasheet conversion time and read the data directly */
+    BMP180_WAIT_MODE_EOC   = 0x02,        /**< wait for the EOC rising edge through wait_eoc and read the data directly */
+} bmp180_wait_mode_t;
+
+#if (BMP180_METRICS_ENABLE == 1)
+/**
+ * @brief bmp180 metrics structure definition
+ */
+typedef struct bmp180_metrics_s
+{
+    uint32_t iic_reads;                                           /**< iic read transactions */
+    uint32_t iic_writes;                                          /**< iic write transactions */
+    uint64_t iic_read_bytes;                                      /**< bytes read */
+    uint64_t iic_write_bytes;                                     /**< bytes written */
+    uint32_t iic_read_errors;                                     /**< failed iic reads */
+    uint32_t iic_write_errors;                                    /**< failed iic writes */
+    uint32_t conversions;                                         /**< finished conversions */
+    uint32_t polls;                                               /**< CTRL_MEAS status polls */
+    uint32_t polls_max;                                           /**< max status polls of one conversion */
+    uint32_t timeouts;                                            /**< conversions that never finished */
+    uint32_t eoc_fallbacks;                                       /**< EOC waits that fell back to polling */
+    uint32_t busy;                                                /**< fetches of an unfinished conversion */
+    uint32_t compensation_errors;                                 /**< raw data that can't be compensated */
+    uint32_t conversion_ns[BMP180_METRICS_BUCKETS];               /**< log2 histogram from the start to the end of a conversion */
+    uint32_t iic_ns[BMP180_METRICS_BUCKETS];                      /**< log2 histogram of one iic transaction */
+    uint32_t compensation_ns[BMP180_METRICS_BUCKETS];             /**< log2 histogram of one compensation */
+} bmp180_metrics_t;
+#endif
+
 /**
  * @brief bmp180 handle structure definition
  */
 typedef struct bmp180_handle_s
 {
-    uint8_t (*iic_init)(void);                                                          /**< point to an iic_init function address */
-    uint8_t (*iic_deinit)(void);                                                        /**< point to an iic_deinit function address */
-    uint8_t (*iic_read)(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);         /**< point to an iic_read function address */
-    uint8_t (*iic_write)(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);        /**< point to an iic_write function address */
-    void (*delay_ms)(uint32_t ms);                                                      /**< point to a delay_ms function address */
-    void (*debug_print)(const char *const fmt, ...);                                    /**< point to a debug_print function address */
-    uint8_t inited;                                                                     /**< inited flag */
-    int16_t ac1;                                                                        /**< ac1 */
-    int16_t ac2;                                                                        /**< ac2 */
-    int16_t ac3;                                                                        /**< ac3 */
-    uint16_t ac4;                                                                       /**< ac4 */
-    uint16_t ac5;                                                                       /**< ac5 */
-    uint16_t ac6;                                                                       /**< ac6 */
-    int16_t b1;                                                                         /**< b1 */
-    int16_t b2;                                                                         /**< b2 */
-    int16_t mb;                                                                         /**< mb */
-    int16_t mc;                                                                         /**< mc */
-    int16_t md;                                                                         /**< md */
-    uint8_t oss;                                                                        /**< oss param */
+    uint8_t (*iic_init)(void);                                                                        /**< point to an iic_init function address */
+    uint8_t (*iic_deinit)(void);                                                                      /**< point to an iic_deinit function address */
+    uint8_t (*iic_read)(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);                       /**< point to an iic_read function address */
+    uint8_t (*iic_write)(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);                      /**< point to an iic_write function address */
+    uint8_t (*iic_init_ctx)(void *user);                                                              /**< point to an optional iic_init_ctx function address */
+    uint8_t (*iic_deinit_ctx)(void *user);                                                            /**< point to an optional iic_deinit_ctx function address */
+    uint8_t (*iic_read_ctx)(void *user, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);       /**< point to an optional iic_read_ctx function address */
+    uint8_t (*iic_write_ctx)(void *user, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);      /**< point to an optional iic_write_ctx function address */
+    void (*delay_ms_ctx)(void *user, uint32_t ms);                                                    /**< point to an optional delay_ms_ctx function address */
+    void (*delay_us_ctx)(void *user, uint32_t us);                                                    /**< point to an optional delay_us_ctx function address */
+    uint32_t (*timestamp_ms_ctx)(void *user);                                                         /**< point to an optional timestamp_ms_ctx function address */
+    uint8_t (*wait_eoc_ctx)(void *user, uint32_t us);                                                 /**< point to an optional wait_eoc_ctx function address */
+    void *user;                                                                                       /**< user context passed to the ctx functions */
+    void (*delay_ms)(uint32_t ms);                                                                    /**< point to a delay_ms function address */
+    void (*delay_us)(uint32_t us);                                                                    /**< point to an optional delay_us function address */
+    uint32_t (*timestamp_ms)(void);                                                                   /**< point to an optional timestamp_ms function address */
+    uint8_t (*wait_eoc)(uint32_t us);                                                                 /**< point to an optional wait_eoc function address */
+    void (*debug_print)(const char *const fmt, ...);                                                  /**< point to a debug_print function address */
+    uint8_t inited;                                                                                   /**< inited flag */
+    int16_t ac1;                                                                                      /**< ac1 */
+    int16_t ac2;                                                                                      /**< ac2 */
+    int16_t ac3;                                                                                      /**< ac3 */
+    uint16_t ac4;                                                                                     /**< ac4 */
+    uint16_t ac5;                                                                                     /**< ac5 */
+    uint16_t ac6;                                                                                     /**< ac6 */
+    int16_t b1;                                                                                       /**< b1 */
+    int16_t b2;                                                                                       /**< b2 */
+    int16_t mb;                                                                                       /**< mb */
+    int16_t mc;                                                                                       /**< mc */
+    int16_t md;                                                                                       /**< md */
+    uint8_t oss;                                                                                      /**< oss param */
+    uint8_t state;                                                                                    /**< conversion state */
+    uint8_t conv_oss;                                                                                 /**< oss of the running pressure conversion */
+    uint8_t temperature_valid;                                                                        /**< temperature valid flag */
+    uint16_t ut;                                                                                      /**< last raw temperature */
+    int32_t b5;                                                                                       /**< last temperature compensation term */
+    uint8_t wait_mode;                                                                                /**< conversion wait mode */
+    uint32_t conversion_timestamp;                                                                    /**< start timestamp of the running conversion in ms */
+    uint32_t iic_read_count;                                                                          /**< iic read transaction counter */
+    uint32_t iic_write_count;                                                                         /**< iic write transaction counter */
+    uint32_t temperature_timestamp;                                                                   /**< timestamp of the last temperature in ms */
+    uint32_t reuse_ms;                                                                                /**< temperature reuse time in ms */
+    uint16_t reuse_samples;                                                                           /**< temperature reuse pressure samples */
+    uint16_t reuse_count;                                                                             /**< pressure samples since the last temperature */
+    uint8_t coef_valid;                                                                               /**< pressure coefficient cache valid flag */
+    uint8_t coef_oss;                                                                                 /**< oss of the cached pressure coefficients */
+    int32_t coef_b5;                                                                                  /**< b5 of the cached pressure coefficients */
+    int32_t coef_b3;                                                                                  /**< cached b3 */
+    uint32_t coef_b4;                                                                                 /**< cached b4 */
+    uint32_t coef_scale;                                                                              /**< cached 50000 >> oss */
+    uint8_t burst;                                                                                    /**< status and data burst readout flag */
+    uint8_t out_valid;                                                                                /**< burst data valid flag */
+    uint8_t out[3];                                                                                   /**< burst OUT_MSB, OUT_LSB and OUT_XLSB */
+#if (BMP180_METRICS_ENABLE == 1)
+    uint64_t (*timestamp_ns)(void);                                                                   /**< point to an optional timestamp_ns function address */
+    uint64_t (*timestamp_ns_ctx)(void *user);                                                         /**< point to an optional timestamp_ns_ctx function address */
+    uint64_t conversion_start_ns;                                                                     /**< start time of the running conversion */
+    uint32_t conversion_polls;                                                                        /**< status polls of the running conversion */
+    bmp180_metrics_t metrics;                                                                         /**< metrics */
+#endif
 } bmp180_handle_t;
 
 /**
@@ -110,6 +233,21 @@ typedef struct bmp180_info_s
     uint32_t driver_version;           /**< driver version */
 } bmp180_info_t;
 
+/**
+ * @brief bmp180 sample structure definition
+ */
+typedef struct bmp180_sample_s
+{
+    uint64_t timestamp_us;        /**< sample timestamp in us */
+    uint32_t sequence;            /**< sample sequence number */
+    uint32_t up;                  /**< raw pressure */
+    int32_t temperature;          /**< temperature in 0.1 degrees celsius */
+    uint32_t pa;                  /**< pressure in pa */
+    uint16_t ut;                  /**< raw temperature */
+    uint8_t mode;                 /**< oversampling mode */
+    uint8_t sensor;               /**< sensor index */
+} bmp180_sample_t;
+
 /**
  * @}
  */
@@ -161,6 +299,47 @@ typedef struct bmp180_info_s
  */
 #define DRIVER_BMP180_LINK_IIC_WRITE(HANDLE, FUC)   (HANDLE)->iic_write = FUC
 
+/**
+ * @brief     link iic_init_ctx function
+ * @param[in] HANDLE pointer to a bmp180 handle structure
+ * @param[in] FUC pointer to an iic_init_ctx function address
+ * @note      optional, it replaces iic_init and gets the linked user context
+ */
+#define DRIVER_BMP180_LINK_IIC_INIT_CTX(HANDLE, FUC)    (HANDLE)->iic_init_ctx = FUC
+
+/**
+ * @brief     link iic_deinit_ctx function
+ * @param[in] HANDLE pointer to a bmp180 handle structure
+ * @param[in] FUC pointer to an iic_deinit_ctx function address
+ * @note      optional, it replaces iic_deinit and gets the linked user context
+ */
+#define DRIVER_BMP180_LINK_IIC_DEINIT_CTX(HANDLE, FUC)  (HANDLE)->iic_deinit_ctx = FUC
+
+/**
+ * @brief     link iic_read_ctx function
+ * @param[in] HANDLE pointer to a bmp180 handle structure
+ * @param[in] FUC pointer to an iic_read_ctx function address
+ * @note      optional, it replaces iic_read and gets the linked user context
+ */
+#define DRIVER_BMP180_LINK_IIC_READ_CTX(HANDLE, FUC)    (HANDLE)->iic_read_ctx = FUC
+
+/**
+ * @brief     link iic_write_ctx function
+ * @param[in] HANDLE pointer to a bmp180 handle structure
+ * @param[in] FUC pointer to an iic_write_ctx function address
+ * @note      optional, it replaces iic_write and gets the linked user context
+ */
+#define DRIVER_BMP180_LINK_IIC_WRITE_CTX(HANDLE, FUC)   (HANDLE)->iic_write_ctx = FUC
+
+/**
+ * @brief     link user context
+ * @param[in] HANDLE pointer to a bmp180 handle structure
+ * @param[in] USER pointer to a user context
+ * @note      the context is passed to every linked ctx function,
+ *            so one process can drive many sensors on many buses without global state
+ */
+#define DRIVER_BMP180_LINK_USER(HANDLE, USER)           (HANDLE)->user = USER
+
 /**
  * @brief     link delay_ms function
  * @param[in] HANDLE pointer to a bmp180 handle structure
@@ -169,6 +348,90 @@ typedef struct bmp180_info_s
  */
 #define DRIVER_BMP180_LINK_DELAY_MS(HANDLE, FUC)    (HANDLE)->delay_ms = FUC
 
+/**
+ * @brief     link delay_us function
+ * @param[in] HANDLE pointer to a bmp180 handle structure
+ * @param[in] FUC pointer to a delay_us function address
+ * @note      optional, the timed wait mode rounds up to delay_ms when it is not linked
+ */
+#define DRIVER_BMP180_LINK_DELAY_US(HANDLE, FUC)    (HANDLE)->delay_us = FUC
+
+/**
+ * @brief     link timestamp_ms function
+ * @param[in] HANDLE pointer to a bmp180 handle structure
+ * @param[in] FUC pointer to a timestamp_ms function address
+ * @note      optional, needed by the time based temperature reuse and the split-phase timed mode
+ */
+#define DRIVER_BMP180_LINK_TIMESTAMP_MS(HANDLE, FUC) (HANDLE)->timestamp_ms = FUC
+
+/**
+ * @brief     link timestamp_ns function
+ * @param[in] HANDLE pointer to a bmp180 handle structure
+ * @param[in] FUC pointer to a timestamp_ns function address
+ * @note      optional, only the latency histograms of BMP180_METRICS_ENABLE need it,
+ *            it is ignored when the metrics are disabled
+ */
+#if (BMP180_METRICS_ENABLE == 1)
+    #define DRIVER_BMP180_LINK_TIMESTAMP_NS(HANDLE, FUC) (HANDLE)->timestamp_ns = FUC
+#else
+    #define DRIVER_BMP180_LINK_TIMESTAMP_NS(HANDLE, FUC) (void)(FUC)
+#endif
+
+/**
+ * @brief     link wait_eoc function
+ * @param[in] HANDLE pointer to a bmp180 handle structure
+ * @param[in] FUC pointer to a wait_eoc function address
+ * @note      optional, only needed by the EOC wait mode,
+ *            it returns 0 after the EOC rising edge and 1 on timeout or error,
+ *            a zero timeout only checks for an edge that is already seen
+ */
+#define DRIVER_BMP180_LINK_WAIT_EOC(HANDLE, FUC)    (HANDLE)->wait_eoc = FUC
+
+/**
+ * @brief     link delay_ms_ctx function
+ * @param[in] HANDLE pointer to a bmp180 handle structure
+ * @param[in] FUC pointer to a delay_ms_ctx function address
+ * @note      optional, it replaces delay_ms and gets the linked user context
+ */
+#define DRIVER_BMP180_LINK_DELAY_MS_CTX(HANDLE, FUC)    (HANDLE)->delay_ms_ctx = FUC
+
+/**
+ * @brief     link delay_us_ctx function
+ * @param[in] HANDLE pointer to a bmp180 handle structure
+ * @param[in] FUC pointer to a delay_us_ctx function address
+ * @note      optional, it replaces delay_us and gets the linked user context
+ */
+#define DRIVER_BMP180_LINK_DELAY_US_CTX(HANDLE, FUC)    (HANDLE)->delay_us_ctx = FUC
+
+/**
+ * @brief     link timestamp_ms_ctx function
+ * @param[in] HANDLE pointer to a bmp180 handle structure
+ * @param[in] FUC pointer to a timestamp_ms_ctx function address
+ * @note      optional, it replaces timestamp_ms and gets the linked user context
+ */
+#define DRIVER_BMP180_LINK_TIMESTAMP_MS_CTX(HANDLE, FUC)    (HANDLE)->timestamp_ms_ctx = FUC
+
+/**
+ * @brief     link wait_eoc_ctx function
+ * @param[in] HANDLE pointer to a bmp180 handle structure
+ * @param[in] FUC pointer to a wait_eoc_ctx function address
+ * @note      optional, it replaces wait_eoc and gets the linked user context
+ */
+#define DRIVER_BMP180_LINK_WAIT_EOC_CTX(HANDLE, FUC)    (HANDLE)->wait_eoc_ctx = FUC
+
+/**
+ * @brief     link timestamp_ns_ctx function
+ * @param[in] HANDLE pointer to a bmp180 handle structure
+ * @param[in] FUC pointer to a timestamp_ns_ctx function address
+ * @note      optional, it replaces timestamp_ns and gets the linked user context,
+ *            it is ignored when the metrics are disabled
+ */
+#if (BMP180_METRICS_ENABLE == 1)
+    #define DRIVER_BMP180_LINK_TIMESTAMP_NS_CTX(HANDLE, FUC) (HANDLE)->timestamp_ns_ctx = FUC
+#else
+    #define DRIVER_BMP180_LINK_TIMESTAMP_NS_CTX(HANDLE, FUC) (void)(FUC)
+#endif
+
 /**
  * @brief     link debug_print function
  * @param[in] HANDLE pointer to a bmp180 handle structure
@@ -212,6 +475,37 @@ uint8_t bmp180_info(bmp180_info_t *info);
  */
 uint8_t bmp180_init(bmp180_handle_t *handle);
 
+/**
+ * @brief     initialize the chip with a saved calibration blob
+ * @param[in] *handle pointer to a bmp180 handle structure
+ * @param[in] *buf pointer to a calibration blob
+ * @param[in] len blob length
+ * @param[in] check_id bool value, false skips the chip id read
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic initialization failed
+ *            - 2 handle is NULL
+ *            - 3 linked functions is NULL
+ *            - 4 id is error
+ *            - 6 calibration blob is invalid
+ * @note      the blob comes from bmp180_export_calibration and skips the calibration burst read
+ */
+uint8_t bmp180_init_with_calibration(bmp180_handle_t *handle, const uint8_t *buf, uint16_t len, bmp180_bool_t check_id);
+
+/**
+ * @brief      export the calibration as a crc protected blob
+ * @param[in]  *handle pointer to a bmp180 handle structure
+ * @param[out] *buf pointer to a blob buffer
+ * @param[in]  len buffer length
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 buffer is too small
+ * @note       the blob is BMP180_CALIBRATION_SIZE bytes: 0x55, version, ac1-md in chip order and crc16
+ */
+uint8_t bmp180_export_calibration(bmp180_handle_t *handle, uint8_t *buf, uint16_t len);
+
 /**
  * @brief     close the chip
  * @param[in] *handle pointer to a bmp180 handle structure
@@ -228,7 +522,7 @@ uint8_t bmp180_deinit(bmp180_handle_t *handle);
  * @brief      read the temperature and pressure data
  * @param[in]  *handle pointer to a bmp180 handle structure
  * @param[out] *temperature_raw pointer to a raw temperature buffer
- * @param[out] *temperature_c pointer to a converted temperature buffer
+ * @param[out] *temperature pointer to a temperature buffer in 0.1 degrees celsius
  * @param[out] *pressure_raw pointer to a raw pressure buffer
  * @param[out] *pressure_pa pointer to a converted pressure buffer
  * @return     status code
@@ -238,9 +532,30 @@ uint8_t bmp180_deinit(bmp180_handle_t *handle);
  *             - 3 handle is not initialized
  * @note       none
  */
+uint8_t bmp180_read_temperature_pressure_fixed(bmp180_handle_t *handle, uint16_t *temperature_raw, int32_t *temperature, 
+                                               uint32_t *pressure_raw, uint32_t *pressure_pa);
+
+#if (BMP180_FLOAT_ENABLE == 1)
+
+/**
+ * @brief      read the temperature and pressure data
+ * @param[in]  *handle pointer to a bmp180 handle structure
+ * @param[out] *temperature_raw pointer to a raw temperature buffer
+ * @param[out] *temperature_c pointer to a converted temperature buffer
+ * @param[out] *pressure_raw pointer to a raw pressure buffer
+ * @param[out] *pressure_pa pointer to a converted pressure buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       only built when BMP180_FLOAT_ENABLE is 1
+ */
 uint8_t bmp180_read_temperature_pressure(bmp180_handle_t *handle, uint16_t *temperature_raw, float *temperature_c, 
                                          uint32_t *pressure_raw, uint32_t *pressure_pa);
 
+#endif
+
 /**
  * @brief      read the pressure data
  * @param[in]  *handle pointer to a bmp180 handle structure
@@ -251,7 +566,7 @@ uint8_t bmp180_read_temperature_pressure(bmp180_handle_t *handle, uint16_t *temp
  *             - 1 pressure read failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       none
+ * @note       the temperature conversion is skipped while the temperature reuse policy allows it
  */
 uint8_t bmp180_read_pressure(bmp180_handle_t *handle, uint32_t *raw, uint32_t *pa);
 
@@ -259,7 +574,7 @@ uint8_t bmp180_read_pressure(bmp180_handle_t *handle, uint32_t *raw, uint32_t *p
  * @brief      read the temperature data
  * @param[in]  *handle pointer to a bmp180 handle structure
  * @param[out] *raw pointer to a raw temperature buffer
- * @param[out] *c pointer to a converted temperature buffer
+ * @param[out] *temperature pointer to a temperature buffer in 0.1 degrees celsius
  * @return     status code
  *             - 0 success
  *             - 1 temperature read failed
@@ -267,8 +582,26 @@ uint8_t bmp180_read_pressure(bmp180_handle_t *handle, uint32_t *raw, uint32_t *p
  *             - 3 handle is not initialized
  * @note       none
  */
+uint8_t bmp180_read_temperature_fixed(bmp180_handle_t *handle, uint16_t *raw, int32_t *temperature);
+
+#if (BMP180_FLOAT_ENABLE == 1)
+
+/**
+ * @brief      read the temperature data
+ * @param[in]  *handle pointer to a bmp180 handle structure
+ * @param[out] *raw pointer to a raw temperature buffer
+ * @param[out] *c pointer to a converted temperature buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 temperature read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       only built when BMP180_FLOAT_ENABLE is 1
+ */
 uint8_t bmp180_read_temperature(bmp180_handle_t *handle, uint16_t *raw, float *c);
 
+#endif
+
 /**
  * @brief     set the measurement mode
  * @param[in] *handle pointer to a bmp180 handle structure
@@ -293,6 +626,290 @@ uint8_t bmp180_set_mode(bmp180_handle_t *handle, bmp180_mode_t mode);
  */
 uint8_t bmp180_get_mode(bmp180_handle_t *handle, bmp180_mode_t *mode);
 
+/**
+ * @brief     start a temperature conversion without waiting
+ * @param[in] *handle pointer to a bmp180 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 conversion is running
+ * @note      fetch the result with bmp180_fetch_temperature
+ */
+uint8_t bmp180_start_temperature(bmp180_handle_t *handle);
+
+/**
+ * @brief     start a pressure conversion without waiting
+ * @param[in] *handle pointer to a bmp180 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 conversion is running
+ *            - 5 no temperature has been fetched
+ * @note      the pressure is compensated with the last fetched temperature
+ */
+uint8_t bmp180_start_pressure(bmp180_handle_t *handle);
+
+/**
+ * @brief      poll the running conversion
+ * @param[in]  *handle pointer to a bmp180 handle structure
+ * @param[out] *ready pointer to a ready flag buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 poll failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 no conversion is started
+ * @note       one status read is issued while the conversion is running
+ */
+uint8_t bmp180_poll_conversion(bmp180_handle_t *handle, bmp180_bool_t *ready);
+
+/**
+ * @brief      fetch and compensate a started temperature conversion
+ * @param[in]  *handle pointer to a bmp180 handle structure
+ * @param[out] *raw pointer to a raw temperature buffer
+ * @param[out] *temperature pointer to a temperature buffer in 0.1 degrees celsius
+ * @return     status code
+ *             - 0 success
+ *             - 1 fetch failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 no temperature conversion is started
+ *             - 5 conversion is not finished
+ * @note       the timed mode returns 5 until the datasheet time since the start has passed,
+ *             without timestamp_ms it can't check the time and an early fetch returns stale data,
+ *             the EOC mode returns 5 until wait_eoc has seen the edge and reads CTRL_MEAS for a late edge
+ */
+uint8_t bmp180_fetch_temperature_fixed(bmp180_handle_t *handle, uint16_t *raw, int32_t *temperature);
+
+#if (BMP180_FLOAT_ENABLE == 1)
+
+/**
+ * @brief      fetch and compensate a started temperature conversion
+ * @param[in]  *handle pointer to a bmp180 handle structure
+ * @param[out] *raw pointer to a raw temperature buffer
+ * @param[out] *c pointer to a converted temperature buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 fetch failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 no temperature conversion is started
+ *             - 5 conversion is not finished
+ * @note       only built when BMP180_FLOAT_ENABLE is 1,
+ *             the timed mode returns 5 until the datasheet time since the start has passed,
+ *             without timestamp_ms it can't check the time and an early fetch returns stale data,
+ *             the EOC mode returns 5 until wait_eoc has seen the edge and reads CTRL_MEAS for a late edge
+ */
+uint8_t bmp180_fetch_temperature(bmp180_handle_t *handle, uint16_t *raw, float *c);
+
+#endif
+
+/**
+ * @brief      fetch and compensate a started pressure conversion
+ * @param[in]  *handle pointer to a bmp180 handle structure
+ * @param[out] *raw pointer to a raw pressure buffer
+ * @param[out] *pa pointer to a converted pressure buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 fetch failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 no pressure conversion is started
+ *             - 5 conversion is not finished
+ * @note       the timed mode returns 5 until the datasheet time since the start has passed,
+ *             without timestamp_ms it can't check the time and an early fetch returns stale data,
+ *             the EOC mode returns 5 until wait_eoc has seen the edge and reads CTRL_MEAS for a late edge
+ */
+uint8_t bmp180_fetch_pressure(bmp180_handle_t *handle, uint32_t *raw, uint32_t *pa);
+
+/**
+ * @brief      get the conversion state
+ * @param[in]  *handle pointer to a bmp180 handle structure
+ * @param[out] *state pointer to a conversion state buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t bmp180_get_state(bmp180_handle_t *handle, bmp180_state_t *state);
+
+/**
+ * @brief     set the conversion wait mode
+ * @param[in] *handle pointer to a bmp180 handle structure
+ * @param[in] mode wait mode
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 wait_eoc is null
+ * @note      in the timed mode the fetch functions check the time since the start instead of CTRL_MEAS,
+ *            in the EOC mode they call wait_eoc with a zero timeout instead of reading CTRL_MEAS,
+ *            the EOC mode falls back to polling CTRL_MEAS when wait_eoc fails or the edge is late
+ */
+uint8_t bmp180_set_wait_mode(bmp180_handle_t *handle, bmp180_wait_mode_t mode);
+
+/**
+ * @brief      get the conversion wait mode
+ * @param[in]  *handle pointer to a bmp180 handle structure
+ * @param[out] *mode pointer to a wait mode buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t bmp180_get_wait_mode(bmp180_handle_t *handle, bmp180_wait_mode_t *mode);
+
+/**
+ * @brief     enable or disable the status and data burst readout
+ * @param[in] *handle pointer to a bmp180 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the status poll reads CTRL_MEAS and OUT_MSB-OUT_XLSB in one 5 bytes transfer,
+ *            so the data read after the poll is saved, it has no effect in the timed wait mode
+ */
+uint8_t bmp180_set_burst_read(bmp180_handle_t *handle, bmp180_bool_t enable);
+
+/**
+ * @brief      get the status and data burst readout status
+ * @param[in]  *handle pointer to a bmp180 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t bmp180_get_burst_read(bmp180_handle_t *handle, bmp180_bool_t *enable);
+
+/**
+ * @brief      get the datasheet time of the running conversion
+ * @param[in]  *handle pointer to a bmp180 handle structure
+ * @param[out] *us pointer to a conversion time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 no conversion is started
+ * @note       4.5 ms for temperature and 4.5/7.5/13.5/25.5 ms for pressure
+ */
+uint8_t bmp180_get_conversion_time(bmp180_handle_t *handle, uint32_t *us);
+
+/**
+ * @brief      get the iic transaction counters
+ * @param[in]  *handle pointer to a bmp180 handle structure
+ * @param[out] *read pointer to a read transaction counter buffer
+ * @param[out] *write pointer to a write transaction counter buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t bmp180_get_iic_count(bmp180_handle_t *handle, uint32_t *read, uint32_t *write);
+
+/**
+ * @brief     clear the iic transaction counters
+ * @param[in] *handle pointer to a bmp180 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t bmp180_clear_iic_count(bmp180_handle_t *handle);
+
+#if (BMP180_METRICS_ENABLE == 1)
+/**
+ * @brief      get the metrics
+ * @param[in]  *handle pointer to a bmp180 handle structure
+ * @param[out] *metrics pointer to a metrics buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ * @note       only built when BMP180_METRICS_ENABLE is 1,
+ *             the histograms stay empty when timestamp_ns is not linked
+ */
+uint8_t bmp180_get_metrics(bmp180_handle_t *handle, bmp180_metrics_t *metrics);
+
+/**
+ * @brief     clear the metrics
+ * @param[in] *handle pointer to a bmp180 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      only built when BMP180_METRICS_ENABLE is 1
+ */
+uint8_t bmp180_clear_metrics(bmp180_handle_t *handle);
+#endif
+
+/**
+ * @brief     set the temperature reuse policy of bmp180_read_pressure
+ * @param[in] *handle pointer to a bmp180 handle structure
+ * @param[in] samples refresh the temperature every samples pressure reads, 0 means disable
+ * @param[in] ms refresh the temperature when it is older than ms, 0 means disable
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 timestamp_ms is null
+ * @note      the temperature is measured before every pressure when both are 0
+ */
+uint8_t bmp180_set_temperature_reuse(bmp180_handle_t *handle, uint16_t samples, uint32_t ms);
+
+/**
+ * @brief      get the temperature reuse policy
+ * @param[in]  *handle pointer to a bmp180 handle structure
+ * @param[out] *samples pointer to a pressure samples buffer
+ * @param[out] *ms pointer to a reuse time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t bmp180_get_temperature_reuse(bmp180_handle_t *handle, uint16_t *samples, uint32_t *ms);
+
+/**
+ * @brief      check whether the cached temperature must be refreshed
+ * @param[in]  *handle pointer to a bmp180 handle structure
+ * @param[out] *expired pointer to an expired flag buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       split-phase callers use this to decide whether to start a temperature conversion
+ */
+uint8_t bmp180_get_temperature_expired(bmp180_handle_t *handle, bmp180_bool_t *expired);
+
+/**
+ * @brief      compensate one raw sample with the calibration of the handle
+ * @param[in]  *handle pointer to a bmp180 handle structure
+ * @param[in]  mode oversampling mode of the raw pressure
+ * @param[in]  ut raw temperature
+ * @param[in]  up raw pressure
+ * @param[out] *temperature pointer to a temperature buffer in 0.1 degrees celsius
+ * @param[out] *pa pointer to a pressure buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 mode is invalid
+ *             - 2 handle is NULL
+ *             - 4 raw data can't be compensated
+ * @note       the raw values are the ones returned by the read functions
+ *             only the calibration is used, so the handle needs no bus and no initialization
+ *             this is the reference of the batch kernels in driver_bmp180_batch.h
+ */
+uint8_t bmp180_compensate(bmp180_handle_t *handle, bmp180_mode_t mode, uint16_t ut, uint32_t up, 
+                          int32_t *temperature, uint32_t *pa);
+
 /**
  * @}
  */
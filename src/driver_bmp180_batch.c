@@ -0,0 +1,804 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_bmp180_batch.c
+ * @brief     driver bmp180 batch source file
+ * @version   2.1.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>2.1      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_bmp180_batch.h"
+
+/**
+ * @brief kernel availability definition
+ * @note  the x86 and aarch64 kernels divide in double precision, every operand is a 32 bit integer
+ *        and the 53 bit mantissa holds it exactly, so the truncated quotient equals the integer division,
+ *        armv7 neon has no vector division and divides the 4 lanes with the scalar integer division
+ */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define BMP180_BATCH_X86        1        /**< sse4.1 and avx2 kernels */
+#include <immintrin.h>
+#endif
+#if (defined(__aarch64__) || defined(__arm__)) && defined(__ARM_NEON)
+#define BMP180_BATCH_NEON       1        /**< neon kernel */
+#include <arm_neon.h>
+#endif
+
+/**
+ * @brief batch coefficient structure definition
+ */
+typedef struct bmp180_batch_coef_s
+{
+    int32_t ac1x4;        /**< ac1 * 4 */
+    int32_t ac2;          /**< ac2 */
+    int32_t ac3;          /**< ac3 */
+    int32_t ac4;          /**< ac4 */
+    int32_t ac5;          /**< ac5 */
+    int32_t ac6;          /**< ac6 */
+    int32_t b1;           /**< b1 */
+    int32_t b2;           /**< b2 */
+    int32_t mc11;         /**< mc << 11 */
+    int32_t md;           /**< md */
+    int32_t oss;          /**< oversampling setting */
+    int32_t scale;        /**< 50000 >> oss */
+    int32_t mask;         /**< shifted raw pressure mask */
+} bmp180_batch_coef_t;
+
+/**
+ * @brief     load the batch coefficients from the handle
+ * @param[in] *handle pointer to a bmp180 handle structure
+ * @param[in] mode oversampling mode
+ * @param[in] *coef pointer to a batch coefficient structure
+ * @note      none
+ */
+static void a_bmp180_batch_load(bmp180_handle_t *handle, bmp180_mode_t mode, bmp180_batch_coef_t *coef)
+{
+    coef->ac1x4 = (int32_t)handle->ac1 * 4;                             /* ac1 * 4 */
+    coef->ac2 = (int32_t)handle->ac2;                                   /* ac2 */
+    coef->ac3 = (int32_t)handle->ac3;                                   /* ac3 */
+    coef->ac4 = (int32_t)handle->ac4;                                   /* ac4 */
+    coef->ac5 = (int32_t)handle->ac5;                                   /* ac5 */
+    coef->ac6 = (int32_t)handle->ac6;                                   /* ac6 */
+    coef->b1 = (int32_t)handle->b1;                                     /* b1 */
+    coef->b2 = (int32_t)handle->b2;                                     /* b2 */
+    coef->mc11 = ((int32_t)handle->mc) << 11;                           /* mc << 11 */
+    coef->md = (int32_t)handle->md;                                     /* md */
+    coef->oss = (int32_t)mode;                                          /* oss */
+    coef->scale = 50000 >> coef->oss;                                   /* scale */
+    coef->mask = (int32_t)(0x0007FFFFU >> (3 - coef->oss));             /* mask */
+}
+
+/**
+ * @brief      scalar reference kernel
+ * @param[in]  *handle pointer to a bmp180 handle structure
+ * @param[in]  mode oversampling mode
+ * @param[in]  *ut pointer to a raw temperature array
+ * @param[in]  *up pointer to a raw pressure array
+ * @param[out] *temperature pointer to a temperature array
+ * @param[out] *pa pointer to a pressure array
+ * @param[in]  len array length
+ * @return     invalid sample flag
+ * @note       none
+ */
+static uint8_t a_bmp180_batch_scalar(bmp180_handle_t *handle, bmp180_mode_t mode, const uint16_t *ut, const uint32_t *up,
+                                     int32_t *temperature, uint32_t *pa, uint32_t len)
+{
+    uint32_t i;
+    uint8_t invalid;
+    
+    invalid = 0;                                                                                /* init 0 */
+    for (i = 0; i < len; i++)                                                                   /* run all samples */
+    {
+        if (bmp180_compensate(handle, mode, ut[i], up[i], &temperature[i], &pa[i]) != 0)        /* compensate the sample */
+        {
+            temperature[i] = 0;                                                                 /* clear the temperature */
+            pa[i] = 0;                                                                          /* clear the pressure */
+            invalid = 1;                                                                        /* flag the invalid sample */
+        }
+    }
+    
+    return invalid;                                                                             /* return the flag */
+}
+
+#ifdef BMP180_BATCH_X86
+
+/**
+ * @brief     signed 32 bit division of 4 lanes
+ * @param[in] n numerator
+ * @param[in] d divisor
+ * @return    quotient truncated toward zero
+ * @note      none
+ */
+__attribute__((target("sse4.1")))
+static inline __m128i a_bmp180_div_s32_sse41(__m128i n, __m128i d)
+{
+    __m128d nl, nh, dl, dh;
+    __m128i ql, qh;
+    
+    nl = _mm_cvtepi32_pd(n);                                                    /* lanes 0 and 1 of n to double */
+    nh = _mm_cvtepi32_pd(_mm_shuffle_epi32(n, _MM_SHUFFLE(1, 0, 3, 2)));        /* lanes 2 and 3 of n to double */
+    dl = _mm_cvtepi32_pd(d);                                                    /* lanes 0 and 1 of d to double */
+    dh = _mm_cvtepi32_pd(_mm_shuffle_epi32(d, _MM_SHUFFLE(1, 0, 3, 2)));        /* lanes 2 and 3 of d to double */
+    ql = _mm_cvttpd_epi32(_mm_div_pd(nl, dl));                                  /* divide and truncate toward zero */
+    qh = _mm_cvttpd_epi32(_mm_div_pd(nh, dh));                                  /* divide and truncate toward zero */
+    
+    return _mm_unpacklo_epi64(ql, qh);                                          /* join the 4 quotients */
+}
+
+/**
+ * @brief     unsigned 32 bit division of 4 lanes
+ * @param[in] n numerator
+ * @param[in] d divisor
+ * @return    quotient
+ * @note      none
+ */
+__attribute__((target("sse4.1")))
+static inline __m128i a_bmp180_div_u32_sse41(__m128i n, __m128i d)
+{
+    const __m128i sign = _mm_set1_epi32((int32_t)0x80000000U);
+    const __m128d bias = _mm_set1_pd(2147483648.0);
+    __m128d nl, nh, dl, dh, ql, qh;
+    __m128i ns, ds, q;
+    
+    ns = _mm_xor_si128(n, sign);                                                 /* flip the sign bit, n - 2^31 as signed */
+    ds = _mm_xor_si128(d, sign);                                                 /* flip the sign bit, d - 2^31 as signed */
+    nl = _mm_cvtepi32_pd(ns);                                                    /* lanes 0 and 1 of n to double */
+    nh = _mm_cvtepi32_pd(_mm_shuffle_epi32(ns, _MM_SHUFFLE(1, 0, 3, 2)));        /* lanes 2 and 3 of n to double */
+    dl = _mm_cvtepi32_pd(ds);                                                    /* lanes 0 and 1 of d to double */
+    dh = _mm_cvtepi32_pd(_mm_shuffle_epi32(ds, _MM_SHUFFLE(1, 0, 3, 2)));        /* lanes 2 and 3 of d to double */
+    nl = _mm_add_pd(nl, bias);                                                   /* add 2^31 back, n as unsigned */
+    nh = _mm_add_pd(nh, bias);                                                   /* add 2^31 back, n as unsigned */
+    dl = _mm_add_pd(dl, bias);                                                   /* add 2^31 back, d as unsigned */
+    dh = _mm_add_pd(dh, bias);                                                   /* add 2^31 back, d as unsigned */
+    ql = _mm_div_pd(nl, dl);                                                     /* divide lanes 0 and 1 */
+    qh = _mm_div_pd(nh, dh);                                                     /* divide lanes 2 and 3 */
+    ql = _mm_round_pd(ql, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);               /* round toward zero */
+    qh = _mm_round_pd(qh, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);               /* round toward zero */
+    ql = _mm_sub_pd(ql, bias);                                                   /* subtract 2^31, exact below 2^32 */
+    qh = _mm_sub_pd(qh, bias);                                                   /* subtract 2^31, exact below 2^32 */
+    q = _mm_unpacklo_epi64(_mm_cvttpd_epi32(ql), _mm_cvttpd_epi32(qh));          /* join the 4 biased quotients */
+    
+    return _mm_xor_si128(q, sign);                                               /* flip the sign bit back */
+}
+
+/**
+ * @brief      sse4.1 kernel
+ * @param[in]  *coef pointer to a batch coefficient structure
+ * @param[in]  *ut pointer to a raw temperature array
+ * @param[in]  *up pointer to a raw pressure array
+ * @param[out] *temperature pointer to a temperature array
+ * @param[out] *pa pointer to a pressure array
+ * @param[in]  len array length, a multiple of 4
+ * @return     invalid sample flag
+ * @note       none
+ */
+__attribute__((target("sse4.1")))
+static uint8_t a_bmp180_batch_sse41(const bmp180_batch_coef_t *coef, const uint16_t *ut, const uint32_t *up,
+                                    int32_t *temperature, uint32_t *pa, uint32_t len)
+{
+    const __m128i ac1x4 = _mm_set1_epi32(coef->ac1x4);
+    const __m128i ac2 = _mm_set1_epi32(coef->ac2);
+    const __m128i ac3 = _mm_set1_epi32(coef->ac3);
+    const __m128i ac4 = _mm_set1_epi32(coef->ac4);
+    const __m128i ac5 = _mm_set1_epi32(coef->ac5);
+    const __m128i ac6 = _mm_set1_epi32(coef->ac6);
+    const __m128i b1 = _mm_set1_epi32(coef->b1);
+    const __m128i b2 = _mm_set1_epi32(coef->b2);
+    const __m128i mc11 = _mm_set1_epi32(coef->mc11);
+    const __m128i md = _mm_set1_epi32(coef->md);
+    const __m128i scale = _mm_set1_epi32(coef->scale);
+    const __m128i mask = _mm_set1_epi32(coef->mask);
+    const __m128i oss = _mm_cvtsi32_si128(coef->oss);
+    const __m128i shift = _mm_cvtsi32_si128(8 - coef->oss);
+    const __m128i zero = _mm_setzero_si128();
+    int invalid = 0;
+    uint32_t i;
+    
+    for (i = 0; i < len; i += 4)                                                       /* 4 samples per round */
+    {
+        __m128i x1, x2, x3, d, b5, b6, b6b6, b3, b4, b7, hi, p, t, bad;
+        
+        /* temperature */
+        x1 = _mm_cvtepu16_epi32(_mm_loadl_epi64((const __m128i *)&ut[i]));             /* load 4 ut */
+        x1 = _mm_mullo_epi32(_mm_sub_epi32(x1, ac6), ac5);                             /* (ut - ac6) * ac5 */
+        x1 = _mm_srai_epi32(x1, 15);                                                   /* x1 = ... >> 15 */
+        d = _mm_add_epi32(x1, md);                                                     /* x1 + md */
+        bad = _mm_cmpeq_epi32(d, zero);                                                /* flag the zero divisors, they divide by 1 */
+        x2 = a_bmp180_div_s32_sse41(mc11, _mm_sub_epi32(d, bad));                      /* x2 = (mc << 11) / (x1 + md) */
+        b5 = _mm_add_epi32(x1, x2);                                                    /* b5 = x1 + x2 */
+        t = _mm_srai_epi32(_mm_add_epi32(b5, _mm_set1_epi32(8)), 4);                   /* t = (b5 + 8) >> 4 */
+        
+        /* pressure coefficients */
+        b6 = _mm_sub_epi32(b5, _mm_set1_epi32(4000));                                  /* b6 = b5 - 4000 */
+        b6b6 = _mm_srai_epi32(_mm_mullo_epi32(b6, b6), 12);                            /* (b6 * b6) >> 12 */
+        x1 = _mm_srai_epi32(_mm_mullo_epi32(b2, b6b6), 11);                            /* x1 = (b2 * b6b6) >> 11 */
+        x2 = _mm_srai_epi32(_mm_mullo_epi32(ac2, b6), 11);                             /* x2 = (ac2 * b6) >> 11 */
+        x3 = _mm_add_epi32(x1, x2);                                                    /* x3 = x1 + x2 */
+        b3 = _mm_sll_epi32(_mm_add_epi32(ac1x4, x3), oss);                             /* (ac1 * 4 + x3) << oss */
+        b3 = _mm_srai_epi32(_mm_add_epi32(b3, _mm_set1_epi32(2)), 2);                  /* b3 = (... + 2) >> 2 */
+        x1 = _mm_srai_epi32(_mm_mullo_epi32(ac3, b6), 13);                             /* x1 = (ac3 * b6) >> 13 */
+        x2 = _mm_srai_epi32(_mm_mullo_epi32(b1, b6b6), 16);                            /* x2 = (b1 * b6b6) >> 16 */
+        x3 = _mm_add_epi32(x1, x2);                                                    /* x1 + x2 */
+        x3 = _mm_srai_epi32(_mm_add_epi32(x3, _mm_set1_epi32(2)), 2);                  /* x3 = (x1 + x2 + 2) >> 2 */
+        b4 = _mm_mullo_epi32(ac4, _mm_add_epi32(x3, _mm_set1_epi32(32768)));           /* ac4 * (x3 + 32768) as unsigned */
+        b4 = _mm_srli_epi32(b4, 15);                                                   /* b4 = ... >> 15, logical */
+        x1 = _mm_cmpeq_epi32(b4, zero);                                                /* flag the zero b4 */
+        bad = _mm_or_si128(bad, x1);                                                   /* merge the invalid lanes */
+        b4 = _mm_sub_epi32(b4, x1);                                                    /* 0 divides by 1 */
+        
+        /* pressure */
+        x1 = _mm_srl_epi32(_mm_loadu_si128((const __m128i *)&up[i]), shift);           /* load 4 up and shift by 8 - oss */
+        x1 = _mm_and_si128(x1, mask);                                                  /* mask the raw pressure */
+        b7 = _mm_mullo_epi32(_mm_sub_epi32(x1, b3), scale);                            /* b7 = (up - b3) * (50000 >> oss) */
+        hi = _mm_srai_epi32(b7, 31);                                                   /* lanes with b7 >= 0x80000000 */
+        p = _mm_blendv_epi8(_mm_slli_epi32(b7, 1), b7, hi);                            /* b7 << 1 or b7 for the high lanes */
+        p = a_bmp180_div_u32_sse41(p, b4);                                             /* unsigned division by b4 */
+        p = _mm_blendv_epi8(p, _mm_slli_epi32(p, 1), hi);                              /* p = (b7 * 2) / b4 or (b7 / b4) * 2 */
+        x1 = _mm_srai_epi32(p, 8);                                                     /* p >> 8 */
+        x1 = _mm_mullo_epi32(x1, x1);                                                  /* x1 = (p >> 8) * (p >> 8) */
+        x1 = _mm_srai_epi32(_mm_mullo_epi32(x1, _mm_set1_epi32(3038)), 16);            /* x1 = (x1 * 3038) >> 16 */
+        x2 = _mm_srai_epi32(_mm_mullo_epi32(p, _mm_set1_epi32(-7357)), 16);            /* x2 = (-7357 * p) >> 16 */
+        x3 = _mm_add_epi32(_mm_add_epi32(x1, x2), _mm_set1_epi32(3791));               /* x1 + x2 + 3791 */
+        p = _mm_add_epi32(p, _mm_srai_epi32(x3, 4));                                   /* p = p + ((x1 + x2 + 3791) >> 4) */
+        
+        /* store */
+        _mm_storeu_si128((__m128i *)&temperature[i], _mm_andnot_si128(bad, t));        /* store the masked temperature */
+        _mm_storeu_si128((__m128i *)&pa[i], _mm_andnot_si128(bad, p));                 /* store the masked pressure */
+        invalid |= _mm_movemask_ps(_mm_castsi128_ps(bad));                             /* collect the invalid lanes */
+    }
+    
+    return (invalid != 0) ? 1 : 0;                                                     /* return the flag */
+}
+
+/**
+ * @brief     signed 32 bit division of 8 lanes
+ * @param[in] n numerator
+ * @param[in] d divisor
+ * @return    quotient truncated toward zero
+ * @note      none
+ */
+__attribute__((target("avx2")))
+static inline __m256i a_bmp180_div_s32_avx2(__m256i n, __m256i d)
+{
+    __m256d nl, nh, dl, dh;
+    __m128i ql, qh;
+    
+    nl = _mm256_cvtepi32_pd(_mm256_castsi256_si128(n));                       /* lanes 0 - 3 of n to double */
+    nh = _mm256_cvtepi32_pd(_mm256_extracti128_si256(n, 1));                  /* lanes 4 - 7 of n to double */
+    dl = _mm256_cvtepi32_pd(_mm256_castsi256_si128(d));                       /* lanes 0 - 3 of d to double */
+    dh = _mm256_cvtepi32_pd(_mm256_extracti128_si256(d, 1));                  /* lanes 4 - 7 of d to double */
+    ql = _mm256_cvttpd_epi32(_mm256_div_pd(nl, dl));                          /* divide and truncate toward zero */
+    qh = _mm256_cvttpd_epi32(_mm256_div_pd(nh, dh));                          /* divide and truncate toward zero */
+    
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(ql), qh, 1);        /* join the 8 quotients */
+}
+
+/**
+ * @brief     unsigned 32 bit division of 8 lanes
+ * @param[in] n numerator
+ * @param[in] d divisor
+ * @return    quotient
+ * @note      none
+ */
+__attribute__((target("avx2")))
+static inline __m256i a_bmp180_div_u32_avx2(__m256i n, __m256i d)
+{
+    const __m256i sign = _mm256_set1_epi32((int32_t)0x80000000U);
+    const __m256d bias = _mm256_set1_pd(2147483648.0);
+    __m256d nl, nh, dl, dh, ql, qh;
+    __m256i ns, ds, q;
+    
+    ns = _mm256_xor_si256(n, sign);                                          /* flip the sign bit, n - 2^31 as signed */
+    ds = _mm256_xor_si256(d, sign);                                          /* flip the sign bit, d - 2^31 as signed */
+    nl = _mm256_cvtepi32_pd(_mm256_castsi256_si128(ns));                     /* lanes 0 - 3 of n to double */
+    nh = _mm256_cvtepi32_pd(_mm256_extracti128_si256(ns, 1));                /* lanes 4 - 7 of n to double */
+    dl = _mm256_cvtepi32_pd(_mm256_castsi256_si128(ds));                     /* lanes 0 - 3 of d to double */
+    dh = _mm256_cvtepi32_pd(_mm256_extracti128_si256(ds, 1));                /* lanes 4 - 7 of d to double */
+    nl = _mm256_add_pd(nl, bias);                                            /* add 2^31 back, n as unsigned */
+    nh = _mm256_add_pd(nh, bias);                                            /* add 2^31 back, n as unsigned */
+    dl = _mm256_add_pd(dl, bias);                                            /* add 2^31 back, d as unsigned */
+    dh = _mm256_add_pd(dh, bias);                                            /* add 2^31 back, d as unsigned */
+    ql = _mm256_div_pd(nl, dl);                                              /* divide lanes 0 - 3 */
+    qh = _mm256_div_pd(nh, dh);                                              /* divide lanes 4 - 7 */
+    ql = _mm256_round_pd(ql, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);        /* round toward zero */
+    qh = _mm256_round_pd(qh, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);        /* round toward zero */
+    ql = _mm256_sub_pd(ql, bias);                                            /* subtract 2^31, exact below 2^32 */
+    qh = _mm256_sub_pd(qh, bias);                                            /* subtract 2^31, exact below 2^32 */
+    q = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm256_cvttpd_epi32(ql)),
+                                _mm256_cvttpd_epi32(qh), 1);                 /* join the 8 biased quotients */
+    
+    return _mm256_xor_si256(q, sign);                                        /* flip the sign bit back */
+}
+
+/**
+ * @brief      avx2 kernel
+ * @param[in]  *coef pointer to a batch coefficient structure
+ * @param[in]  *ut pointer to a raw temperature array
+ * @param[in]  *up pointer to a raw pressure array
+ * @param[out] *temperature pointer to a temperature array
+ * @param[out] *pa pointer to a pressure array
+ * @param[in]  len array length, a multiple of 8
+ * @return     invalid sample flag
+ * @note       none
+ */
+__attribute__((target("avx2")))
+static uint8_t a_bmp180_batch_avx2(const bmp180_batch_coef_t *coef, const uint16_t *ut, const uint32_t *up,
+                                   int32_t *temperature, uint32_t *pa, uint32_t len)
+{
+    const __m256i ac1x4 = _mm256_set1_epi32(coef->ac1x4);
+    const __m256i ac2 = _mm256_set1_epi32(coef->ac2);
+    const __m256i ac3 = _mm256_set1_epi32(coef->ac3);
+    const __m256i ac4 = _mm256_set1_epi32(coef->ac4);
+    const __m256i ac5 = _mm256_set1_epi32(coef->ac5);
+    const __m256i ac6 = _mm256_set1_epi32(coef->ac6);
+    const __m256i b1 = _mm256_set1_epi32(coef->b1);
+    const __m256i b2 = _mm256_set1_epi32(coef->b2);
+    const __m256i mc11 = _mm256_set1_epi32(coef->mc11);
+    const __m256i md = _mm256_set1_epi32(coef->md);
+    const __m256i scale = _mm256_set1_epi32(coef->scale);
+    const __m256i mask = _mm256_set1_epi32(coef->mask);
+    const __m128i oss = _mm_cvtsi32_si128(coef->oss);
+    const __m128i shift = _mm_cvtsi32_si128(8 - coef->oss);
+    const __m256i zero = _mm256_setzero_si256();
+    int invalid = 0;
+    uint32_t i;
+    
+    for (i = 0; i < len; i += 8)                                                             /* 8 samples per round */
+    {
+        __m256i x1, x2, x3, d, b5, b6, b6b6, b3, b4, b7, hi, p, t, bad;
+        
+        /* temperature */
+        x1 = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)&ut[i]));                /* load 8 ut */
+        x1 = _mm256_mullo_epi32(_mm256_sub_epi32(x1, ac6), ac5);                             /* (ut - ac6) * ac5 */
+        x1 = _mm256_srai_epi32(x1, 15);                                                      /* x1 = ... >> 15 */
+        d = _mm256_add_epi32(x1, md);                                                        /* x1 + md */
+        bad = _mm256_cmpeq_epi32(d, zero);                                                   /* flag the zero divisors, they divide by 1 */
+        x2 = a_bmp180_div_s32_avx2(mc11, _mm256_sub_epi32(d, bad));                          /* x2 = (mc << 11) / (x1 + md) */
+        b5 = _mm256_add_epi32(x1, x2);                                                       /* b5 = x1 + x2 */
+        t = _mm256_srai_epi32(_mm256_add_epi32(b5, _mm256_set1_epi32(8)), 4);                /* t = (b5 + 8) >> 4 */
+        
+        /* pressure coefficients */
+        b6 = _mm256_sub_epi32(b5, _mm256_set1_epi32(4000));                                  /* b6 = b5 - 4000 */
+        b6b6 = _mm256_srai_epi32(_mm256_mullo_epi32(b6, b6), 12);                            /* (b6 * b6) >> 12 */
+        x1 = _mm256_srai_epi32(_mm256_mullo_epi32(b2, b6b6), 11);                            /* x1 = (b2 * b6b6) >> 11 */
+        x2 = _mm256_srai_epi32(_mm256_mullo_epi32(ac2, b6), 11);                             /* x2 = (ac2 * b6) >> 11 */
+        x3 = _mm256_add_epi32(x1, x2);                                                       /* x3 = x1 + x2 */
+        b3 = _mm256_sll_epi32(_mm256_add_epi32(ac1x4, x3), oss);                             /* (ac1 * 4 + x3) << oss */
+        b3 = _mm256_srai_epi32(_mm256_add_epi32(b3, _mm256_set1_epi32(2)), 2);               /* b3 = (... + 2) >> 2 */
+        x1 = _mm256_srai_epi32(_mm256_mullo_epi32(ac3, b6), 13);                             /* x1 = (ac3 * b6) >> 13 */
+        x2 = _mm256_srai_epi32(_mm256_mullo_epi32(b1, b6b6), 16);                            /* x2 = (b1 * b6b6) >> 16 */
+        x3 = _mm256_add_epi32(x1, x2);                                                       /* x1 + x2 */
+        x3 = _mm256_srai_epi32(_mm256_add_epi32(x3, _mm256_set1_epi32(2)), 2);               /* x3 = (x1 + x2 + 2) >> 2 */
+        b4 = _mm256_mullo_epi32(ac4, _mm256_add_epi32(x3, _mm256_set1_epi32(32768)));        /* ac4 * (x3 + 32768) as unsigned */
+        b4 = _mm256_srli_epi32(b4, 15);                                                      /* b4 = ... >> 15, logical */
+        x1 = _mm256_cmpeq_epi32(b4, zero);                                                   /* flag the zero b4 */
+        bad = _mm256_or_si256(bad, x1);                                                      /* merge the invalid lanes */
+        b4 = _mm256_sub_epi32(b4, x1);                                                       /* 0 divides by 1 */
+        
+        /* pressure */
+        x1 = _mm256_srl_epi32(_mm256_loadu_si256((const __m256i *)&up[i]), shift);           /* load 8 up and shift by 8 - oss */
+        x1 = _mm256_and_si256(x1, mask);                                                     /* mask the raw pressure */
+        b7 = _mm256_mullo_epi32(_mm256_sub_epi32(x1, b3), scale);                            /* b7 = (up - b3) * (50000 >> oss) */
+        hi = _mm256_srai_epi32(b7, 31);                                                      /* lanes with b7 >= 0x80000000 */
+        p = _mm256_blendv_epi8(_mm256_slli_epi32(b7, 1), b7, hi);                            /* b7 << 1 or b7 for the high lanes */
+        p = a_bmp180_div_u32_avx2(p, b4);                                                    /* unsigned division by b4 */
+        p = _mm256_blendv_epi8(p, _mm256_slli_epi32(p, 1), hi);                              /* p = (b7 * 2) / b4 or (b7 / b4) * 2 */
+        x1 = _mm256_srai_epi32(p, 8);                                                        /* p >> 8 */
+        x1 = _mm256_mullo_epi32(x1, x1);                                                     /* x1 = (p >> 8) * (p >> 8) */
+        x1 = _mm256_srai_epi32(_mm256_mullo_epi32(x1, _mm256_set1_epi32(3038)), 16);         /* x1 = (x1 * 3038) >> 16 */
+        x2 = _mm256_srai_epi32(_mm256_mullo_epi32(p, _mm256_set1_epi32(-7357)), 16);         /* x2 = (-7357 * p) >> 16 */
+        x3 = _mm256_add_epi32(_mm256_add_epi32(x1, x2), _mm256_set1_epi32(3791));            /* x1 + x2 + 3791 */
+        p = _mm256_add_epi32(p, _mm256_srai_epi32(x3, 4));                                   /* p = p + ((x1 + x2 + 3791) >> 4) */
+        
+        /* store */
+        _mm256_storeu_si256((__m256i *)&temperature[i], _mm256_andnot_si256(bad, t));        /* store the masked temperature */
+        _mm256_storeu_si256((__m256i *)&pa[i], _mm256_andnot_si256(bad, p));                 /* store the masked pressure */
+        invalid |= _mm256_movemask_ps(_mm256_castsi256_ps(bad));                             /* collect the invalid lanes */
+    }
+    
+    return (invalid != 0) ? 1 : 0;                                                           /* return the flag */
+}
+
+#endif
+
+#ifdef BMP180_BATCH_NEON
+
+#if defined(__aarch64__)
+
+/**
+ * @brief     signed 32 bit division of 4 lanes
+ * @param[in] n numerator
+ * @param[in] d divisor
+ * @return    quotient truncated toward zero
+ * @note      none
+ */
+static inline int32x4_t a_bmp180_div_s32_neon(int32x4_t n, int32x4_t d)
+{
+    float64x2_t nl, nh, dl, dh;
+    
+    nl = vcvtq_f64_s64(vmovl_s32(vget_low_s32(n)));                                         /* lanes 0 and 1 of n to double */
+    nh = vcvtq_f64_s64(vmovl_s32(vget_high_s32(n)));                                        /* lanes 2 and 3 of n to double */
+    dl = vcvtq_f64_s64(vmovl_s32(vget_low_s32(d)));                                         /* lanes 0 and 1 of d to double */
+    dh = vcvtq_f64_s64(vmovl_s32(vget_high_s32(d)));                                        /* lanes 2 and 3 of d to double */
+    nl = vdivq_f64(nl, dl);                                                                 /* divide lanes 0 and 1 */
+    nh = vdivq_f64(nh, dh);                                                                 /* divide lanes 2 and 3 */
+    
+    return vcombine_s32(vmovn_s64(vcvtq_s64_f64(nl)), vmovn_s64(vcvtq_s64_f64(nh)));        /* truncate toward zero and narrow */
+}
+
+/**
+ * @brief     unsigned 32 bit division of 4 lanes
+ * @param[in] n numerator
+ * @param[in] d divisor
+ * @return    quotient
+ * @note      none
+ */
+static inline uint32x4_t a_bmp180_div_u32_neon(uint32x4_t n, uint32x4_t d)
+{
+    float64x2_t nl, nh, dl, dh;
+    
+    nl = vcvtq_f64_u64(vmovl_u32(vget_low_u32(n)));                                         /* lanes 0 and 1 of n to double */
+    nh = vcvtq_f64_u64(vmovl_u32(vget_high_u32(n)));                                        /* lanes 2 and 3 of n to double */
+    dl = vcvtq_f64_u64(vmovl_u32(vget_low_u32(d)));                                         /* lanes 0 and 1 of d to double */
+    dh = vcvtq_f64_u64(vmovl_u32(vget_high_u32(d)));                                        /* lanes 2 and 3 of d to double */
+    nl = vdivq_f64(nl, dl);                                                                 /* divide lanes 0 and 1 */
+    nh = vdivq_f64(nh, dh);                                                                 /* divide lanes 2 and 3 */
+    
+    return vcombine_u32(vmovn_u64(vcvtq_u64_f64(nl)), vmovn_u64(vcvtq_u64_f64(nh)));        /* truncate toward zero and narrow */
+}
+
+#else
+
+/**
+ * @brief     signed 32 bit division of 4 lanes
+ * @param[in] n numerator
+ * @param[in] d divisor
+ * @return    quotient truncated toward zero
+ * @note      armv7 neon has no division, every lane is divided with the scalar division
+ */
+static inline int32x4_t a_bmp180_div_s32_neon(int32x4_t n, int32x4_t d)
+{
+    int32_t a[4];
+    int32_t b[4];
+    
+    vst1q_s32(a, n);            /* spill the numerators */
+    vst1q_s32(b, d);            /* spill the divisors */
+    a[0] = a[0] / b[0];         /* divide lane 0 */
+    a[1] = a[1] / b[1];         /* divide lane 1 */
+    a[2] = a[2] / b[2];         /* divide lane 2 */
+    a[3] = a[3] / b[3];         /* divide lane 3 */
+    
+    return vld1q_s32(a);        /* reload the quotients */
+}
+
+/**
+ * @brief     unsigned 32 bit division of 4 lanes
+ * @param[in] n numerator
+ * @param[in] d divisor
+ * @return    quotient
+ * @note      armv7 neon has no division, every lane is divided with the scalar division
+ */
+static inline uint32x4_t a_bmp180_div_u32_neon(uint32x4_t n, uint32x4_t d)
+{
+    uint32_t a[4];
+    uint32_t b[4];
+    
+    vst1q_u32(a, n);            /* spill the numerators */
+    vst1q_u32(b, d);            /* spill the divisors */
+    a[0] = a[0] / b[0];         /* divide lane 0 */
+    a[1] = a[1] / b[1];         /* divide lane 1 */
+    a[2] = a[2] / b[2];         /* divide lane 2 */
+    a[3] = a[3] / b[3];         /* divide lane 3 */
+    
+    return vld1q_u32(a);        /* reload the quotients */
+}
+
+#endif
+
+/**
+ * @brief      neon kernel
+ * @param[in]  *coef pointer to a batch coefficient structure
+ * @param[in]  *ut pointer to a raw temperature array
+ * @param[in]  *up pointer to a raw pressure array
+ * @param[out] *temperature pointer to a temperature array
+ * @param[out] *pa pointer to a pressure array
+ * @param[in]  len array length, a multiple of 4
+ * @return     invalid sample flag
+ * @note       none
+ */
+static uint8_t a_bmp180_batch_neon(const bmp180_batch_coef_t *coef, const uint16_t *ut, const uint32_t *up,
+                                   int32_t *temperature, uint32_t *pa, uint32_t len)
+{
+    const int32x4_t ac1x4 = vdupq_n_s32(coef->ac1x4);
+    const int32x4_t ac2 = vdupq_n_s32(coef->ac2);
+    const int32x4_t ac3 = vdupq_n_s32(coef->ac3);
+    const uint32x4_t ac4 = vdupq_n_u32((uint32_t)coef->ac4);
+    const int32x4_t ac5 = vdupq_n_s32(coef->ac5);
+    const int32x4_t ac6 = vdupq_n_s32(coef->ac6);
+    const int32x4_t b1 = vdupq_n_s32(coef->b1);
+    const int32x4_t b2 = vdupq_n_s32(coef->b2);
+    const int32x4_t mc11 = vdupq_n_s32(coef->mc11);
+    const int32x4_t md = vdupq_n_s32(coef->md);
+    const uint32x4_t scale = vdupq_n_u32((uint32_t)coef->scale);
+    const uint32x4_t mask = vdupq_n_u32((uint32_t)coef->mask);
+    const int32x4_t oss = vdupq_n_s32(coef->oss);
+    const int32x4_t shift = vdupq_n_s32(coef->oss - 8);
+    uint32x4_t invalid = vdupq_n_u32(0);
+    uint32x2_t m;
+    uint32_t i;
+    
+    for (i = 0; i < len; i += 4)                                                           /* 4 samples per round */
+    {
+        int32x4_t x1, x2, x3, d, b5, b6, b6b6, b3, p, t;
+        uint32x4_t u, b4, b7, hi, q, bad, zb4;
+        
+        /* temperature */
+        x1 = vreinterpretq_s32_u32(vmovl_u16(vld1_u16(&ut[i])));                           /* load 4 ut */
+        x1 = vmulq_s32(vsubq_s32(x1, ac6), ac5);                                           /* (ut - ac6) * ac5 */
+        x1 = vshrq_n_s32(x1, 15);                                                          /* x1 = ... >> 15 */
+        d = vaddq_s32(x1, md);                                                             /* x1 + md */
+        bad = vceqq_s32(d, vdupq_n_s32(0));                                                /* flag the zero divisors, they divide by 1 */
+        x2 = a_bmp180_div_s32_neon(mc11, vsubq_s32(d, vreinterpretq_s32_u32(bad)));        /* x2 = (mc << 11) / (x1 + md) */
+        b5 = vaddq_s32(x1, x2);                                                            /* b5 = x1 + x2 */
+        t = vshrq_n_s32(vaddq_s32(b5, vdupq_n_s32(8)), 4);                                 /* t = (b5 + 8) >> 4 */
+        
+        /* pressure coefficients */
+        b6 = vsubq_s32(b5, vdupq_n_s32(4000));                                             /* b6 = b5 - 4000 */
+        b6b6 = vshrq_n_s32(vmulq_s32(b6, b6), 12);                                         /* (b6 * b6) >> 12 */
+        x1 = vshrq_n_s32(vmulq_s32(b2, b6b6), 11);                                         /* x1 = (b2 * b6b6) >> 11 */
+        x2 = vshrq_n_s32(vmulq_s32(ac2, b6), 11);                                          /* x2 = (ac2 * b6) >> 11 */
+        x3 = vaddq_s32(x1, x2);                                                            /* x3 = x1 + x2 */
+        b3 = vshlq_s32(vaddq_s32(ac1x4, x3), oss);                                         /* (ac1 * 4 + x3) << oss */
+        b3 = vshrq_n_s32(vaddq_s32(b3, vdupq_n_s32(2)), 2);                                /* b3 = (... + 2) >> 2 */
+        x1 = vshrq_n_s32(vmulq_s32(ac3, b6), 13);                                          /* x1 = (ac3 * b6) >> 13 */
+        x2 = vshrq_n_s32(vmulq_s32(b1, b6b6), 16);                                         /* x2 = (b1 * b6b6) >> 16 */
+        x3 = vaddq_s32(x1, x2);                                                            /* x1 + x2 */
+        x3 = vshrq_n_s32(vaddq_s32(x3, vdupq_n_s32(2)), 2);                                /* x3 = (x1 + x2 + 2) >> 2 */
+        b4 = vreinterpretq_u32_s32(vaddq_s32(x3, vdupq_n_s32(32768)));                     /* x3 + 32768 as unsigned */
+        b4 = vmulq_u32(ac4, b4);                                                           /* ac4 * (x3 + 32768) */
+        b4 = vshrq_n_u32(b4, 15);                                                          /* b4 = ... >> 15 */
+        zb4 = vceqq_u32(b4, vdupq_n_u32(0));                                               /* flag the zero b4 */
+        bad = vorrq_u32(bad, zb4);                                                         /* merge the invalid lanes */
+        b4 = vsubq_u32(b4, zb4);                                                           /* 0 divides by 1 */
+        
+        /* pressure */
+        u = vandq_u32(vshlq_u32(vld1q_u32(&up[i]), shift), mask);                          /* load 4 up, shift by 8 - oss and mask */
+        b7 = vmulq_u32(vsubq_u32(u, vreinterpretq_u32_s32(b3)), scale);                    /* b7 = (up - b3) * (50000 >> oss) */
+        hi = vcgeq_u32(b7, vdupq_n_u32(0x80000000U));                                      /* lanes with b7 >= 0x80000000 */
+        q = a_bmp180_div_u32_neon(vbslq_u32(hi, b7, vshlq_n_u32(b7, 1)), b4);              /* b7 << 1 or b7 for the high lanes, / b4 */
+        p = vreinterpretq_s32_u32(vbslq_u32(hi, vshlq_n_u32(q, 1), q));                    /* p = (b7 * 2) / b4 or (b7 / b4) * 2 */
+        x1 = vshrq_n_s32(p, 8);                                                            /* p >> 8 */
+        x1 = vmulq_s32(x1, x1);                                                            /* x1 = (p >> 8) * (p >> 8) */
+        x1 = vshrq_n_s32(vmulq_s32(x1, vdupq_n_s32(3038)), 16);                            /* x1 = (x1 * 3038) >> 16 */
+        x2 = vshrq_n_s32(vmulq_s32(p, vdupq_n_s32(-7357)), 16);                            /* x2 = (-7357 * p) >> 16 */
+        x3 = vaddq_s32(vaddq_s32(x1, x2), vdupq_n_s32(3791));                              /* x1 + x2 + 3791 */
+        p = vaddq_s32(p, vshrq_n_s32(x3, 4));                                              /* p = p + ((x1 + x2 + 3791) >> 4) */
+        
+        /* store */
+        vst1q_s32(&temperature[i], vbicq_s32(t, vreinterpretq_s32_u32(bad)));              /* store the masked temperature */
+        vst1q_u32(&pa[i], vbicq_u32(vreinterpretq_u32_s32(p), bad));                       /* store the masked pressure */
+        invalid = vorrq_u32(invalid, bad);                                                 /* collect the invalid lanes */
+    }
+    
+    m = vorr_u32(vget_low_u32(invalid), vget_high_u32(invalid));                           /* fold the invalid lanes */
+    
+    return ((vget_lane_u32(m, 0) | vget_lane_u32(m, 1)) != 0) ? 1 : 0;                     /* return the flag */
+}
+
+#endif
+
+/**
+ * @brief     check whether a kernel is supported
+ * @param[in] kernel batch kernel
+ * @return    supported flag
+ * @note      none
+ */
+static bmp180_bool_t a_bmp180_batch_supported(bmp180_batch_kernel_t kernel)
+{
+    switch (kernel)                                                                                /* check the kernel */
+    {
+        case BMP180_BATCH_KERNEL_AUTO :
+        case BMP180_BATCH_KERNEL_SCALAR :
+        {
+            return BMP180_BOOL_TRUE;                                                               /* always supported */
+        }
+#ifdef BMP180_BATCH_X86
+        case BMP180_BATCH_KERNEL_SSE41 :
+        {
+            __builtin_cpu_init();                                                                  /* init the cpu features */
+            
+            return __builtin_cpu_supports("sse4.1") ? BMP180_BOOL_TRUE : BMP180_BOOL_FALSE;        /* check sse4.1 */
+        }
+        case BMP180_BATCH_KERNEL_AVX2 :
+        {
+            __builtin_cpu_init();                                                                  /* init the cpu features */
+            
+            return __builtin_cpu_supports("avx2") ? BMP180_BOOL_TRUE : BMP180_BOOL_FALSE;          /* check avx2 */
+        }
+#endif
+#ifdef BMP180_BATCH_NEON
+        case BMP180_BATCH_KERNEL_NEON :
+        {
+            return BMP180_BOOL_TRUE;                                                               /* always supported */
+        }
+#endif
+        default :
+        {
+            return BMP180_BOOL_FALSE;                                                              /* not supported */
+        }
+    }
+}
+
+/**
+ * @brief  select the best kernel of the running cpu
+ * @return batch kernel
+ * @note   none
+ */
+static bmp180_batch_kernel_t a_bmp180_batch_select(void)
+{
+    if (a_bmp180_batch_supported(BMP180_BATCH_KERNEL_AVX2) == BMP180_BOOL_TRUE)         /* check avx2 */
+    {
+        return BMP180_BATCH_KERNEL_AVX2;                                                /* avx2 */
+    }
+    if (a_bmp180_batch_supported(BMP180_BATCH_KERNEL_SSE41) == BMP180_BOOL_TRUE)        /* check sse4.1 */
+    {
+        return BMP180_BATCH_KERNEL_SSE41;                                               /* sse4.1 */
+    }
+    if (a_bmp180_batch_supported(BMP180_BATCH_KERNEL_NEON) == BMP180_BOOL_TRUE)         /* check neon */
+    {
+        return BMP180_BATCH_KERNEL_NEON;                                                /* neon */
+    }
+    
+    return BMP180_BATCH_KERNEL_SCALAR;                                                  /* fall back to scalar */
+}
+
+/**
+ * @brief      compensate arrays of raw samples with the given kernel
+ * @param[in]  *handle pointer to a bmp180 handle structure
+ * @param[in]  kernel batch kernel
+ * @param[in]  mode oversampling mode of the raw pressure
+ * @param[in]  *ut pointer to a raw temperature array
+ * @param[in]  *up pointer to a raw pressure array
+ * @param[out] *temperature pointer to a temperature array in 0.1 degrees celsius
+ * @param[out] *pa pointer to a pressure array
+ * @param[in]  len array length
+ * @return     status code
+ *             - 0 success
+ *             - 1 mode is invalid
+ *             - 2 handle is NULL
+ *             - 4 some samples can't be compensated
+ *             - 5 kernel is not supported
+ * @note       none
+ */
+uint8_t bmp180_batch_compensate_kernel(bmp180_handle_t *handle, bmp180_batch_kernel_t kernel, bmp180_mode_t mode,
+                                       const uint16_t *ut, const uint32_t *up,
+                                       int32_t *temperature, uint32_t *pa, uint32_t len)
+{
+    bmp180_batch_coef_t coef;
+    uint32_t n;
+    uint8_t invalid;
+    
+    if (handle == NULL)                                                                 /* check handle */
+    {
+        return 2;                                                                       /* return error */
+    }
+    if (mode > BMP180_MODE_ULTRA_HIGH)                                                  /* check mode */
+    {
+        return 1;                                                                       /* return error */
+    }
+    if (a_bmp180_batch_supported(kernel) != BMP180_BOOL_TRUE)                           /* check kernel */
+    {
+        return 5;                                                                       /* return error */
+    }
+    
+    if (kernel == BMP180_BATCH_KERNEL_AUTO)                                             /* auto kernel */
+    {
+        kernel = a_bmp180_batch_select();                                               /* select the kernel */
+    }
+    a_bmp180_batch_load(handle, mode, &coef);                                           /* load the coefficients */
+    n = 0;                                                                              /* vector samples */
+    invalid = 0;                                                                        /* init 0 */
+#ifdef BMP180_BATCH_X86
+    if (kernel == BMP180_BATCH_KERNEL_AVX2)                                             /* avx2 */
+    {
+        n = len & ~7U;                                                                  /* 8 lanes */
+        invalid = a_bmp180_batch_avx2(&coef, ut, up, temperature, pa, n);               /* run the kernel */
+    }
+    if (kernel == BMP180_BATCH_KERNEL_SSE41)                                            /* sse4.1 */
+    {
+        n = len & ~3U;                                                                  /* 4 lanes */
+        invalid = a_bmp180_batch_sse41(&coef, ut, up, temperature, pa, n);              /* run the kernel */
+    }
+#endif
+#ifdef BMP180_BATCH_NEON
+    if (kernel == BMP180_BATCH_KERNEL_NEON)                                             /* neon */
+    {
+        n = len & ~3U;                                                                  /* 4 lanes */
+        invalid = a_bmp180_batch_neon(&coef, ut, up, temperature, pa, n);               /* run the kernel */
+    }
+#endif
+    invalid |= a_bmp180_batch_scalar(handle, mode, &ut[n], &up[n],
+                                     &temperature[n], &pa[n], len - n);                 /* the remaining samples */
+    
+    return (invalid != 0) ? 4 : 0;                                                      /* return the result */
+}
+
+/**
+ * @brief      compensate arrays of raw samples with the best kernel of the running cpu
+ * @param[in]  *handle pointer to a bmp180 handle structure
+ * @param[in]  mode oversampling mode of the raw pressure
+ * @param[in]  *ut pointer to a raw temperature array
+ * @param[in]  *up pointer to a raw pressure array
+ * @param[out] *temperature pointer to a temperature array in 0.1 degrees celsius
+ * @param[out] *pa pointer to a pressure array
+ * @param[in]  len array length
+ * @return     status code
+ *             - 0 success
+ *             - 1 mode is invalid
+ *             - 2 handle is NULL
+ *             - 4 some samples can't be compensated
+ * @note       every sample gives the same result as bmp180_compensate
+ *             both outputs of a sample that can't be compensated are set to 0
+ */
+uint8_t bmp180_batch_compensate(bmp180_handle_t *handle, bmp180_mode_t mode, const uint16_t *ut, const uint32_t *up,
+                                int32_t *temperature, uint32_t *pa, uint32_t len)
+{
+    return bmp180_batch_compensate_kernel(handle, BMP180_BATCH_KERNEL_AUTO, mode, ut, up, temperature, pa, len);
+}
+
+/**
+ * @brief      check whether a kernel is supported by the running cpu
+ * @param[in]  kernel batch kernel
+ * @param[out] *supported pointer to a supported flag buffer
+ * @return     status code
+ *             - 0 success
+ * @note       the neon kernel is built on aarch64 and on armv7 when neon is enabled by the compiler flags,
+ *             such as -mfpu=neon-vfpv4 on the 32 bit raspberry pi os, otherwise only the scalar kernel is built
+ */
+uint8_t bmp180_batch_kernel_supported(bmp180_batch_kernel_t kernel, bmp180_bool_t *supported)
+{
+    *supported = a_bmp180_batch_supported(kernel);        /* check the kernel */
+    
+    return 0;                                             /* success return 0 */
+}
+
+/**
+ * @brief      get the kernel selected by BMP180_BATCH_KERNEL_AUTO
+ * @param[out] *kernel pointer to a batch kernel buffer
+ * @return     status code
+ *             - 0 success
+ * @note       none
+ */
+uint8_t bmp180_batch_get_kernel(bmp180_batch_kernel_t *kernel)
+{
+    *kernel = a_bmp180_batch_select();        /* select the kernel */
+    
+    return 0;                                 /* success return 0 */
+}
@@ -0,0 +1,135 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_bmp180_batch.h
+ * @brief     driver bmp180 batch header file
+ * @version   2.1.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>2.1      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_BMP180_BATCH_H
+#define DRIVER_BMP180_BATCH_H
+
+#include "driver_bmp180.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup bmp180_batch_driver bmp180 batch driver function
+ * @brief    bmp180 batch driver modules
+ * @ingroup  bmp180_driver
+ * @{
+ */
+
+/**
+ * @brief bmp180 batch kernel enumeration definition
+ */
+typedef enum
+{
+    BMP180_BATCH_KERNEL_AUTO   = 0x00,        /**< best kernel of the running cpu */
+    BMP180_BATCH_KERNEL_SCALAR = 0x01,        /**< scalar reference kernel */
+    BMP180_BATCH_KERNEL_SSE41  = 0x02,        /**< x86 sse4.1 kernel */
+    BMP180_BATCH_KERNEL_AVX2   = 0x03,        /**< x86 avx2 kernel */
+    BMP180_BATCH_KERNEL_NEON   = 0x04,        /**< aarch64 or armv7 neon kernel */
+} bmp180_batch_kernel_t;
+
+/**
+ * @brief      compensate arrays of raw samples with the best kernel of the running cpu
+ * @param[in]  *handle pointer to a bmp180 handle structure
+ * @param[in]  mode oversampling mode of the raw pressure
+ * @param[in]  *ut pointer to a raw temperature array
+ * @param[in]  *up pointer to a raw pressure array
+ * @param[out] *temperature pointer to a temperature array in 0.1 degrees celsius
+ * @param[out] *pa pointer to a pressure array
+ * @param[in]  len array length
+ * @return     status code
+ *             - 0 success
+ *             - 1 mode is invalid
+ *             - 2 handle is NULL
+ *             - 4 some samples can't be compensated
+ * @note       every sample gives the same result as bmp180_compensate
+ *             both outputs of a sample that can't be compensated are set to 0
+ */
+uint8_t bmp180_batch_compensate(bmp180_handle_t *handle, bmp180_mode_t mode, const uint16_t *ut, const uint32_t *up,
+                                int32_t *temperature, uint32_t *pa, uint32_t len);
+
+/**
+ * @brief      compensate arrays of raw samples with the given kernel
+ * @param[in]  *handle pointer to a bmp180 handle structure
+ * @param[in]  kernel batch kernel
+ * @param[in]  mode oversampling mode of the raw pressure
+ * @param[in]  *ut pointer to a raw temperature array
+ * @param[in]  *up pointer to a raw pressure array
+ * @param[out] *temperature pointer to a temperature array in 0.1 degrees celsius
+ * @param[out] *pa pointer to a pressure array
+ * @param[in]  len array length
+ * @return     status code
+ *             - 0 success
+ *             - 1 mode is invalid
+ *             - 2 handle is NULL
+ *             - 4 some samples can't be compensated
+ *             - 5 kernel is not supported
+ * @note       none
+ */
+uint8_t bmp180_batch_compensate_kernel(bmp180_handle_t *handle, bmp180_batch_kernel_t kernel, bmp180_mode_t mode,
+                                       const uint16_t *ut, const uint32_t *up,
+                                       int32_t *temperature, uint32_t *pa, uint32_t len);
+
+/**
+ * @brief      check whether a kernel is supported by the running cpu
+ * @param[in]  kernel batch kernel
+ * @param[out] *supported pointer to a supported flag buffer
+ * @return     status code
+ *             - 0 success
+ * @note       the neon kernel is built on aarch64 and on armv7 when neon is enabled by the compiler flags,
+ *             such as -mfpu=neon-vfpv4 on the 32 bit raspberry pi os, otherwise only the scalar kernel is built
+ */
+uint8_t bmp180_batch_kernel_supported(bmp180_batch_kernel_t kernel, bmp180_bool_t *supported);
+
+/**
+ * @brief      get the kernel selected by BMP180_BATCH_KERNEL_AUTO
+ * @param[out] *kernel pointer to a batch kernel buffer
+ * @return     status code
+ *             - 0 success
+ * @note       none
+ */
+uint8_t bmp180_batch_get_kernel(bmp180_batch_kernel_t *kernel);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,697 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_bmp180_codec.c
+ * @brief     driver bmp180 codec source file
+ * @version   2.1.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>2.1      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_bmp180_codec.h"
+#include <string.h>
+
+/**
+ * @brief bmp180 codec bit stream definition
+ */
+#define BMP180_CODEC_RICE_LIMIT    16        /**< unary length of an escaped residual */
+#define BMP180_CODEC_RICE_K_MAX    24        /**< max rice parameter */
+#define BMP180_CODEC_MEAN_INIT     16        /**< initial residual mean x16 */
+
+/**
+ * @brief     put bits
+ * @param[in] *codec pointer to a bmp180 codec structure
+ * @param[in] value bits to put
+ * @param[in] bits bit count, 32 at most
+ * @note      msb first, the caller checks the room before a sample
+ */
+static void a_bmp180_codec_put(bmp180_codec_t *codec, uint64_t value, uint8_t bits)
+{
+    codec->acc = (codec->acc << bits) | (value & ((1ULL << bits) - 1));             /* append the bits */
+    codec->acc_bits = (uint8_t)(codec->acc_bits + bits);                            /* add the bit count */
+    while (codec->acc_bits >= 8)                                                    /* write the full bytes */
+    {
+        codec->acc_bits -= 8;                                                       /* take 8 bits */
+        codec->buf[codec->pos++] = (uint8_t)(codec->acc >> codec->acc_bits);        /* write a byte */
+    }
+}
+
+/**
+ * @brief      get bits
+ * @param[in]  *codec pointer to a bmp180 codec structure
+ * @param[in]  bits bit count, 32 at most
+ * @param[out] *value pointer to a bits buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 the chunk ends
+ * @note       none
+ */
+static uint8_t a_bmp180_codec_get(bmp180_codec_t *codec, uint8_t bits, uint64_t *value)
+{
+    while (codec->acc_bits < bits)                                          /* read the bytes */
+    {
+        if (codec->pos >= codec->size)                                      /* check the end */
+        {
+            return 1;                                                       /* return error */
+        }
+        codec->acc = (codec->acc << 8) | codec->buf[codec->pos++];          /* read a byte */
+        codec->acc_bits = (uint8_t)(codec->acc_bits + 8);                   /* add 8 bits */
+    }
+    codec->acc_bits = (uint8_t)(codec->acc_bits - bits);                    /* take the bits */
+    *value = (codec->acc >> codec->acc_bits) & ((1ULL << bits) - 1);        /* get the bits */
+    
+    return 0;                                                               /* success return 0 */
+}
+
+/**
+ * @brief     get the rice parameter of a residual mean
+ * @param[in] mean residual mean x16
+ * @return    rice parameter
+ * @note      the largest k with 2^k <= mean
+ */
+static uint8_t a_bmp180_codec_rice_k(uint32_t mean)
+{
+    uint8_t k;
+    
+    k = 0;                                                               /* init 0 */
+    while ((k < BMP180_CODEC_RICE_K_MAX) && ((32U << k) <= mean))        /* find k */
+    {
+        k++;                                                             /* next k */
+    }
+    
+    return k;                                                            /* return k */
+}
+
+/**
+ * @brief     update a residual mean
+ * @param[in] *mean pointer to a residual mean x16
+ * @param[in] zigzag zig-zag residual
+ * @note      an exponential mean over about 16 residuals
+ */
+static void a_bmp180_codec_update_mean(uint32_t *mean, uint64_t zigzag)
+{
+    if (zigzag > 0x03FFFFFFU)                               /* bound the outliers */
+    {
+        zigzag = 0x03FFFFFFU;                               /* clamp */
+    }
+    *mean = *mean + (uint32_t)zigzag - (*mean >> 4);        /* update the mean */
+}
+
+/**
+ * @brief     put a residual
+ * @param[in] *codec pointer to a bmp180 codec structure
+ * @param[in] *mean pointer to the residual mean x16
+ * @param[in] residual signed residual
+ * @note      zig-zag then rice coded with the parameter of the running mean,
+ *            a residual beyond the unary limit is escaped with 32 raw bits
+ */
+static void a_bmp180_codec_put_residual(bmp180_codec_t *codec, uint32_t *mean, int64_t residual)
+{
+    uint64_t zigzag;
+    uint64_t q;
+    uint8_t k;
+    
+    zigzag = ((uint64_t)residual << 1) ^ (uint64_t)(residual >> 63);                /* zig-zag */
+    k = a_bmp180_codec_rice_k(*mean);                                               /* get the rice parameter */
+    q = zigzag >> k;                                                                /* get the quotient */
+    if (q < BMP180_CODEC_RICE_LIMIT)                                                /* check the limit */
+    {
+        a_bmp180_codec_put(codec, ((1ULL << q) - 1) << 1, (uint8_t)(q + 1));        /* q ones and a zero */
+        a_bmp180_codec_put(codec, zigzag, k);                                       /* the remainder */
+    }
+    else
+    {
+        a_bmp180_codec_put(codec, (1ULL << BMP180_CODEC_RICE_LIMIT) - 1, 
+                           BMP180_CODEC_RICE_LIMIT);                                /* escape */
+        a_bmp180_codec_put(codec, zigzag, 32);                                      /* the raw residual */
+    }
+    a_bmp180_codec_update_mean(mean, zigzag);                                       /* update the mean */
+}
+
+/**
+ * @brief      get a residual
+ * @param[in]  *codec pointer to a bmp180 codec structure
+ * @param[in]  *mean pointer to the residual mean x16
+ * @param[out] *residual pointer to a residual buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 the chunk ends
+ * @note       none
+ */
+static uint8_t a_bmp180_codec_get_residual(bmp180_codec_t *codec, uint32_t *mean, int64_t *residual)
+{
+    uint64_t zigzag;
+    uint64_t bit;
+    uint64_t q;
+    uint8_t k;
+    
+    k = a_bmp180_codec_rice_k(*mean);                                   /* get the rice parameter */
+    q = 0;                                                              /* init 0 */
+    while (q < BMP180_CODEC_RICE_LIMIT)                                 /* count the ones */
+    {
+        if (a_bmp180_codec_get(codec, 1, &bit) != 0)                    /* get a bit */
+        {
+            return 1;                                                   /* return error */
+        }
+        if (bit == 0)                                                   /* check the end of the unary code */
+        {
+            break;                                                      /* break */
+        }
+        q++;                                                            /* count a one */
+    }
+    if (q < BMP180_CODEC_RICE_LIMIT)                                    /* check the escape */
+    {
+        if (a_bmp180_codec_get(codec, k, &zigzag) != 0)                 /* get the remainder */
+        {
+            return 1;                                                   /* return error */
+        }
+        zigzag |= q << k;                                               /* add the quotient */
+    }
+    else
+    {
+        if (a_bmp180_codec_get(codec, 32, &zigzag) != 0)                /* get the raw residual */
+        {
+            return 1;                                                   /* return error */
+        }
+    }
+    a_bmp180_codec_update_mean(mean, zigzag);                           /* update the mean */
+    *residual = (int64_t)(zigzag >> 1) ^ -(int64_t)(zigzag & 1);        /* undo the zig-zag */
+    
+    return 0;                                                           /* success return 0 */
+}
+
+/**
+ * @brief     put a delta of delta
+ * @param[in] *codec pointer to a bmp180 codec structure
+ * @param[in] dod timestamp delta of delta
+ * @note      '0' for 0, '10' 7 bits, '110' 9 bits, '1110' 12 bits and '1111' 64 bits
+ */
+static void a_bmp180_codec_put_dod(bmp180_codec_t *codec, int64_t dod)
+{
+    if (dod == 0)                                                  /* the period holds */
+    {
+        a_bmp180_codec_put(codec, 0x0, 1);                         /* one bit */
+    }
+    else if ((dod >= -64) && (dod <= 63))                          /* check 7 bits */
+    {
+        a_bmp180_codec_put(codec, 0x2, 2);                         /* put the prefix */
+        a_bmp180_codec_put(codec, (uint64_t)dod, 7);               /* put 7 bits */
+    }
+    else if ((dod >= -256) && (dod <= 255))                        /* check 9 bits */
+    {
+        a_bmp180_codec_put(codec, 0x6, 3);                         /* put the prefix */
+        a_bmp180_codec_put(codec, (uint64_t)dod, 9);               /* put 9 bits */
+    }
+    else if ((dod >= -2048) && (dod <= 2047))                      /* check 12 bits */
+    {
+        a_bmp180_codec_put(codec, 0xE, 4);                         /* put the prefix */
+        a_bmp180_codec_put(codec, (uint64_t)dod, 12);              /* put 12 bits */
+    }
+    else
+    {
+        a_bmp180_codec_put(codec, 0xF, 4);                         /* put the prefix */
+        a_bmp180_codec_put(codec, (uint64_t)dod >> 32, 32);        /* put the high word */
+        a_bmp180_codec_put(codec, (uint64_t)dod, 32);              /* put the low word */
+    }
+}
+
+/**
+ * @brief      get a delta of delta
+ * @param[in]  *codec pointer to a bmp180 codec structure
+ * @param[out] *dod pointer to a delta of delta buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 the chunk ends
+ * @note       none
+ */
+static uint8_t a_bmp180_codec_get_dod(bmp180_codec_t *codec, int64_t *dod)
+{
+    const uint8_t width[4] = {7, 9, 12, 32};
+    uint64_t value;
+    uint64_t low;
+    uint64_t bit;
+    uint8_t n;
+    
+    n = 0;                                                                            /* init 0 */
+    while (n < 4)                                                                     /* read the prefix */
+    {
+        if (a_bmp180_codec_get(codec, 1, &bit) != 0)                                  /* get a bit */
+        {
+            return 1;                                                                 /* return error */
+        }
+        if (bit == 0)                                                                 /* check the end of the prefix */
+        {
+            break;                                                                    /* break */
+        }
+        n++;                                                                          /* count a one */
+    }
+    if (n == 0)                                                                       /* the period holds */
+    {
+        *dod = 0;                                                                     /* set 0 */
+        
+        return 0;                                                                     /* success return 0 */
+    }
+    if (a_bmp180_codec_get(codec, width[n - 1], &value) != 0)                         /* get the value */
+    {
+        return 1;                                                                     /* return error */
+    }
+    if (n == 4)                                                                       /* 64 bits */
+    {
+        if (a_bmp180_codec_get(codec, 32, &low) != 0)                                 /* get the low word */
+        {
+            return 1;                                                                 /* return error */
+        }
+        *dod = (int64_t)((value << 32) | low);                                        /* set the value */
+    }
+    else
+    {
+        *dod = (int64_t)(value << (64 - width[n - 1])) >> (64 - width[n - 1]);        /* sign extend */
+    }
+    
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief     put a little endian word
+ * @param[in] *buf pointer to a buffer
+ * @param[in] value word
+ * @note      none
+ */
+static void a_bmp180_codec_put_le32(uint8_t *buf, uint32_t value)
+{
+    buf[0] = (uint8_t)(value >> 0);         /* set byte 0 */
+    buf[1] = (uint8_t)(value >> 8);         /* set byte 1 */
+    buf[2] = (uint8_t)(value >> 16);        /* set byte 2 */
+    buf[3] = (uint8_t)(value >> 24);        /* set byte 3 */
+}
+
+/**
+ * @brief     get a little endian word
+ * @param[in] *buf pointer to a buffer
+ * @return    word
+ * @note      none
+ */
+static uint32_t a_bmp180_codec_get_le32(const uint8_t *buf)
+{
+    return (uint32_t)buf[0] | ((uint32_t)buf[1] << 8) | 
+           ((uint32_t)buf[2] << 16) | ((uint32_t)buf[3] << 24);        /* get the word */
+}
+
+/**
+ * @brief     initialize the encoder of a chunk
+ * @param[in] *codec pointer to a bmp180 codec structure
+ * @param[in] *buf pointer to a chunk buffer
+ * @param[in] size chunk buffer size
+ * @param[in] resolution_us timestamp resolution in us
+ * @return    status code
+ *            - 0 success
+ *            - 1 size or resolution is invalid
+ *            - 2 codec is NULL
+ *            - 3 buf is NULL
+ * @note      the timestamps are stored as multiples of resolution_us, 1 keeps them exact,
+ *            a resolution near the sample jitter makes a periodic timestamp cost one bit,
+ *            about 10x against 8 byte raw records needs a 1ms or coarser resolution,
+ *            exact 1us timestamps of a jittery timer only reach about 3.5x
+ */
+uint8_t bmp180_codec_encoder_init(bmp180_codec_t *codec, uint8_t *buf, uint32_t size, uint32_t resolution_us)
+{
+    if (codec == NULL)                               /* check codec */
+    {
+        return 2;                                    /* return error */
+    }
+    if (buf == NULL)                                 /* check buf */
+    {
+        return 3;                                    /* return error */
+    }
+    if ((size < BMP180_CODEC_HEADER_SIZE + BMP180_CODEC_SAMPLE_MAX) || 
+        (resolution_us == 0))                        /* check the params */
+    {
+        return 1;                                    /* return error */
+    }
+    
+    memset(codec, 0, sizeof(bmp180_codec_t));        /* clear the state */
+    codec->buf = buf;                                /* set buf */
+    codec->size = size;                              /* set size */
+    codec->pos = BMP180_CODEC_HEADER_SIZE;           /* the header is written by finish */
+    codec->resolution_us = resolution_us;            /* set the resolution */
+    codec->mean_ut = BMP180_CODEC_MEAN_INIT;         /* init the temperature mean */
+    codec->mean_up = BMP180_CODEC_MEAN_INIT;         /* init the pressure mean */
+    codec->encoder = 1;                              /* flag encoder */
+    codec->inited = 1;                               /* flag finish initialization */
+    
+    return 0;                                        /* success return 0 */
+}
+
+/**
+ * @brief     append a sample to the chunk
+ * @param[in] *codec pointer to a bmp180 codec structure
+ * @param[in] *sample pointer to a sample
+ * @return    status code
+ *            - 0 success
+ *            - 1 sample is NULL or invalid
+ *            - 2 codec is NULL
+ *            - 3 codec is not initialized as an encoder
+ *            - 4 chunk is full
+ * @note      the timestamp, the raw temperature, the raw pressure and the mode are stored,
+ *            the sequence and the sensor of the first sample are kept for the whole chunk,
+ *            the timestamps must not go backwards, a full chunk keeps its samples and
+ *            the sample goes to the next chunk
+ */
+uint8_t bmp180_codec_encode(bmp180_codec_t *codec, const bmp180_sample_t *sample)
+{
+    uint64_t time;
+    int64_t delta;
+    uint8_t shift;
+    uint8_t low;
+    
+    if (codec == NULL)                                                                   /* check codec */
+    {
+        return 2;                                                                        /* return error */
+    }
+    if ((codec->inited != 1) || (codec->encoder != 1))                                   /* check codec initialization */
+    {
+        return 3;                                                                        /* return error */
+    }
+    if ((sample == NULL) || (sample->mode > BMP180_MODE_ULTRA_HIGH) || 
+        (sample->up > 0xFFFFFFU))                                                        /* check sample */
+    {
+        return 1;                                                                        /* return error */
+    }
+    time = sample->timestamp_us / codec->resolution_us;                                  /* quantize the timestamp */
+    if ((codec->count != 0) && (time < codec->last_time))                                /* check the order */
+    {
+        return 1;                                                                        /* return error */
+    }
+    if ((codec->size - codec->pos < BMP180_CODEC_SAMPLE_MAX) || 
+        (codec->count == 0xFFFFFFFFU))                                                   /* check the room */
+    {
+        return 4;                                                                        /* return error */
+    }
+    
+    shift = (uint8_t)(8 - sample->mode);                                                 /* bits below the pressure resolution */
+    low = (uint8_t)(sample->up & ((1U << shift) - 1));                                   /* get the low bits */
+    if (codec->count == 0)                                                               /* the first sample is raw */
+    {
+        a_bmp180_codec_put(codec, time >> 32, 32);                                       /* put the timestamp high word */
+        a_bmp180_codec_put(codec, time, 32);                                             /* put the timestamp low word */
+        a_bmp180_codec_put(codec, sample->mode, 2);                                      /* put the mode */
+        a_bmp180_codec_put(codec, sample->ut, 16);                                       /* put the raw temperature */
+        a_bmp180_codec_put(codec, sample->up, 24);                                       /* put the raw pressure */
+        codec->sequence = sample->sequence;                                              /* keep the sequence */
+        codec->sensor = sample->sensor;                                                  /* keep the sensor */
+    }
+    else
+    {
+        delta = (int64_t)(time - codec->last_time);                                      /* get the delta */
+        if ((sample->mode == codec->last_mode) && (low == codec->last_low) && 
+            (delta == codec->last_delta))                                                /* check a regular sample */
+        {
+            a_bmp180_codec_put(codec, 0, 1);                                             /* one bit for the mode, the low bits and the period */
+        }
+        else
+        {
+            a_bmp180_codec_put(codec, 1, 1);                                             /* irregular */
+            if ((sample->mode == codec->last_mode) && (low == codec->last_low))          /* check the mode and the low bits */
+            {
+                a_bmp180_codec_put(codec, 0, 1);                                         /* unchanged */
+            }
+            else
+            {
+                a_bmp180_codec_put(codec, 1, 1);                                         /* changed */
+                a_bmp180_codec_put(codec, sample->mode, 2);                              /* put the mode */
+                a_bmp180_codec_put(codec, low, shift);                                   /* put the low bits */
+            }
+            a_bmp180_codec_put_dod(codec, (int64_t)((uint64_t)delta - 
+                                                   (uint64_t)codec->last_delta));        /* put the delta of delta */
+        }
+        codec->last_delta = delta;                                                       /* keep the delta */
+        a_bmp180_codec_put_residual(codec, &codec->mean_ut, 
+                                    (int64_t)sample->ut - codec->last_ut);               /* put the temperature residual */
+        a_bmp180_codec_put_residual(codec, &codec->mean_up, 
+                                    (int64_t)(sample->up >> shift) - 
+                                    (int64_t)(codec->last_up >> shift));                 /* put the pressure residual */
+    }
+    codec->last_time = time;                                                             /* keep the timestamp */
+    codec->last_ut = sample->ut;                                                         /* keep the raw temperature */
+    codec->last_up = sample->up;                                                         /* keep the raw pressure */
+    codec->last_low = low;                                                               /* keep the low bits */
+    codec->last_mode = sample->mode;                                                     /* keep the mode */
+    codec->count++;                                                                      /* count the sample */
+    
+    return 0;                                                                            /* success return 0 */
+}
+
+/**
+ * @brief      finish the chunk
+ * @param[in]  *codec pointer to a bmp180 codec structure
+ * @param[out] *len pointer to a chunk length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 len is NULL
+ *             - 2 codec is NULL
+ *             - 3 codec is not initialized as an encoder
+ * @note       the last byte is padded and the sample count is written to the header
+ */
+uint8_t bmp180_codec_encoder_finish(bmp180_codec_t *codec, uint32_t *len)
+{
+    if (codec == NULL)                                                       /* check codec */
+    {
+        return 2;                                                            /* return error */
+    }
+    if ((codec->inited != 1) || (codec->encoder != 1))                       /* check codec initialization */
+    {
+        return 3;                                                            /* return error */
+    }
+    if (len == NULL)                                                         /* check len */
+    {
+        return 1;                                                            /* return error */
+    }
+    
+    if (codec->acc_bits != 0)                                                /* check the pending bits */
+    {
+        a_bmp180_codec_put(codec, 0, (uint8_t)(8 - codec->acc_bits));        /* pad the last byte */
+    }
+    codec->buf[0] = BMP180_CODEC_VERSION;                                    /* set the version */
+    codec->buf[1] = codec->sensor;                                           /* set the sensor */
+    a_bmp180_codec_put_le32(&codec->buf[2], codec->resolution_us);           /* set the resolution */
+    a_bmp180_codec_put_le32(&codec->buf[6], codec->count);                   /* set the count */
+    a_bmp180_codec_put_le32(&codec->buf[10], codec->sequence);               /* set the sequence */
+    *len = codec->pos;                                                       /* set the length */
+    codec->inited = 0;                                                       /* the chunk is closed */
+    
+    return 0;                                                                /* success return 0 */
+}
+
+/**
+ * @brief     initialize the decoder of a chunk
+ * @param[in] *codec pointer to a bmp180 codec structure
+ * @param[in] *handle pointer to an initialized bmp180 handle or NULL
+ * @param[in] *buf pointer to a chunk
+ * @param[in] len chunk length
+ * @return    status code
+ *            - 0 success
+ *            - 1 chunk header is invalid
+ *            - 2 codec is NULL
+ *            - 3 buf is NULL
+ * @note      the handle only compensates the decoded samples, NULL leaves the temperature and the pressure 0
+ */
+uint8_t bmp180_codec_decoder_init(bmp180_codec_t *codec, bmp180_handle_t *handle, const uint8_t *buf, uint32_t len)
+{
+    if (codec == NULL)                                              /* check codec */
+    {
+        return 2;                                                   /* return error */
+    }
+    if (buf == NULL)                                                /* check buf */
+    {
+        return 3;                                                   /* return error */
+    }
+    if ((len < BMP180_CODEC_HEADER_SIZE) || (buf[0] != BMP180_CODEC_VERSION) || 
+        (a_bmp180_codec_get_le32(&buf[2]) == 0))                    /* check the header */
+    {
+        return 1;                                                   /* return error */
+    }
+    
+    memset(codec, 0, sizeof(bmp180_codec_t));                       /* clear the state */
+    codec->buf = (uint8_t *)buf;                                    /* the decoder never writes the chunk */
+    codec->size = len;                                              /* set size */
+    codec->pos = BMP180_CODEC_HEADER_SIZE;                          /* skip the header */
+    codec->sensor = buf[1];                                         /* get the sensor */
+    codec->resolution_us = a_bmp180_codec_get_le32(&buf[2]);        /* get the resolution */
+    codec->total = a_bmp180_codec_get_le32(&buf[6]);                /* get the count */
+    codec->sequence = a_bmp180_codec_get_le32(&buf[10]);            /* get the sequence */
+    codec->handle = handle;                                         /* set the handle */
+    codec->mean_ut = BMP180_CODEC_MEAN_INIT;                        /* init the temperature mean */
+    codec->mean_up = BMP180_CODEC_MEAN_INIT;                        /* init the pressure mean */
+    codec->encoder = 0;                                             /* flag decoder */
+    codec->inited = 1;                                              /* flag finish initialization */
+    
+    return 0;                                                       /* success return 0 */
+}
+
+/**
+ * @brief      decode the next sample of the chunk
+ * @param[in]  *codec pointer to a bmp180 codec structure
+ * @param[out] *sample pointer to a sample buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 sample is NULL or the chunk is corrupted
+ *             - 2 codec is NULL
+ *             - 3 codec is not initialized as a decoder
+ *             - 4 no more samples
+ * @note       the sequence counts up from the first sample of the chunk
+ */
+uint8_t bmp180_codec_decode(bmp180_codec_t *codec, bmp180_sample_t *sample)
+{
+    uint64_t value;
+    uint64_t high;
+    int64_t residual;
+    int64_t dod;
+    uint8_t shift;
+    uint8_t mode;
+    uint8_t low;
+    uint16_t ut;
+    uint32_t up;
+    
+    if (codec == NULL)                                                                     /* check codec */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if ((codec->inited != 1) || (codec->encoder != 0))                                     /* check codec initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    if (sample == NULL)                                                                    /* check sample */
+    {
+        return 1;                                                                          /* return error */
+    }
+    if (codec->count >= codec->total)                                                      /* check the end */
+    {
+        return 4;                                                                          /* return error */
+    }
+    
+    if (codec->count == 0)                                                                 /* the first sample is raw */
+    {
+        if ((a_bmp180_codec_get(codec, 32, &high) != 0) || 
+            (a_bmp180_codec_get(codec, 32, &value) != 0))                                  /* get the timestamp */
+        {
+            return 1;                                                                      /* return error */
+        }
+        codec->last_time = (high << 32) | value;                                           /* set the timestamp */
+        if (a_bmp180_codec_get(codec, 2, &value) != 0)                                     /* get the mode */
+        {
+            return 1;                                                                      /* return error */
+        }
+        mode = (uint8_t)value;                                                             /* set the mode */
+        if (a_bmp180_codec_get(codec, 16, &value) != 0)                                    /* get the raw temperature */
+        {
+            return 1;                                                                      /* return error */
+        }
+        ut = (uint16_t)value;                                                              /* set the raw temperature */
+        if (a_bmp180_codec_get(codec, 24, &value) != 0)                                    /* get the raw pressure */
+        {
+            return 1;                                                                      /* return error */
+        }
+        up = (uint32_t)value;                                                              /* set the raw pressure */
+        shift = (uint8_t)(8 - mode);                                                       /* bits below the pressure resolution */
+        low = (uint8_t)(up & ((1U << shift) - 1));                                         /* get the low bits */
+    }
+    else
+    {
+        mode = codec->last_mode;                                                           /* the last mode */
+        low = codec->last_low;                                                             /* the last low bits */
+        dod = 0;                                                                           /* the last period */
+        if (a_bmp180_codec_get(codec, 1, &value) != 0)                                     /* get the regular flag */
+        {
+            return 1;                                                                      /* return error */
+        }
+        if (value != 0)                                                                    /* check an irregular sample */
+        {
+            if (a_bmp180_codec_get(codec, 1, &value) != 0)                                 /* get the change flag */
+            {
+                return 1;                                                                  /* return error */
+            }
+            if (value != 0)                                                                /* check the change */
+            {
+                if (a_bmp180_codec_get(codec, 2, &value) != 0)                             /* get the mode */
+                {
+                    return 1;                                                              /* return error */
+                }
+                mode = (uint8_t)value;                                                     /* set the mode */
+                if (a_bmp180_codec_get(codec, (uint8_t)(8 - mode), &value) != 0)           /* get the low bits */
+                {
+                    return 1;                                                              /* return error */
+                }
+                low = (uint8_t)value;                                                      /* set the low bits */
+            }
+            if (a_bmp180_codec_get_dod(codec, &dod) != 0)                                  /* get the delta of delta */
+            {
+                return 1;                                                                  /* return error */
+            }
+        }
+        shift = (uint8_t)(8 - mode);                                                       /* bits below the pressure resolution */
+        codec->last_delta = (int64_t)((uint64_t)codec->last_delta + (uint64_t)dod);        /* get the delta */
+        codec->last_time += (uint64_t)codec->last_delta;                                   /* get the timestamp */
+        if (a_bmp180_codec_get_residual(codec, &codec->mean_ut, &residual) != 0)           /* get the temperature residual */
+        {
+            return 1;                                                                      /* return error */
+        }
+        ut = (uint16_t)((uint64_t)codec->last_ut + (uint64_t)residual);                    /* get the raw temperature */
+        if (a_bmp180_codec_get_residual(codec, &codec->mean_up, &residual) != 0)           /* get the pressure residual */
+        {
+            return 1;                                                                      /* return error */
+        }
+        up = (uint32_t)(((uint64_t)(codec->last_up >> shift) + 
+                         (uint64_t)residual) << shift);                                    /* get the raw pressure */
+        up |= low;                                                                         /* add the low bits */
+    }
+    codec->last_ut = ut;                                                                   /* keep the raw temperature */
+    codec->last_up = up;                                                                   /* keep the raw pressure */
+    codec->last_low = low;                                                                 /* keep the low bits */
+    codec->last_mode = mode;                                                               /* keep the mode */
+    
+    memset(sample, 0, sizeof(bmp180_sample_t));                                            /* clear the sample */
+    sample->timestamp_us = codec->last_time * codec->resolution_us;                        /* set the timestamp */
+    sample->sequence = codec->sequence + codec->count;                                     /* set the sequence */
+    sample->ut = ut;                                                                       /* set the raw temperature */
+    sample->up = up;                                                                       /* set the raw pressure */
+    sample->mode = mode;                                                                   /* set the mode */
+    sample->sensor = codec->sensor;                                                        /* set the sensor */
+    if (codec->handle != NULL)                                                             /* check the handle */
+    {
+        if (bmp180_compensate(codec->handle, (bmp180_mode_t)mode, ut, up, 
+                              &sample->temperature, &sample->pa) != 0)                     /* compensate */
+        {
+            sample->temperature = 0;                                                       /* clear the temperature */
+            sample->pa = 0;                                                                /* clear the pressure */
+        }
+    }
+    codec->count++;                                                                        /* count the sample */
+    
+    return 0;                                                                              /* success return 0 */
+}
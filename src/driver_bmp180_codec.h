@@ -0,0 +1,174 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_bmp180_codec.h
+ * @brief     driver bmp180 codec header file
+ * @version   2.1.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>2.1      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_BMP180_CODEC_H
+#define DRIVER_BMP180_CODEC_H
+
+#include "driver_bmp180.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup bmp180_codec_driver bmp180 codec driver function
+ * @brief    bmp180 codec driver modules
+ * @ingroup  bmp180_driver
+ * @{
+ */
+
+/**
+ * @brief bmp180 codec definition
+ */
+#define BMP180_CODEC_VERSION        1         /**< chunk version */
+#define BMP180_CODEC_HEADER_SIZE    14        /**< chunk header size */
+#define BMP180_CODEC_SAMPLE_MAX     24        /**< max encoded sample size */
+
+/**
+ * @brief bmp180 codec structure definition
+ * @note  one chunk is encoded or decoded at a time, the state of both sides is the same
+ */
+typedef struct bmp180_codec_s
+{
+    uint8_t *buf;                      /**< chunk buffer */
+    uint32_t size;                     /**< chunk buffer size */
+    uint32_t pos;                      /**< byte position */
+    uint64_t acc;                      /**< bit accumulator */
+    uint8_t acc_bits;                  /**< bits in the accumulator */
+    uint32_t resolution_us;            /**< timestamp resolution */
+    uint32_t count;                    /**< encoded or decoded samples */
+    uint32_t total;                    /**< samples of the decoded chunk */
+    uint32_t sequence;                 /**< sequence of the first sample */
+    uint8_t sensor;                    /**< sensor index */
+    bmp180_handle_t *handle;           /**< compensating handle of the decoder or NULL */
+    uint64_t last_time;                /**< last timestamp in resolution units */
+    int64_t last_delta;                /**< last timestamp delta in resolution units */
+    uint32_t last_up;                  /**< last raw pressure */
+    uint16_t last_ut;                  /**< last raw temperature */
+    uint8_t last_low;                  /**< last low bits of the raw pressure */
+    uint8_t last_mode;                 /**< last oversampling mode */
+    uint32_t mean_ut;                  /**< running mean of the raw temperature residuals x16 */
+    uint32_t mean_up;                  /**< running mean of the raw pressure residuals x16 */
+    uint8_t encoder;                   /**< encoder flag */
+    uint8_t inited;                    /**< inited flag */
+} bmp180_codec_t;
+
+/**
+ * @brief     initialize the encoder of a chunk
+ * @param[in] *codec pointer to a bmp180 codec structure
+ * @param[in] *buf pointer to a chunk buffer
+ * @param[in] size chunk buffer size
+ * @param[in] resolution_us timestamp resolution in us
+ * @return    status code
+ *            - 0 success
+ *            - 1 size or resolution is invalid
+ *            - 2 codec is NULL
+ *            - 3 buf is NULL
+ * @note      the timestamps are stored as multiples of resolution_us, 1 keeps them exact,
+ *            a resolution near the sample jitter makes a periodic timestamp cost one bit,
+ *            about 10x against 8 byte raw records needs a 1ms or coarser resolution,
+ *            exact 1us timestamps of a jittery timer only reach about 3.5x
+ */
+uint8_t bmp180_codec_encoder_init(bmp180_codec_t *codec, uint8_t *buf, uint32_t size, uint32_t resolution_us);
+
+/**
+ * @brief     append a sample to the chunk
+ * @param[in] *codec pointer to a bmp180 codec structure
+ * @param[in] *sample pointer to a sample
+ * @return    status code
+ *            - 0 success
+ *            - 1 sample is NULL or invalid
+ *            - 2 codec is NULL
+ *            - 3 codec is not initialized as an encoder
+ *            - 4 chunk is full
+ * @note      the timestamp, the raw temperature, the raw pressure and the mode are stored,
+ *            the sequence and the sensor of the first sample are kept for the whole chunk,
+ *            the timestamps must not go backwards, a full chunk keeps its samples and
+ *            the sample goes to the next chunk
+ */
+uint8_t bmp180_codec_encode(bmp180_codec_t *codec, const bmp180_sample_t *sample);
+
+/**
+ * @brief      finish the chunk
+ * @param[in]  *codec pointer to a bmp180 codec structure
+ * @param[out] *len pointer to a chunk length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 len is NULL
+ *             - 2 codec is NULL
+ *             - 3 codec is not initialized as an encoder
+ * @note       the last byte is padded and the sample count is written to the header
+ */
+uint8_t bmp180_codec_encoder_finish(bmp180_codec_t *codec, uint32_t *len);
+
+/**
+ * @brief     initialize the decoder of a chunk
+ * @param[in] *codec pointer to a bmp180 codec structure
+ * @param[in] *handle pointer to an initialized bmp180 handle or NULL
+ * @param[in] *buf pointer to a chunk
+ * @param[in] len chunk length
+ * @return    status code
+ *            - 0 success
+ *            - 1 chunk header is invalid
+ *            - 2 codec is NULL
+ *            - 3 buf is NULL
+ * @note      the handle only compensates the decoded samples, NULL leaves the temperature and the pressure 0
+ */
+uint8_t bmp180_codec_decoder_init(bmp180_codec_t *codec, bmp180_handle_t *handle, const uint8_t *buf, uint32_t len);
+
+/**
+ * @brief      decode the next sample of the chunk
+ * @param[in]  *codec pointer to a bmp180 codec structure
+ * @param[out] *sample pointer to a sample buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 sample is NULL or the chunk is corrupted
+ *             - 2 codec is NULL
+ *             - 3 codec is not initialized as a decoder
+ *             - 4 no more samples
+ * @note       the sequence counts up from the first sample of the chunk
+ */
+uint8_t bmp180_codec_decode(bmp180_codec_t *codec, bmp180_sample_t *sample);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
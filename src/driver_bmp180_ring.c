@@ -0,0 +1,256 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_bmp180_ring.c
+ * @brief     driver bmp180 ring source file
+ * @version   2.1.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>2.1      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+#include "driver_bmp180_ring.h"
+
+/**
+ * @brief     initialize the ring
+ * @param[in] *ring pointer to a bmp180 ring structure
+ * @param[in] *buf pointer to a sample array
+ * @param[in] capacity sample array capacity
+ * @param[in] policy overflow policy
+ * @return    status code
+ *            - 0 success
+ *            - 1 capacity is invalid
+ *            - 2 ring is NULL
+ *            - 3 buf is NULL
+ * @note      capacity must be a power of two,
+ *            the ring doesn't allocate memory, the sample array must live as long as the ring
+ */
+uint8_t bmp180_ring_init(bmp180_ring_t *ring, bmp180_sample_t *buf, uint32_t capacity, bmp180_ring_policy_t policy)
+{
+    if (ring == NULL)                                                 /* check ring */
+    {
+        return 2;                                                     /* return error */
+    }
+    if (buf == NULL)                                                  /* check buf */
+    {
+        return 3;                                                     /* return error */
+    }
+    if ((capacity == 0) || ((capacity & (capacity - 1)) != 0))        /* check capacity */
+    {
+        return 1;                                                     /* return error */
+    }
+    
+    ring->buf = buf;                                                  /* set buf */
+    ring->mask = capacity - 1;                                        /* set mask */
+    ring->policy = (uint8_t)policy;                                   /* set policy */
+    ring->published = 0;                                              /* clear published */
+    ring->dropped = 0;                                                /* clear dropped */
+    __atomic_store_n(&ring->tail, 0, __ATOMIC_RELAXED);               /* clear tail */
+    __atomic_store_n(&ring->head, 0, __ATOMIC_RELAXED);               /* clear head */
+    __atomic_store_n(&ring->inited, 1, __ATOMIC_RELEASE);             /* flag finish initialization */
+    
+    return 0;                                                         /* success return 0 */
+}
+
+/**
+ * @brief     publish a sample
+ * @param[in] *ring pointer to a bmp180 ring structure
+ * @param[in] *sample pointer to a sample
+ * @return    status code
+ *            - 0 success
+ *            - 1 sample is NULL
+ *            - 2 ring is NULL
+ *            - 3 ring is not initialized
+ *            - 4 ring is full and the sample is dropped
+ *            - 5 ring is full and the oldest sample is dropped
+ * @note      only one thread may publish, it never blocks
+ */
+uint8_t bmp180_ring_push(bmp180_ring_t *ring, const bmp180_sample_t *sample)
+{
+    uint8_t res;
+    uint32_t head;
+    uint32_t tail;
+    
+    if (ring == NULL)                                                                     /* check ring */
+    {
+        return 2;                                                                         /* return error */
+    }
+    if (ring->inited != 1)                                                                /* check ring initialization */
+    {
+        return 3;                                                                         /* return error */
+    }
+    if (sample == NULL)                                                                   /* check sample */
+    {
+        return 1;                                                                         /* return error */
+    }
+    
+    res = 0;                                                                              /* init 0 */
+    head = ring->head;                                                                    /* only the producer writes head */
+    tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);                                /* get tail */
+    if ((head - tail) > ring->mask)                                                       /* check full */
+    {
+        if (ring->policy == BMP180_RING_POLICY_DROP_NEWEST)                               /* drop the new sample */
+        {
+            __atomic_store_n(&ring->dropped, ring->dropped + 1, __ATOMIC_RELAXED);        /* count the drop */
+            
+            return 4;                                                                     /* return error */
+        }
+        if (__atomic_compare_exchange_n(&ring->tail, &tail, tail + 1, 0,
+                                        __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE) != 0)         /* drop the oldest sample */
+        {
+            __atomic_store_n(&ring->dropped, ring->dropped + 1, __ATOMIC_RELAXED);        /* count the drop */
+            res = 5;                                                                      /* set the result */
+        }
+        else
+        {
+            /* the consumer has freed slots meanwhile */
+        }
+    }
+    ring->buf[head & ring->mask] = *sample;                                               /* copy the sample */
+    __atomic_store_n(&ring->head, head + 1, __ATOMIC_RELEASE);                            /* publish the sample */
+    __atomic_store_n(&ring->published, ring->published + 1, __ATOMIC_RELAXED);            /* count the sample */
+    
+    return res;                                                                           /* return the result */
+}
+
+/**
+ * @brief      drain samples in publication order
+ * @param[in]  *ring pointer to a bmp180 ring structure
+ * @param[out] *sample pointer to a sample buffer
+ * @param[in]  len sample buffer length
+ * @param[out] *count pointer to a drained sample count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 sample is NULL
+ *             - 2 ring is NULL
+ *             - 3 ring is not initialized
+ * @note       only one thread may drain, it never blocks and count is 0 when the ring is empty
+ */
+uint8_t bmp180_ring_pop(bmp180_ring_t *ring, bmp180_sample_t *sample, uint32_t len, uint32_t *count)
+{
+    uint32_t i;
+    uint32_t n;
+    uint32_t head;
+    uint32_t tail;
+    
+    if (ring == NULL)                                                                    /* check ring */
+    {
+        return 2;                                                                        /* return error */
+    }
+    if (__atomic_load_n(&ring->inited, __ATOMIC_ACQUIRE) != 1)                           /* check ring initialization */
+    {
+        return 3;                                                                        /* return error */
+    }
+    if ((sample == NULL) || (count == NULL))                                             /* check sample */
+    {
+        return 1;                                                                        /* return error */
+    }
+    
+    while (1)                                                                            /* loop */
+    {
+        tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);                           /* get tail */
+        head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);                           /* get head */
+        n = head - tail;                                                                 /* get the queued samples */
+        if (n > len)                                                                     /* check the buffer length */
+        {
+            n = len;                                                                     /* limit to len */
+        }
+        for (i = 0; i < n; i++)                                                          /* copy all samples */
+        {
+            sample[i] = ring->buf[(tail + i) & ring->mask];                              /* copy one sample */
+        }
+        if (__atomic_compare_exchange_n(&ring->tail, &tail, tail + n, 0,
+                                        __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE) != 0)        /* release the slots */
+        {
+            break;                                                                       /* break */
+        }
+        
+        /* the producer has overwritten the oldest sample, copy again */
+    }
+    *count = n;                                                                          /* set the count */
+    
+    return 0;                                                                            /* success return 0 */
+}
+
+/**
+ * @brief      get the number of queued samples
+ * @param[in]  *ring pointer to a bmp180 ring structure
+ * @param[out] *count pointer to a queued sample count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 ring is NULL
+ *             - 3 ring is not initialized
+ * @note       the value is a snapshot when the other side is running
+ */
+uint8_t bmp180_ring_get_count(bmp180_ring_t *ring, uint32_t *count)
+{
+    uint32_t head;
+    uint32_t tail;
+    
+    if (ring == NULL)                                                 /* check ring */
+    {
+        return 2;                                                     /* return error */
+    }
+    if (__atomic_load_n(&ring->inited, __ATOMIC_ACQUIRE) != 1)        /* check ring initialization */
+    {
+        return 3;                                                     /* return error */
+    }
+    
+    tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);            /* get tail */
+    head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);            /* get head */
+    *count = head - tail;                                             /* set the count */
+    
+    return 0;                                                         /* success return 0 */
+}
+
+/**
+ * @brief      get the ring counters
+ * @param[in]  *ring pointer to a bmp180 ring structure
+ * @param[out] *published pointer to a published sample counter buffer
+ * @param[out] *dropped pointer to a dropped sample counter buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 ring is NULL
+ *             - 3 ring is not initialized
+ * @note       both counters wrap at 2^32
+ */
+uint8_t bmp180_ring_get_counter(bmp180_ring_t *ring, uint32_t *published, uint32_t *dropped)
+{
+    if (ring == NULL)                                                        /* check ring */
+    {
+        return 2;                                                            /* return error */
+    }
+    if (__atomic_load_n(&ring->inited, __ATOMIC_ACQUIRE) != 1)               /* check ring initialization */
+    {
+        return 3;                                                            /* return error */
+    }
+    
+    *published = __atomic_load_n(&ring->published, __ATOMIC_RELAXED);        /* get published */
+    *dropped = __atomic_load_n(&ring->dropped, __ATOMIC_RELAXED);            /* get dropped */
+    
+    return 0;                                                                /* success return 0 */
+}
@@ -0,0 +1,172 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_bmp180_ring.h
+ * @brief     driver bmp180 ring header file
+ * @version   2.1.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>2.1      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+#ifndef DRIVER_BMP180_RING_H
+#define DRIVER_BMP180_RING_H
+
+#include "driver_bmp180.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup bmp180_ring_driver bmp180 ring driver function
+ * @brief    bmp180 ring driver modules
+ * @ingroup  bmp180_driver
+ * @{
+ */
+
+/**
+ * @brief bmp180 ring cache line size definition
+ */
+#ifndef BMP180_RING_CACHE_LINE
+    #define BMP180_RING_CACHE_LINE    64
+#endif
+
+/**
+ * @brief bmp180 ring alignment definition
+ */
+#if defined(__GNUC__)
+    #define BMP180_RING_ALIGNED    __attribute__((aligned(BMP180_RING_CACHE_LINE)))
+#else
+    #error "the bmp180 ring needs the gcc atomic builtins"
+#endif
+
+/**
+ * @brief bmp180 ring overflow policy enumeration definition
+ */
+typedef enum
+{
+    BMP180_RING_POLICY_DROP_NEWEST = 0x00,        /**< reject the new sample when the ring is full */
+    BMP180_RING_POLICY_DROP_OLDEST = 0x01,        /**< overwrite the oldest sample when the ring is full */
+} bmp180_ring_policy_t;
+
+/**
+ * @brief bmp180 ring structure definition
+ * @note  the producer and the consumer indexes live on their own cache lines
+ */
+typedef struct bmp180_ring_s
+{
+    uint32_t head BMP180_RING_ALIGNED;        /**< producer index */
+    uint32_t published;                       /**< published sample counter */
+    uint32_t dropped;                         /**< dropped sample counter */
+    uint32_t tail BMP180_RING_ALIGNED;        /**< consumer index */
+    bmp180_sample_t *buf BMP180_RING_ALIGNED; /**< caller provided sample array */
+    uint32_t mask;                            /**< capacity mask */
+    uint8_t policy;                           /**< overflow policy */
+    uint8_t inited;                           /**< inited flag */
+} bmp180_ring_t;
+
+/**
+ * @brief      initialize the ring
+ * @param[in]  *ring pointer to a bmp180 ring structure
+ * @param[in]  *buf pointer to a sample array
+ * @param[in]  capacity sample array capacity
+ * @param[in]  policy overflow policy
+ * @return     status code
+ *             - 0 success
+ *             - 1 capacity is invalid
+ *             - 2 ring is NULL
+ *             - 3 buf is NULL
+ * @note       capacity must be a power of two,
+ *             the ring doesn't allocate memory, the sample array must live as long as the ring
+ */
+uint8_t bmp180_ring_init(bmp180_ring_t *ring, bmp180_sample_t *buf, uint32_t capacity, bmp180_ring_policy_t policy);
+
+/**
+ * @brief     publish a sample
+ * @param[in] *ring pointer to a bmp180 ring structure
+ * @param[in] *sample pointer to a sample
+ * @return    status code
+ *            - 0 success
+ *            - 1 sample is NULL
+ *            - 2 ring is NULL
+ *            - 3 ring is not initialized
+ *            - 4 ring is full and the sample is dropped
+ *            - 5 ring is full and the oldest sample is dropped
+ * @note      only one thread may publish, it never blocks
+ */
+uint8_t bmp180_ring_push(bmp180_ring_t *ring, const bmp180_sample_t *sample);
+
+/**
+ * @brief      drain samples in publication order
+ * @param[in]  *ring pointer to a bmp180 ring structure
+ * @param[out] *sample pointer to a sample buffer
+ * @param[in]  len sample buffer length
+ * @param[out] *count pointer to a drained sample count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 sample is NULL
+ *             - 2 ring is NULL
+ *             - 3 ring is not initialized
+ * @note       only one thread may drain, it never blocks and count is 0 when the ring is empty
+ */
+uint8_t bmp180_ring_pop(bmp180_ring_t *ring, bmp180_sample_t *sample, uint32_t len, uint32_t *count);
+
+/**
+ * @brief      get the number of queued samples
+ * @param[in]  *ring pointer to a bmp180 ring structure
+ * @param[out] *count pointer to a queued sample count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 ring is NULL
+ *             - 3 ring is not initialized
+ * @note       the value is a snapshot when the other side is running
+ */
+uint8_t bmp180_ring_get_count(bmp180_ring_t *ring, uint32_t *count);
+
+/**
+ * @brief      get the ring counters
+ * @param[in]  *ring pointer to a bmp180 ring structure
+ * @param[out] *published pointer to a published sample counter buffer
+ * @param[out] *dropped pointer to a dropped sample counter buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 ring is NULL
+ *             - 3 ring is not initialized
+ * @note       both counters wrap at 2^32
+ */
+uint8_t bmp180_ring_get_counter(bmp180_ring_t *ring, uint32_t *published, uint32_t *dropped);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
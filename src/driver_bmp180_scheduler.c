@@ -0,0 +1,714 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_bmp180_scheduler.c
+ * @brief     driver bmp180 scheduler source file
+ * @version   2.1.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>2.1      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_bmp180_scheduler.h"
+
+/**
+ * @brief scheduler phase definition
+ */
+#define BMP180_SCHEDULER_PHASE_IDLE                0        /**< no conversion is running */
+#define BMP180_SCHEDULER_PHASE_TEMPERATURE         1        /**< temperature conversion is running */
+#define BMP180_SCHEDULER_PHASE_PRESSURE            2        /**< pressure conversion is running */
+
+/**
+ * @brief scheduler timing definition
+ */
+#define BMP180_SCHEDULER_RETRY_US                  500          /**< recheck delay of an unfinished conversion */
+#define BMP180_SCHEDULER_ERROR_BACKOFF_US          100000       /**< restart delay after a bus error */
+#define BMP180_SCHEDULER_READ_MAX_FAILED_ROUNDS    8            /**< failed rounds before the read gives up */
+
+/**
+ * @brief     start the next conversion of a sensor
+ * @param[in] *sensor pointer to a scheduler sensor structure
+ * @param[in] now current time in us
+ * @note      a failed start backs off and retries later,
+ *            a finished temperature is always followed by a pressure conversion
+ */
+static void a_bmp180_scheduler_start(bmp180_scheduler_sensor_t *sensor, uint64_t now)
+{
+    bmp180_bool_t expired;
+    bmp180_mode_t mode;
+    uint32_t us;
+    uint8_t res;
+    
+    if (sensor->phase == BMP180_SCHEDULER_PHASE_TEMPERATURE)                         /* temperature is just done */
+    {
+        expired = BMP180_BOOL_FALSE;                                                 /* it is fresh */
+    }
+    else if (bmp180_get_temperature_expired(sensor->handle, &expired) != 0)          /* check the temperature */
+    {
+        expired = BMP180_BOOL_TRUE;                                                  /* measure it */
+    }
+    if (expired == BMP180_BOOL_TRUE)                                                 /* temperature first */
+    {
+        res = bmp180_start_temperature(sensor->handle);                              /* start temperature */
+        sensor->phase = BMP180_SCHEDULER_PHASE_TEMPERATURE;                          /* set phase */
+    }
+    else
+    {
+        (void)bmp180_get_mode(sensor->handle, &mode);                                /* get mode */
+        sensor->mode = (uint8_t)mode;                                                /* save mode */
+        res = bmp180_start_pressure(sensor->handle);                                 /* start pressure */
+        sensor->phase = BMP180_SCHEDULER_PHASE_PRESSURE;                             /* set phase */
+    }
+    if ((res != 0) || (bmp180_get_conversion_time(sensor->handle, &us) != 0))        /* check the result */
+    {
+        sensor->errors++;                                                            /* count the error */
+        sensor->phase = BMP180_SCHEDULER_PHASE_IDLE;                                 /* nothing is running */
+        sensor->deadline_us = now + BMP180_SCHEDULER_ERROR_BACKOFF_US;               /* back off */
+        
+        return;                                                                      /* return */
+    }
+    sensor->deadline_us = now + us + sensor->margin_us;                              /* datasheet conversion end */
+}
+
+/**
+ * @brief      harvest the finished conversion of a sensor
+ * @param[in]  *scheduler pointer to a bmp180 scheduler structure
+ * @param[in]  index sensor index
+ * @param[in]  now current time in us
+ * @param[out] *sample pointer to a sample buffer
+ * @return     sample flag
+ * @note       none
+ */
+static uint8_t a_bmp180_scheduler_harvest(bmp180_scheduler_t *scheduler, uint8_t index, uint64_t now,
+                                          bmp180_sample_t *sample)
+{
+    bmp180_scheduler_sensor_t *sensor = &scheduler->sensor[index];
+    uint64_t missed;
+    uint32_t up;
+    uint32_t pa;
+    uint8_t res;
+    
+    if (sensor->phase == BMP180_SCHEDULER_PHASE_IDLE)                         /* idle */
+    {
+        if ((sensor->period_us != 0) && (sensor->next_us == 0))               /* first start */
+        {
+            sensor->next_us = now;                                            /* start the period grid */
+        }
+        a_bmp180_scheduler_start(sensor, now);                                /* start a conversion */
+        
+        return 0;                                                             /* no sample */
+    }
+    if (sensor->phase == BMP180_SCHEDULER_PHASE_TEMPERATURE)                  /* temperature */
+    {
+        res = bmp180_fetch_temperature_fixed(sensor->handle, &sensor->ut, 
+                                             &sensor->temperature);           /* fetch temperature */
+    }
+    else
+    {
+        res = bmp180_fetch_pressure(sensor->handle, &up, &pa);                /* fetch pressure */
+    }
+    if (res == 5)                                                             /* not finished */
+    {
+        sensor->deadline_us = now + BMP180_SCHEDULER_RETRY_US;                /* check it later */
+        
+        return 0;                                                             /* no sample */
+    }
+    if (res != 0)                                                             /* bus error */
+    {
+        sensor->errors++;                                                     /* count the error */
+        sensor->phase = BMP180_SCHEDULER_PHASE_IDLE;                          /* nothing is running */
+        sensor->deadline_us = now + BMP180_SCHEDULER_ERROR_BACKOFF_US;        /* back off */
+        
+        return 0;                                                             /* no sample */
+    }
+    if (sensor->phase == BMP180_SCHEDULER_PHASE_TEMPERATURE)                  /* temperature is done */
+    {
+        a_bmp180_scheduler_start(sensor, now);                                /* start the pressure */
+        
+        return 0;                                                             /* no sample */
+    }
+    sample->timestamp_us = now;                                               /* set timestamp */
+    sample->sequence = scheduler->sequence++;                                 /* set sequence */
+    sample->up = up;                                                          /* set raw pressure */
+    sample->temperature = sensor->temperature;                                /* set temperature */
+    sample->pa = pa;                                                          /* set pressure */
+    sample->ut = sensor->ut;                                                  /* set raw temperature */
+    sample->mode = sensor->mode;                                              /* set mode */
+    sample->sensor = index;                                                   /* set sensor index */
+    sensor->samples++;                                                        /* count the sample */
+    scheduler->samples++;                                                     /* count the sample */
+    if (sensor->period_us == 0)                                               /* back to back */
+    {
+        a_bmp180_scheduler_start(sensor, now);                                /* start the next one */
+        
+        return 1;                                                             /* one sample */
+    }
+    sensor->phase = BMP180_SCHEDULER_PHASE_IDLE;                              /* wait for the grid */
+    if (sensor->next_us == 0)                                                 /* adopted conversion */
+    {
+        sensor->next_us = now;                                                /* start the period grid */
+    }
+    sensor->next_us += sensor->period_us;                                     /* next grid point */
+    if (sensor->next_us <= now)                                               /* grid point is missed */
+    {
+        missed = (now - sensor->next_us) / sensor->period_us + 1;             /* missed grid points */
+        sensor->overruns += missed;                                           /* count the overruns */
+        sensor->next_us += missed * sensor->period_us;                        /* skip them */
+    }
+    sensor->deadline_us = sensor->next_us;                                    /* start on the grid */
+    
+    return 1;                                                                 /* one sample */
+}
+
+/**
+ * @brief      initialize the scheduler
+ * @param[in]  *scheduler pointer to a bmp180 scheduler structure
+ * @param[in]  *sensor pointer to a sensor array
+ * @param[in]  capacity sensor array capacity
+ * @param[in]  *timestamp_us pointer to a monotonic timestamp function in us
+ * @param[in]  *delay_us pointer to a delay function in us
+ * @return     status code
+ *             - 0 success
+ *             - 1 sensor array is invalid
+ *             - 2 scheduler is NULL
+ *             - 3 linked functions is NULL
+ * @note       the scheduler doesn't allocate memory, the sensor array must live as long as the scheduler
+ */
+uint8_t bmp180_scheduler_init(bmp180_scheduler_t *scheduler, bmp180_scheduler_sensor_t *sensor, uint8_t capacity,
+                              uint64_t (*timestamp_us)(void), void (*delay_us)(uint32_t us))
+{
+    if (scheduler == NULL)                                                  /* check scheduler */
+    {
+        return 2;                                                           /* return error */
+    }
+    if ((timestamp_us == NULL) || (delay_us == NULL))                       /* check linked functions */
+    {
+        return 3;                                                           /* return error */
+    }
+    if ((sensor == NULL) || (capacity == 0))                                /* check sensor array */
+    {
+        return 1;                                                           /* return error */
+    }
+    
+    memset(scheduler, 0, sizeof(bmp180_scheduler_t));                       /* clear the scheduler */
+    memset(sensor, 0, sizeof(bmp180_scheduler_sensor_t) * capacity);        /* clear the sensors */
+    scheduler->sensor = sensor;                                             /* set sensor array */
+    scheduler->capacity = capacity;                                         /* set capacity */
+    scheduler->timestamp_us = timestamp_us;                                 /* set timestamp_us */
+    scheduler->delay_us = delay_us;                                         /* set delay_us */
+    scheduler->inited = 1;                                                  /* flag finish initialization */
+    
+    return 0;                                                               /* success return 0 */
+}
+
+/**
+ * @brief      add a sensor to the scheduler
+ * @param[in]  *scheduler pointer to a bmp180 scheduler structure
+ * @param[in]  *handle pointer to an initialized bmp180 handle structure
+ * @param[out] *index pointer to a sensor index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 handle is invalid
+ *             - 2 scheduler is NULL
+ *             - 3 scheduler is not initialized
+ *             - 4 scheduler is full
+ * @note       the scheduler drives the handle with the split-phase api,
+ *             the caller must not use the handle while the scheduler owns it,
+ *             a conversion that is already running is fetched by the first poll
+ */
+uint8_t bmp180_scheduler_add(bmp180_scheduler_t *scheduler, bmp180_handle_t *handle, uint8_t *index)
+{
+    bmp180_state_t state;
+    
+    if (scheduler == NULL)                                      /* check scheduler */
+    {
+        return 2;                                               /* return error */
+    }
+    if (scheduler->inited != 1)                                 /* check scheduler initialization */
+    {
+        return 3;                                               /* return error */
+    }
+    if (scheduler->count >= scheduler->capacity)                /* check capacity */
+    {
+        return 4;                                               /* return error */
+    }
+    if (bmp180_get_state(handle, &state) != 0)                  /* check handle */
+    {
+        return 1;                                               /* return error */
+    }
+    
+    memset(&scheduler->sensor[scheduler->count], 0,
+           sizeof(bmp180_scheduler_sensor_t));                  /* clear the sensor */
+    scheduler->sensor[scheduler->count].handle = handle;        /* set handle */
+    if ((state == BMP180_STATE_TEMPERATURE_CONVERTING) || 
+        (state == BMP180_STATE_TEMPERATURE_READY))              /* temperature is running */
+    {
+        scheduler->sensor[scheduler->count].phase = 
+            BMP180_SCHEDULER_PHASE_TEMPERATURE;                 /* take it over */
+    }
+    else if ((state == BMP180_STATE_PRESSURE_CONVERTING) || 
+             (state == BMP180_STATE_PRESSURE_READY))            /* pressure is running */
+    {
+        scheduler->sensor[scheduler->count].mode = 
+            handle->conv_oss;                                   /* save the running mode */
+        scheduler->sensor[scheduler->count].ut = handle->ut;    /* save the raw temperature */
+        scheduler->sensor[scheduler->count].temperature = 
+            (handle->b5 + 8) >> 4;                              /* save the temperature */
+        scheduler->sensor[scheduler->count].phase = 
+            BMP180_SCHEDULER_PHASE_PRESSURE;                    /* take it over */
+    }
+    else
+    {
+        /* start from idle */
+    }
+    *index = scheduler->count;                                  /* get index */
+    scheduler->count++;                                         /* add one sensor */
+    
+    return 0;                                                   /* success return 0 */
+}
+
+/**
+ * @brief     set the sample timing of one sensor
+ * @param[in] *scheduler pointer to a bmp180 scheduler structure
+ * @param[in] index sensor index
+ * @param[in] period_us sample period in us, 0 means back to back
+ * @param[in] margin_us extra wait after the datasheet conversion time
+ * @return    status code
+ *            - 0 success
+ *            - 2 scheduler is NULL
+ *            - 3 scheduler is not initialized
+ *            - 4 index is invalid
+ * @note      the starts stay on the period grid, missed grid points are skipped and counted as overruns,
+ *            a margin suits a sensor whose conversion end is signalled by bmp180_scheduler_wake
+ */
+uint8_t bmp180_scheduler_set_sensor_timing(bmp180_scheduler_t *scheduler, uint8_t index,
+                                           uint32_t period_us, uint32_t margin_us)
+{
+    if (scheduler == NULL)                                 /* check scheduler */
+    {
+        return 2;                                          /* return error */
+    }
+    if (scheduler->inited != 1)                            /* check scheduler initialization */
+    {
+        return 3;                                          /* return error */
+    }
+    if (index >= scheduler->count)                         /* check index */
+    {
+        return 4;                                          /* return error */
+    }
+    
+    scheduler->sensor[index].period_us = period_us;        /* set period */
+    scheduler->sensor[index].margin_us = margin_us;        /* set margin */
+    scheduler->sensor[index].next_us = 0;                  /* restart the period grid */
+    
+    return 0;                                              /* success return 0 */
+}
+
+/**
+ * @brief     make the running conversion of one sensor due at once
+ * @param[in] *scheduler pointer to a bmp180 scheduler structure
+ * @param[in] index sensor index
+ * @return    status code
+ *            - 0 success
+ *            - 2 scheduler is NULL
+ *            - 3 scheduler is not initialized
+ *            - 4 index is invalid
+ *            - 5 no conversion is running
+ * @note      it is called on the eoc edge, the next poll fetches the conversion
+ */
+uint8_t bmp180_scheduler_wake(bmp180_scheduler_t *scheduler, uint8_t index)
+{
+    if (scheduler == NULL)                                                    /* check scheduler */
+    {
+        return 2;                                                             /* return error */
+    }
+    if (scheduler->inited != 1)                                               /* check scheduler initialization */
+    {
+        return 3;                                                             /* return error */
+    }
+    if (index >= scheduler->count)                                            /* check index */
+    {
+        return 4;                                                             /* return error */
+    }
+    if (scheduler->sensor[index].phase == BMP180_SCHEDULER_PHASE_IDLE)        /* check phase */
+    {
+        return 5;                                                             /* return error */
+    }
+    
+    scheduler->sensor[index].deadline_us = 0;                                 /* due at once */
+    
+    return 0;                                                                 /* success return 0 */
+}
+
+/**
+ * @brief      get the earliest deadline of all sensors
+ * @param[in]  *scheduler pointer to a bmp180 scheduler structure
+ * @param[out] *deadline_us pointer to a deadline buffer in us
+ * @return     status code
+ *             - 0 success
+ *             - 2 scheduler is NULL
+ *             - 3 scheduler is not initialized
+ *             - 4 no sensor is added
+ * @note       the deadline is on the timestamp_us clock, the next poll has work when it is reached
+ */
+uint8_t bmp180_scheduler_get_deadline(bmp180_scheduler_t *scheduler, uint64_t *deadline_us)
+{
+    uint8_t i;
+    
+    if (scheduler == NULL)                                          /* check scheduler */
+    {
+        return 2;                                                   /* return error */
+    }
+    if (scheduler->inited != 1)                                     /* check scheduler initialization */
+    {
+        return 3;                                                   /* return error */
+    }
+    if (scheduler->count == 0)                                      /* check sensors */
+    {
+        return 4;                                                   /* return error */
+    }
+    
+    *deadline_us = scheduler->sensor[0].deadline_us;                /* first deadline */
+    for (i = 1; i < scheduler->count; i++)                          /* find the earliest */
+    {
+        if (scheduler->sensor[i].deadline_us < *deadline_us)        /* check deadline */
+        {
+            *deadline_us = scheduler->sensor[i].deadline_us;        /* save deadline */
+        }
+    }
+    
+    return 0;                                                       /* success return 0 */
+}
+
+/**
+ * @brief      run every due action once without blocking
+ * @param[in]  *scheduler pointer to a bmp180 scheduler structure
+ * @param[out] *sample pointer to a sample buffer
+ * @param[in]  len sample buffer length
+ * @param[out] *count pointer to a harvested sample count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 sample is NULL
+ *             - 2 scheduler is NULL
+ *             - 3 scheduler is not initialized
+ * @note       finished conversions are harvested in completion order and the next
+ *             conversion of that sensor is started at once, so all sensors convert in parallel
+ */
+uint8_t bmp180_scheduler_poll(bmp180_scheduler_t *scheduler, bmp180_sample_t *sample, uint32_t len, uint32_t *count)
+{
+    uint64_t now;
+    uint64_t deadline;
+    uint8_t i;
+    uint8_t next;
+    
+    if (scheduler == NULL)                                                                  /* check scheduler */
+    {
+        return 2;                                                                           /* return error */
+    }
+    if (scheduler->inited != 1)                                                             /* check scheduler initialization */
+    {
+        return 3;                                                                           /* return error */
+    }
+    
+    if ((sample == NULL) && (len != 0))                                                     /* check sample */
+    {
+        return 1;                                                                           /* return error */
+    }
+    
+    *count = 0;                                                                             /* no sample */
+    now = scheduler->timestamp_us();                                                        /* get time */
+    if (scheduler->started == 0)                                                            /* first poll */
+    {
+        scheduler->start_us = now;                                                          /* start the rate clock */
+        scheduler->started = 1;                                                             /* flag started */
+    }
+    while (1)                                                                               /* run all due actions */
+    {
+        next = scheduler->count;                                                            /* no sensor */
+        deadline = now;                                                                     /* latest allowed deadline */
+        for (i = 0; i < scheduler->count; i++)                                              /* find the earliest */
+        {
+            if ((scheduler->sensor[i].deadline_us <= deadline) && 
+                ((scheduler->sensor[i].phase != BMP180_SCHEDULER_PHASE_PRESSURE) || 
+                 (*count < len)))                                                           /* due and storable */
+            {
+                deadline = scheduler->sensor[i].deadline_us;                                /* save deadline */
+                next = i;                                                                   /* save index */
+            }
+        }
+        if (next == scheduler->count)                                                       /* nothing is due */
+        {
+            break;                                                                          /* break */
+        }
+        *count += a_bmp180_scheduler_harvest(scheduler, next, now, &sample[*count]);        /* harvest */
+        now = scheduler->timestamp_us();                                                    /* update time */
+    }
+    
+    return 0;                                                                               /* success return 0 */
+}
+
+/**
+ * @brief      read samples and sleep until the next conversion is due
+ * @param[in]  *scheduler pointer to a bmp180 scheduler structure
+ * @param[out] *sample pointer to a sample buffer
+ * @param[in]  len sample buffer length
+ * @return     status code
+ *             - 0 success
+ *             - 1 sample is NULL
+ *             - 2 scheduler is NULL
+ *             - 3 scheduler is not initialized
+ *             - 4 no sensor is added
+ *             - 5 all sensors keep failing
+ * @note       it returns when len samples are harvested,
+ *             it gives up when 8 rounds in a row count errors without a sample
+ */
+uint8_t bmp180_scheduler_read(bmp180_scheduler_t *scheduler, bmp180_sample_t *sample, uint32_t len)
+{
+    uint64_t now;
+    uint64_t deadline;
+    uint32_t total;
+    uint32_t count;
+    uint32_t errors;
+    uint32_t last;
+    uint8_t failed;
+    uint8_t i;
+    
+    if (scheduler == NULL)                                                                  /* check scheduler */
+    {
+        return 2;                                                                           /* return error */
+    }
+    if (scheduler->inited != 1)                                                             /* check scheduler initialization */
+    {
+        return 3;                                                                           /* return error */
+    }
+    if (scheduler->count == 0)                                                              /* check sensors */
+    {
+        return 4;                                                                           /* return error */
+    }
+    if (sample == NULL)                                                                     /* check sample */
+    {
+        return 1;                                                                           /* return error */
+    }
+    
+    total = 0;                                                                              /* init 0 */
+    failed = 0;                                                                             /* init 0 */
+    last = 0;                                                                               /* init 0 */
+    for (i = 0; i < scheduler->count; i++)                                                  /* sum the errors */
+    {
+        last += scheduler->sensor[i].errors;                                                /* add errors */
+    }
+    while (total < len)                                                                     /* until len samples */
+    {
+        if (bmp180_scheduler_poll(scheduler, &sample[total], len - total, &count) != 0)     /* run the due actions */
+        {
+            return 1;                                                                       /* return error */
+        }
+        total += count;                                                                     /* add samples */
+        errors = 0;                                                                         /* init 0 */
+        for (i = 0; i < scheduler->count; i++)                                              /* sum the errors */
+        {
+            errors += scheduler->sensor[i].errors;                                          /* add errors */
+        }
+        if (count != 0)                                                                     /* a sample is harvested */
+        {
+            failed = 0;                                                                     /* reset failed rounds */
+        }
+        else if (errors != last)                                                            /* only errors */
+        {
+            failed++;                                                                       /* count the failed round */
+            if (failed >= BMP180_SCHEDULER_READ_MAX_FAILED_ROUNDS)                          /* check failed rounds */
+            {
+                return 5;                                                                   /* return error */
+            }
+        }
+        else
+        {
+            /* conversions are still running */
+        }
+        last = errors;                                                                      /* save errors */
+        if (total >= len)                                                                   /* check samples */
+        {
+            break;                                                                          /* break */
+        }
+        deadline = scheduler->sensor[0].deadline_us;                                        /* first deadline */
+        for (i = 1; i < scheduler->count; i++)                                              /* find the earliest */
+        {
+            if (scheduler->sensor[i].deadline_us < deadline)                                /* check deadline */
+            {
+                deadline = scheduler->sensor[i].deadline_us;                                /* save deadline */
+            }
+        }
+        now = scheduler->timestamp_us();                                                    /* get time */
+        if (deadline > now)                                                                 /* check deadline */
+        {
+            scheduler->delay_us((uint32_t)(deadline - now));                                /* sleep until it is due */
+        }
+    }
+    
+    return 0;                                                                               /* success return 0 */
+}
+
+/**
+ * @brief      get the aggregate sample rate
+ * @param[in]  *scheduler pointer to a bmp180 scheduler structure
+ * @param[out] *samples pointer to a sample counter buffer
+ * @param[out] *rate_mhz pointer to a sample rate buffer in mHz
+ * @return     status code
+ *             - 0 success
+ *             - 2 scheduler is NULL
+ *             - 3 scheduler is not initialized
+ * @note       the rate is measured from the first poll or the last bmp180_scheduler_clear_rate
+ */
+uint8_t bmp180_scheduler_get_rate(bmp180_scheduler_t *scheduler, uint64_t *samples, uint32_t *rate_mhz)
+{
+    uint64_t elapsed;
+    
+    if (scheduler == NULL)                                                             /* check scheduler */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (scheduler->inited != 1)                                                        /* check scheduler initialization */
+    {
+        return 3;                                                                      /* return error */
+    }
+    
+    elapsed = scheduler->timestamp_us() - scheduler->start_us;                         /* get elapsed time */
+    *samples = scheduler->samples;                                                     /* get samples */
+    *rate_mhz = ((scheduler->started != 0) && (elapsed != 0)) ?
+                (uint32_t)((scheduler->samples * 1000000000ULL) / elapsed) : 0;        /* get rate */
+                
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief      get the sample rate of one sensor
+ * @param[in]  *scheduler pointer to a bmp180 scheduler structure
+ * @param[in]  index sensor index
+ * @param[out] *samples pointer to a sample counter buffer
+ * @param[out] *errors pointer to an error counter buffer
+ * @param[out] *rate_mhz pointer to a sample rate buffer in mHz
+ * @return     status code
+ *             - 0 success
+ *             - 2 scheduler is NULL
+ *             - 3 scheduler is not initialized
+ *             - 4 index is invalid
+ * @note       none
+ */
+uint8_t bmp180_scheduler_get_sensor_rate(bmp180_scheduler_t *scheduler, uint8_t index,
+                                         uint64_t *samples, uint32_t *errors, uint32_t *rate_mhz)
+{
+    uint64_t elapsed;
+    
+    if (scheduler == NULL)                                            /* check scheduler */
+    {
+        return 2;                                                     /* return error */
+    }
+    if (scheduler->inited != 1)                                       /* check scheduler initialization */
+    {
+        return 3;                                                     /* return error */
+    }
+    if (index >= scheduler->count)                                    /* check index */
+    {
+        return 4;                                                     /* return error */
+    }
+    
+    elapsed = scheduler->timestamp_us() - scheduler->start_us;        /* get elapsed time */
+    *samples = scheduler->sensor[index].samples;                      /* get samples */
+    *errors = scheduler->sensor[index].errors;                        /* get errors */
+    *rate_mhz = ((scheduler->started != 0) && (elapsed != 0)) ?
+                (uint32_t)((scheduler->sensor[index].samples * 1000000000ULL) / elapsed) : 0;  /* get rate */
+                
+    return 0;                                                         /* success return 0 */
+}
+
+/**
+ * @brief      get the overruns of one sensor
+ * @param[in]  *scheduler pointer to a bmp180 scheduler structure
+ * @param[in]  index sensor index
+ * @param[out] *overruns pointer to an overrun counter buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 scheduler is NULL
+ *             - 3 scheduler is not initialized
+ *             - 4 index is invalid
+ * @note       only a sensor with a period counts overruns
+ */
+uint8_t bmp180_scheduler_get_sensor_overruns(bmp180_scheduler_t *scheduler, uint8_t index, uint64_t *overruns)
+{
+    if (scheduler == NULL)                                /* check scheduler */
+    {
+        return 2;                                         /* return error */
+    }
+    if (scheduler->inited != 1)                           /* check scheduler initialization */
+    {
+        return 3;                                         /* return error */
+    }
+    if (index >= scheduler->count)                        /* check index */
+    {
+        return 4;                                         /* return error */
+    }
+    
+    *overruns = scheduler->sensor[index].overruns;        /* get overruns */
+    
+    return 0;                                             /* success return 0 */
+}
+
+/**
+ * @brief     clear the sample counters and restart the rate clock
+ * @param[in] *scheduler pointer to a bmp180 scheduler structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 scheduler is NULL
+ *            - 3 scheduler is not initialized
+ * @note      none
+ */
+uint8_t bmp180_scheduler_clear_rate(bmp180_scheduler_t *scheduler)
+{
+    uint8_t i;
+    
+    if (scheduler == NULL)                                  /* check scheduler */
+    {
+        return 2;                                           /* return error */
+    }
+    if (scheduler->inited != 1)                             /* check scheduler initialization */
+    {
+        return 3;                                           /* return error */
+    }
+    
+    for (i = 0; i < scheduler->count; i++)                  /* clear all sensors */
+    {
+        scheduler->sensor[i].samples = 0;                   /* clear samples */
+        scheduler->sensor[i].errors = 0;                    /* clear errors */
+        scheduler->sensor[i].overruns = 0;                  /* clear overruns */
+    }
+    scheduler->samples = 0;                                 /* clear samples */
+    scheduler->start_us = scheduler->timestamp_us();        /* restart the rate clock */
+    scheduler->started = 1;                                 /* flag started */
+    
+    return 0;                                               /* success return 0 */
+}
@@ -0,0 +1,263 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_bmp180_scheduler.h
+ * @brief     driver bmp180 scheduler header file
+ * @version   2.1.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>2.1      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_BMP180_SCHEDULER_H
+#define DRIVER_BMP180_SCHEDULER_H
+
+#include "driver_bmp180.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup bmp180_scheduler_driver bmp180 scheduler driver function
+ * @brief    bmp180 scheduler driver modules
+ * @ingroup  bmp180_driver
+ * @{
+ */
+
+/**
+ * @brief bmp180 scheduler sensor structure definition
+ */
+typedef struct bmp180_scheduler_sensor_s
+{
+    bmp180_handle_t *handle;        /**< initialized sensor handle */
+    uint64_t deadline_us;           /**< time of the next action */
+    uint64_t next_us;               /**< next sample start on the period grid */
+    uint64_t samples;               /**< sample counter */
+    uint64_t overruns;              /**< missed sample starts */
+    uint32_t period_us;             /**< sample period in us, 0 means back to back */
+    uint32_t margin_us;             /**< extra wait after the datasheet conversion time */
+    uint32_t errors;                /**< error counter */
+    int32_t temperature;            /**< last temperature in 0.1 degrees celsius */
+    uint16_t ut;                    /**< last raw temperature */
+    uint8_t phase;                  /**< scheduler phase */
+    uint8_t mode;                   /**< mode of the running pressure conversion */
+} bmp180_scheduler_sensor_t;
+
+/**
+ * @brief bmp180 scheduler structure definition
+ */
+typedef struct bmp180_scheduler_s
+{
+    bmp180_scheduler_sensor_t *sensor;        /**< caller provided sensor array */
+    uint8_t capacity;                         /**< sensor array capacity */
+    uint8_t count;                            /**< sensor count */
+    uint8_t started;                          /**< rate clock started flag */
+    uint8_t inited;                           /**< inited flag */
+    uint32_t sequence;                        /**< next sample sequence number */
+    uint64_t samples;                         /**< aggregate sample counter */
+    uint64_t start_us;                        /**< rate clock start time */
+    uint64_t (*timestamp_us)(void);           /**< point to a timestamp_us function address */
+    void (*delay_us)(uint32_t us);            /**< point to a delay_us function address */
+} bmp180_scheduler_t;
+
+/**
+ * @brief      initialize the scheduler
+ * @param[in]  *scheduler pointer to a bmp180 scheduler structure
+ * @param[in]  *sensor pointer to a sensor array
+ * @param[in]  capacity sensor array capacity
+ * @param[in]  *timestamp_us pointer to a monotonic timestamp function in us
+ * @param[in]  *delay_us pointer to a delay function in us
+ * @return     status code
+ *             - 0 success
+ *             - 1 sensor array is invalid
+ *             - 2 scheduler is NULL
+ *             - 3 linked functions is NULL
+ * @note       the scheduler doesn't allocate memory, the sensor array must live as long as the scheduler
+ */
+uint8_t bmp180_scheduler_init(bmp180_scheduler_t *scheduler, bmp180_scheduler_sensor_t *sensor, uint8_t capacity,
+                              uint64_t (*timestamp_us)(void), void (*delay_us)(uint32_t us));
+
+/**
+ * @brief      add a sensor to the scheduler
+ * @param[in]  *scheduler pointer to a bmp180 scheduler structure
+ * @param[in]  *handle pointer to an initialized bmp180 handle structure
+ * @param[out] *index pointer to a sensor index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 handle is invalid
+ *             - 2 scheduler is NULL
+ *             - 3 scheduler is not initialized
+ *             - 4 scheduler is full
+ * @note       the scheduler drives the handle with the split-phase api,
+ *             the caller must not use the handle while the scheduler owns it,
+ *             a conversion that is already running is fetched by the first poll
+ */
+uint8_t bmp180_scheduler_add(bmp180_scheduler_t *scheduler, bmp180_handle_t *handle, uint8_t *index);
+
+/**
+ * @brief     set the sample timing of one sensor
+ * @param[in] *scheduler pointer to a bmp180 scheduler structure
+ * @param[in] index sensor index
+ * @param[in] period_us sample period in us, 0 means back to back
+ * @param[in] margin_us extra wait after the datasheet conversion time
+ * @return    status code
+ *            - 0 success
+ *            - 2 scheduler is NULL
+ *            - 3 scheduler is not initialized
+ *            - 4 index is invalid
+ * @note      the starts stay on the period grid, missed grid points are skipped and counted as overruns,
+ *            a margin suits a sensor whose conversion end is signalled by bmp180_scheduler_wake
+ */
+uint8_t bmp180_scheduler_set_sensor_timing(bmp180_scheduler_t *scheduler, uint8_t index,
+                                           uint32_t period_us, uint32_t margin_us);
+
+/**
+ * @brief     make the running conversion of one sensor due at once
+ * @param[in] *scheduler pointer to a bmp180 scheduler structure
+ * @param[in] index sensor index
+ * @return    status code
+ *            - 0 success
+ *            - 2 scheduler is NULL
+ *            - 3 scheduler is not initialized
+ *            - 4 index is invalid
+ *            - 5 no conversion is running
+ * @note      it is called on the eoc edge, the next poll fetches the conversion
+ */
+uint8_t bmp180_scheduler_wake(bmp180_scheduler_t *scheduler, uint8_t index);
+
+/**
+ * @brief      get the earliest deadline of all sensors
+ * @param[in]  *scheduler pointer to a bmp180 scheduler structure
+ * @param[out] *deadline_us pointer to a deadline buffer in us
+ * @return     status code
+ *             - 0 success
+ *             - 2 scheduler is NULL
+ *             - 3 scheduler is not initialized
+ *             - 4 no sensor is added
+ * @note       the deadline is on the timestamp_us clock, the next poll has work when it is reached
+ */
+uint8_t bmp180_scheduler_get_deadline(bmp180_scheduler_t *scheduler, uint64_t *deadline_us);
+
+/**
+ * @brief      run every due action once without blocking
+ * @param[in]  *scheduler pointer to a bmp180 scheduler structure
+ * @param[out] *sample pointer to a sample buffer
+ * @param[in]  len sample buffer length
+ * @param[out] *count pointer to a harvested sample count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 sample is NULL
+ *             - 2 scheduler is NULL
+ *             - 3 scheduler is not initialized
+ * @note       finished conversions are harvested in completion order and the next
+ *             conversion of that sensor is started at once, so all sensors convert in parallel
+ */
+uint8_t bmp180_scheduler_poll(bmp180_scheduler_t *scheduler, bmp180_sample_t *sample, uint32_t len, uint32_t *count);
+
+/**
+ * @brief      read samples and sleep until the next conversion is due
+ * @param[in]  *scheduler pointer to a bmp180 scheduler structure
+ * @param[out] *sample pointer to a sample buffer
+ * @param[in]  len sample buffer length
+ * @return     status code
+ *             - 0 success
+ *             - 1 sample is NULL
+ *             - 2 scheduler is NULL
+ *             - 3 scheduler is not initialized
+ *             - 4 no sensor is added
+ *             - 5 all sensors keep failing
+ * @note       it returns when len samples are harvested,
+ *             it gives up when 8 rounds in a row count errors without a sample
+ */
+uint8_t bmp180_scheduler_read(bmp180_scheduler_t *scheduler, bmp180_sample_t *sample, uint32_t len);
+
+/**
+ * @brief      get the aggregate sample rate
+ * @param[in]  *scheduler pointer to a bmp180 scheduler structure
+ * @param[out] *samples pointer to a sample counter buffer
+ * @param[out] *rate_mhz pointer to a sample rate buffer in mHz
+ * @return     status code
+ *             - 0 success
+ *             - 2 scheduler is NULL
+ *             - 3 scheduler is not initialized
+ * @note       the rate is measured from the first poll or the last bmp180_scheduler_clear_rate
+ */
+uint8_t bmp180_scheduler_get_rate(bmp180_scheduler_t *scheduler, uint64_t *samples, uint32_t *rate_mhz);
+
+/**
+ * @brief      get the sample rate of one sensor
+ * @param[in]  *scheduler pointer to a bmp180 scheduler structure
+ * @param[in]  index sensor index
+ * @param[out] *samples pointer to a sample counter buffer
+ * @param[out] *errors pointer to an error counter buffer
+ * @param[out] *rate_mhz pointer to a sample rate buffer in mHz
+ * @return     status code
+ *             - 0 success
+ *             - 2 scheduler is NULL
+ *             - 3 scheduler is not initialized
+ *             - 4 index is invalid
+ * @note       none
+ */
+uint8_t bmp180_scheduler_get_sensor_rate(bmp180_scheduler_t *scheduler, uint8_t index,
+                                         uint64_t *samples, uint32_t *errors, uint32_t *rate_mhz);
+
+/**
+ * @brief      get the overruns of one sensor
+ * @param[in]  *scheduler pointer to a bmp180 scheduler structure
+ * @param[in]  index sensor index
+ * @param[out] *overruns pointer to an overrun counter buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 scheduler is NULL
+ *             - 3 scheduler is not initialized
+ *             - 4 index is invalid
+ * @note       only a sensor with a period counts overruns
+ */
+uint8_t bmp180_scheduler_get_sensor_overruns(bmp180_scheduler_t *scheduler, uint8_t index, uint64_t *overruns);
+
+/**
+ * @brief     clear the sample counters and restart the rate clock
+ * @param[in] *scheduler pointer to a bmp180 scheduler structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 scheduler is NULL
+ *            - 3 scheduler is not initialized
+ * @note      none
+ */
+uint8_t bmp180_scheduler_clear_rate(bmp180_scheduler_t *scheduler);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
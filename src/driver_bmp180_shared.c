@@ -0,0 +1,283 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_bmp180_shared.c
+ * @brief     driver bmp180 shared source file
+ * @version   2.1.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>2.1      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_bmp180_shared.h"
+#include <string.h>
+
+/**
+ * @brief     publish the result of a conversion
+ * @param[in] *shared pointer to a bmp180 shared structure
+ * @param[in] res read status
+ * @param[in] *sample pointer to a sample
+ * @note      only the owner writes, an odd sequence tells the readers to retry
+ */
+static void a_bmp180_shared_store(bmp180_shared_t *shared, uint8_t res, const bmp180_sample_t *sample)
+{
+    uint32_t word[BMP180_SHARED_WORDS];
+    uint32_t sequence;
+    uint32_t i;
+    
+    memset(word, 0, sizeof(word));                                              /* clear the words */
+    word[0] = res;                                                              /* set the status */
+    memcpy(&word[1], sample, sizeof(bmp180_sample_t));                          /* set the sample */
+    sequence = __atomic_load_n(&shared->sequence, __ATOMIC_RELAXED);            /* only the owner writes sequence */
+    __atomic_store_n(&shared->sequence, sequence + 1, __ATOMIC_RELAXED);        /* odd while written */
+    __atomic_thread_fence(__ATOMIC_RELEASE);                                    /* keep the words after the odd sequence */
+    for (i = 0; i < BMP180_SHARED_WORDS; i++)                                   /* copy all words */
+    {
+        __atomic_store_n(&shared->word[i], word[i], __ATOMIC_RELAXED);          /* store a word */
+    }
+    __atomic_store_n(&shared->sequence, sequence + 2, __ATOMIC_RELEASE);        /* publish the result */
+}
+
+/**
+ * @brief      copy the result of the last conversion
+ * @param[in]  *shared pointer to a bmp180 shared structure
+ * @param[in]  sequence even sequence loaded before the copy
+ * @param[out] *res pointer to a read status buffer
+ * @param[out] *sample pointer to a sample buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 the result was rewritten during the copy
+ * @note       none
+ */
+static uint8_t a_bmp180_shared_load(bmp180_shared_t *shared, uint32_t sequence, uint8_t *res, bmp180_sample_t *sample)
+{
+    uint32_t word[BMP180_SHARED_WORDS];
+    uint32_t i;
+    
+    for (i = 0; i < BMP180_SHARED_WORDS; i++)                                    /* copy all words */
+    {
+        word[i] = __atomic_load_n(&shared->word[i], __ATOMIC_RELAXED);           /* load a word */
+    }
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);                                     /* keep the words before the second load */
+    if (__atomic_load_n(&shared->sequence, __ATOMIC_RELAXED) != sequence)        /* check the sequence */
+    {
+        return 1;                                                                /* return error */
+    }
+    *res = (uint8_t)word[0];                                                     /* get the status */
+    memcpy(sample, &word[1], sizeof(bmp180_sample_t));                           /* get the sample */
+    
+    return 0;                                                                    /* success return 0 */
+}
+
+/**
+ * @brief      run a conversion and publish it
+ * @param[in]  *shared pointer to a bmp180 shared structure
+ * @param[out] *sample pointer to a sample buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the caller owns the bus, it is released after the result is published
+ */
+static uint8_t a_bmp180_shared_convert(bmp180_shared_t *shared, bmp180_sample_t *sample)
+{
+    uint16_t ut;
+    int32_t temperature;
+    uint32_t up;
+    uint32_t pa;
+    uint8_t res;
+    
+    res = bmp180_read_temperature_pressure_fixed(shared->handle, &ut, &temperature, 
+                                                 &up, &pa);                           /* read */
+    memset(sample, 0, sizeof(bmp180_sample_t));                                       /* clear the sample */
+    if (res == 0)                                                                     /* check the result */
+    {
+        sample->timestamp_us = shared->timestamp_us();                                /* set timestamp */
+        sample->sequence = shared->sample_sequence++;                                 /* set sequence */
+        sample->up = up;                                                              /* set raw pressure */
+        sample->temperature = temperature;                                            /* set temperature */
+        sample->pa = pa;                                                              /* set pressure */
+        sample->ut = ut;                                                              /* set raw temperature */
+        sample->mode = shared->handle->conv_oss;                                      /* set mode */
+    }
+    else
+    {
+        res = 1;                                                                      /* read failed */
+    }
+    a_bmp180_shared_store(shared, res, sample);                                       /* publish to the waiting callers */
+    __atomic_fetch_add(&shared->conversions, 1, __ATOMIC_RELAXED);                    /* count the conversion */
+    __atomic_store_n(&shared->owner, 0, __ATOMIC_RELEASE);                            /* release the bus */
+    
+    return res;                                                                       /* return the result */
+}
+
+/**
+ * @brief     initialize the shared handle
+ * @param[in] *shared pointer to a bmp180 shared structure
+ * @param[in] *handle pointer to an initialized bmp180 handle structure
+ * @param[in] *timestamp_us pointer to a monotonic timestamp function in us
+ * @param[in] *delay_us pointer to a delay function in us
+ * @return    status code
+ *            - 0 success
+ *            - 1 handle is invalid
+ *            - 2 shared is NULL
+ *            - 3 linked functions is NULL
+ * @note      the shared handle owns the bmp180 handle, every thread must read through it
+ */
+uint8_t bmp180_shared_init(bmp180_shared_t *shared, bmp180_handle_t *handle,
+                           uint64_t (*timestamp_us)(void), void (*delay_us)(uint32_t us))
+{
+    if (shared == NULL)                                            /* check shared */
+    {
+        return 2;                                                  /* return error */
+    }
+    if ((timestamp_us == NULL) || (delay_us == NULL))              /* check the linked functions */
+    {
+        return 3;                                                  /* return error */
+    }
+    if ((handle == NULL) || (handle->inited != 1))                 /* check handle */
+    {
+        return 1;                                                  /* return error */
+    }
+    
+    memset(shared, 0, sizeof(bmp180_shared_t));                    /* clear the shared handle */
+    shared->handle = handle;                                       /* set handle */
+    shared->timestamp_us = timestamp_us;                           /* set timestamp_us */
+    shared->delay_us = delay_us;                                   /* set delay_us */
+    __atomic_store_n(&shared->inited, 1, __ATOMIC_RELEASE);        /* flag finish initialization */
+    
+    return 0;                                                      /* success return 0 */
+}
+
+/**
+ * @brief      read the temperature and the pressure from any thread
+ * @param[in]  *shared pointer to a bmp180 shared structure
+ * @param[in]  max_age_us max age of an acceptable cached sample, 0 means no cached sample
+ * @param[out] *sample pointer to a sample buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 shared is NULL
+ *             - 3 shared is not initialized
+ *             - 4 sample is NULL
+ * @note       a caller that finds a conversion in flight waits for it and receives its result,
+ *             so concurrent callers share one conversion and never write CTRL_MEAS at the same time,
+ *             the waiting callers poll the result every BMP180_SHARED_POLL_US with delay_us and
+ *             take the bus themselves when it is released without a newer result
+ */
+uint8_t bmp180_shared_read(bmp180_shared_t *shared, uint32_t max_age_us, bmp180_sample_t *sample)
+{
+    uint8_t res;
+    uint32_t owner;
+    uint32_t sequence;
+    uint32_t current;
+    uint64_t now;
+    
+    if (shared == NULL)                                                                   /* check shared */
+    {
+        return 2;                                                                         /* return error */
+    }
+    if (__atomic_load_n(&shared->inited, __ATOMIC_ACQUIRE) != 1)                          /* check shared initialization */
+    {
+        return 3;                                                                         /* return error */
+    }
+    if (sample == NULL)                                                                   /* check sample */
+    {
+        return 4;                                                                         /* return error */
+    }
+    
+    sequence = __atomic_load_n(&shared->sequence, __ATOMIC_ACQUIRE);                      /* result on arrival */
+    if ((max_age_us != 0) && (sequence != 0) && ((sequence & 1) == 0) && 
+        (a_bmp180_shared_load(shared, sequence, &res, sample) == 0) && (res == 0))        /* check the cached sample */
+    {
+        now = shared->timestamp_us();                                                     /* get time */
+        if ((now >= sample->timestamp_us) && 
+            ((now - sample->timestamp_us) <= max_age_us))                                 /* check the age */
+        {
+            __atomic_fetch_add(&shared->hits, 1, __ATOMIC_RELAXED);                       /* count the hit */
+            
+            return 0;                                                                     /* success return 0 */
+        }
+    }
+    
+    while (1)                                                                             /* loop */
+    {
+        owner = 0;                                                                        /* expect no owner */
+        if ((__atomic_load_n(&shared->owner, __ATOMIC_RELAXED) == 0) && 
+            (__atomic_compare_exchange_n(&shared->owner, &owner, 1, 0, 
+                                         __ATOMIC_ACQUIRE, __ATOMIC_RELAXED) != 0))       /* take the bus */
+        {
+            if (__atomic_load_n(&shared->sequence, __ATOMIC_ACQUIRE) == sequence)         /* no newer result */
+            {
+                return a_bmp180_shared_convert(shared, sample);                           /* run the conversion */
+            }
+            __atomic_store_n(&shared->owner, 0, __ATOMIC_RELEASE);                        /* a result came first */
+        }
+        
+        /* another caller runs the conversion, wait for a result newer than the one on arrival */
+        current = __atomic_load_n(&shared->sequence, __ATOMIC_ACQUIRE);                   /* get the sequence */
+        if ((current != sequence) && ((current & 1) == 0) && 
+            (a_bmp180_shared_load(shared, current, &res, sample) == 0))                   /* copy the new result */
+        {
+            break;                                                                        /* break */
+        }
+        shared->delay_us(BMP180_SHARED_POLL_US);                                          /* wait the owner */
+    }
+    __atomic_fetch_add(&shared->joined, 1, __ATOMIC_RELAXED);                             /* count the joined call */
+    
+    return res;                                                                           /* return the result */
+}
+
+/**
+ * @brief      get the shared handle counters
+ * @param[in]  *shared pointer to a bmp180 shared structure
+ * @param[out] *conversions pointer to a bus conversion counter buffer
+ * @param[out] *joined pointer to a joined call counter buffer
+ * @param[out] *hits pointer to a cached sample counter buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 shared is NULL
+ *             - 3 shared is not initialized
+ * @note       none
+ */
+uint8_t bmp180_shared_get_counter(bmp180_shared_t *shared, uint32_t *conversions, uint32_t *joined, uint32_t *hits)
+{
+    if (shared == NULL)                                                            /* check shared */
+    {
+        return 2;                                                                  /* return error */
+    }
+    if (__atomic_load_n(&shared->inited, __ATOMIC_ACQUIRE) != 1)                   /* check shared initialization */
+    {
+        return 3;                                                                  /* return error */
+    }
+    
+    *conversions = __atomic_load_n(&shared->conversions, __ATOMIC_RELAXED);        /* get conversions */
+    *joined = __atomic_load_n(&shared->joined, __ATOMIC_RELAXED);                  /* get joined */
+    *hits = __atomic_load_n(&shared->hits, __ATOMIC_RELAXED);                      /* get hits */
+    
+    return 0;                                                                      /* success return 0 */
+}
@@ -0,0 +1,144 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_bmp180_shared.h
+ * @brief     driver bmp180 shared header file
+ * @version   2.1.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>2.1      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_BMP180_SHARED_H
+#define DRIVER_BMP180_SHARED_H
+
+#include "driver_bmp180.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup bmp180_shared_driver bmp180 shared driver function
+ * @brief    bmp180 shared driver modules
+ * @ingroup  bmp180_driver
+ * @{
+ */
+
+/**
+ * @brief bmp180 shared poll time definition
+ * @note  the interval of a waiting caller checking for the in-flight result
+ */
+#ifndef BMP180_SHARED_POLL_US
+    #define BMP180_SHARED_POLL_US    200
+#endif
+
+#if !defined(__GNUC__)
+    #error "the bmp180 shared handle needs the gcc atomic builtins"
+#endif
+
+/**
+ * @brief bmp180 shared result size definition
+ */
+#define BMP180_SHARED_WORDS    (1 + (sizeof(bmp180_sample_t) + 3) / 4)        /**< status word and sample words */
+
+/**
+ * @brief bmp180 shared structure definition
+ */
+typedef struct bmp180_shared_s
+{
+    bmp180_handle_t *handle;                    /**< initialized sensor handle */
+    uint64_t (*timestamp_us)(void);             /**< point to a timestamp_us function address */
+    void (*delay_us)(uint32_t us);              /**< point to a delay_us function address */
+    uint32_t owner;                             /**< 1 while a caller runs the conversion */
+    uint32_t sequence;                          /**< result seqlock sequence, odd while the result is written */
+    uint32_t word[BMP180_SHARED_WORDS];         /**< status and sample of the last conversion */
+    uint32_t sample_sequence;                   /**< next sample sequence number */
+    uint32_t conversions;                       /**< conversions on the bus */
+    uint32_t joined;                            /**< calls that received an in-flight conversion */
+    uint32_t hits;                              /**< calls served by a fresh enough cached sample */
+    uint8_t inited;                             /**< inited flag */
+} bmp180_shared_t;
+
+/**
+ * @brief     initialize the shared handle
+ * @param[in] *shared pointer to a bmp180 shared structure
+ * @param[in] *handle pointer to an initialized bmp180 handle structure
+ * @param[in] *timestamp_us pointer to a monotonic timestamp function in us
+ * @param[in] *delay_us pointer to a delay function in us
+ * @return    status code
+ *            - 0 success
+ *            - 1 handle is invalid
+ *            - 2 shared is NULL
+ *            - 3 linked functions is NULL
+ * @note      the shared handle owns the bmp180 handle, every thread must read through it
+ */
+uint8_t bmp180_shared_init(bmp180_shared_t *shared, bmp180_handle_t *handle,
+                           uint64_t (*timestamp_us)(void), void (*delay_us)(uint32_t us));
+
+/**
+ * @brief      read the temperature and the pressure from any thread
+ * @param[in]  *shared pointer to a bmp180 shared structure
+ * @param[in]  max_age_us max age of an acceptable cached sample, 0 means no cached sample
+ * @param[out] *sample pointer to a sample buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 shared is NULL
+ *             - 3 shared is not initialized
+ *             - 4 sample is NULL
+ * @note       a caller that finds a conversion in flight waits for it and receives its result,
+ *             so concurrent callers share one conversion and never write CTRL_MEAS at the same time,
+ *             the waiting callers poll the result every BMP180_SHARED_POLL_US with delay_us and
+ *             take the bus themselves when it is released without a newer result
+ */
+uint8_t bmp180_shared_read(bmp180_shared_t *shared, uint32_t max_age_us, bmp180_sample_t *sample);
+
+/**
+ * @brief      get the shared handle counters
+ * @param[in]  *shared pointer to a bmp180 shared structure
+ * @param[out] *conversions pointer to a bus conversion counter buffer
+ * @param[out] *joined pointer to a joined call counter buffer
+ * @param[out] *hits pointer to a cached sample counter buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 shared is NULL
+ *             - 3 shared is not initialized
+ * @note       none
+ */
+uint8_t bmp180_shared_get_counter(bmp180_shared_t *shared, uint32_t *conversions, uint32_t *joined, uint32_t *hits);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,438 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_bmp180_benchmark_test.c
+ * @brief     driver bmp180 benchmark test source file
+ * @version   2.1.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>2.1      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+#include "driver_bmp180_benchmark_test.h"
+#include "driver_bmp180_batch.h"
+#include "driver_bmp180_codec.h"
+
+/**
+ * @brief benchmark definition
+ */
+#define BENCHMARK_BATCH_SIZE          4096        /**< compensation batch size */
+#define BENCHMARK_BATCH_ROUNDS        16          /**< compensation batches per round */
+#define BENCHMARK_BUS_SAMPLES         100         /**< bus samples per round */
+#define BENCHMARK_BUS_HZ              400000      /**< simulated iic bus clock */
+#define BENCHMARK_CODEC_SAMPLES       1440        /**< one day of samples per minute */
+#define BENCHMARK_CODEC_PERIOD_MS     60000       /**< codec sample period */
+#define BENCHMARK_CODEC_ROUNDS        64          /**< codec passes per round */
+#define BENCHMARK_RAW_RECORD_SIZE     8           /**< packed timestamp, raw temperature and raw pressure record */
+#define BENCHMARK_CODEC_TARGET_RATIO  10          /**< codec target against the raw records */
+#define BENCHMARK_CODEC_TARGET_US     1000        /**< finest timestamp resolution held to the target */
+
+/**
+ * @brief benchmark read api definition
+ */
+#define BENCHMARK_API_TEMPERATURE_PRESSURE    0        /**< bmp180_read_temperature_pressure_fixed */
+#define BENCHMARK_API_PRESSURE                1        /**< bmp180_read_pressure */
+#define BENCHMARK_API_PRESSURE_REUSE          2        /**< bmp180_read_pressure with the temperature reused 10 times */
+#define BENCHMARK_API_TEMPERATURE             3        /**< bmp180_read_temperature_fixed */
+#define BENCHMARK_API_SPLIT_PHASE             4        /**< bmp180_start_* and bmp180_fetch_* */
+
+static bmp180_handle_t gs_handle;                              /**< bmp180 handle */
+static uint16_t gs_ut[BENCHMARK_BATCH_SIZE];                   /**< raw temperature array */
+static uint32_t gs_up[BENCHMARK_BATCH_SIZE];                   /**< raw pressure array */
+static int32_t gs_temperature[BENCHMARK_BATCH_SIZE];           /**< temperature array */
+static uint32_t gs_pa[BENCHMARK_BATCH_SIZE];                   /**< pressure array */
+static bmp180_sample_t gs_sample[BENCHMARK_CODEC_SAMPLES];     /**< codec sample array */
+static uint8_t gs_chunk[BMP180_CODEC_HEADER_SIZE + 
+                        BENCHMARK_CODEC_SAMPLES * BMP180_CODEC_SAMPLE_MAX];    /**< codec chunk */
+static const char *const gs_mode_name[4] = {"ultra_low", "standard", "high", "ultra_high"};
+static const char *const gs_kernel_name[5] = {"auto", "scalar", "sse41", "avx2", "neon"};
+static const char *const gs_wait_name[3] = {"poll", "timed", "eoc"};
+static const char *const gs_api_name[5] = {"read_temperature_pressure", "read_pressure", "read_pressure_reuse", 
+                                           "read_temperature", "split_phase"};
+
+/**
+ * @brief     run one sample of a read api
+ * @param[in] api read api
+ * @return    status code
+ *            - 0 success
+ *            - 1 read failed
+ * @note      none
+ */
+static uint8_t a_benchmark_read(uint8_t api)
+{
+    uint16_t temperature_raw;
+    int32_t temperature;
+    uint32_t pressure_raw;
+    uint32_t pa;
+    uint32_t us;
+    bmp180_bool_t ready;
+    
+    if (api == BENCHMARK_API_TEMPERATURE_PRESSURE)
+    {
+        return bmp180_read_temperature_pressure_fixed(&gs_handle, &temperature_raw, &temperature, &pressure_raw, &pa);
+    }
+    else if ((api == BENCHMARK_API_PRESSURE) || (api == BENCHMARK_API_PRESSURE_REUSE))
+    {
+        return bmp180_read_pressure(&gs_handle, &pressure_raw, &pa);
+    }
+    else if (api == BENCHMARK_API_TEMPERATURE)
+    {
+        return bmp180_read_temperature_fixed(&gs_handle, &temperature_raw, &temperature);
+    }
+    else
+    {
+        /* sleep the datasheet time of the driver and fetch the result */
+        if ((bmp180_start_temperature(&gs_handle) != 0) || 
+            (bmp180_get_conversion_time(&gs_handle, &us) != 0))
+        {
+            return 1;
+        }
+        bmp180_simulator_delay_us(us);
+        (void)bmp180_poll_conversion(&gs_handle, &ready);
+        if (bmp180_fetch_temperature_fixed(&gs_handle, &temperature_raw, &temperature) != 0)
+        {
+            return 1;
+        }
+        if ((bmp180_start_pressure(&gs_handle) != 0) || 
+            (bmp180_get_conversion_time(&gs_handle, &us) != 0))
+        {
+            return 1;
+        }
+        bmp180_simulator_delay_us(us);
+        do
+        {
+            if (bmp180_poll_conversion(&gs_handle, &ready) != 0)
+            {
+                return 1;
+            }
+            if (ready == BMP180_BOOL_FALSE)
+            {
+                bmp180_simulator_delay_us(500);
+            }
+        } while (ready == BMP180_BOOL_FALSE);
+        
+        return bmp180_fetch_pressure(&gs_handle, &pressure_raw, &pa);
+    }
+}
+
+/**
+ * @brief     benchmark test
+ * @param[in] times benchmark rounds
+ * @param[in] *timestamp_ns pointer to a monotonic host timestamp function in ns
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the results are printed as one json document through bmp180_interface_debug_print,
+ *            it runs against the simulator and needs no hardware,
+ *            it fails when the codec misses 10x against the raw records at a 1ms or coarser resolution
+ */
+uint8_t bmp180_benchmark_test(uint32_t times, uint64_t (*timestamp_ns)(void))
+{
+    uint8_t res;
+    uint8_t missed;
+    uint32_t i;
+    uint32_t j;
+    uint32_t k;
+    uint32_t seed;
+    uint32_t mode;
+    uint32_t kernel;
+    uint32_t api;
+    uint32_t wait;
+    uint32_t burst;
+    uint32_t samples;
+    uint64_t start;
+    uint64_t ns;
+    bmp180_info_t info;
+    bmp180_bool_t supported;
+    const char *separator;
+    
+    /* check the params */
+    if ((timestamp_ns == NULL) || (times == 0))
+    {
+        bmp180_interface_debug_print("bmp180: benchmark param is invalid.\n");
+        
+        return 1;
+    }
+    
+    /* init the simulated sensor */
+    (void)bmp180_simulator_init(NULL);
+    (void)bmp180_simulator_link(&gs_handle);
+    res = bmp180_init(&gs_handle);
+    if (res != 0)
+    {
+        bmp180_interface_debug_print("bmp180: init failed.\n");
+        
+        return 1;
+    }
+    (void)bmp180_info(&info);
+    bmp180_interface_debug_print("{\n");
+    bmp180_interface_debug_print("  \"driver\": \"%s\",\n", info.chip_name);
+    bmp180_interface_debug_print("  \"driver_version\": %d,\n", info.driver_version);
+    bmp180_interface_debug_print("  \"rounds\": %d,\n", times);
+    
+    /* compensation math */
+    bmp180_interface_debug_print("  \"compensation\": [\n");
+    separator = "";
+    for (mode = 0; mode < 4; mode++)
+    {
+        /* raw values around the usual operating range */
+        seed = 0x12345678U;
+        for (i = 0; i < BENCHMARK_BATCH_SIZE; i++)
+        {
+            seed = seed * 1664525U + 1013904223U;
+            gs_ut[i] = (uint16_t)(22000 + (seed >> 16) % 14000);
+            seed = seed * 1664525U + 1013904223U;
+            gs_up[i] = ((uint32_t)(25000 + (seed >> 16) % 20000) << mode) << (8 - mode);
+        }
+        
+        /* single sample reference */
+        start = timestamp_ns();
+        for (j = 0; j < times * BENCHMARK_BATCH_ROUNDS; j++)
+        {
+            for (i = 0; i < BENCHMARK_BATCH_SIZE; i++)
+            {
+                (void)bmp180_compensate(&gs_handle, (bmp180_mode_t)mode, gs_ut[i], gs_up[i], &gs_temperature[i], &gs_pa[i]);
+            }
+        }
+        ns = timestamp_ns() - start;
+        bmp180_interface_debug_print("%s    {\"mode\": \"%s\", \"oss\": %d, \"kernel\": \"single\", \"ns_per_sample\": %.3f}",
+                                     separator, gs_mode_name[mode], mode, 
+                                     (double)ns / ((double)times * BENCHMARK_BATCH_ROUNDS * BENCHMARK_BATCH_SIZE));
+        separator = ",\n";
+        
+        /* batch kernels */
+        for (kernel = 0; kernel < 5; kernel++)
+        {
+            (void)bmp180_batch_kernel_supported((bmp180_batch_kernel_t)kernel, &supported);
+            if (supported == BMP180_BOOL_FALSE)
+            {
+                continue;
+            }
+            start = timestamp_ns();
+            for (j = 0; j < times * BENCHMARK_BATCH_ROUNDS; j++)
+            {
+                (void)bmp180_batch_compensate_kernel(&gs_handle, (bmp180_batch_kernel_t)kernel, (bmp180_mode_t)mode,
+                                                     gs_ut, gs_up, gs_temperature, gs_pa, BENCHMARK_BATCH_SIZE);
+            }
+            ns = timestamp_ns() - start;
+            bmp180_interface_debug_print("%s    {\"mode\": \"%s\", \"oss\": %d, \"kernel\": \"%s\", \"ns_per_sample\": %.3f}",
+                                         separator, gs_mode_name[mode], mode, gs_kernel_name[kernel],
+                                         (double)ns / ((double)times * BENCHMARK_BATCH_ROUNDS * BENCHMARK_BATCH_SIZE));
+        }
+    }
+    bmp180_interface_debug_print("\n  ],\n");
+    
+    /* bus cost and end-to-end rate of every read api */
+    bmp180_interface_debug_print("  \"bus\": [\n");
+    separator = "";
+    (void)bmp180_simulator_set_bus_speed(BENCHMARK_BUS_HZ);
+    for (api = 0; api < 5; api++)
+    {
+        for (wait = 0; wait < 3; wait++)
+        {
+            for (burst = 0; burst < 2; burst++)
+            {
+                for (mode = 0; mode < 4; mode++)
+                {
+                    uint32_t read_count;
+                    uint32_t write_count;
+                    uint32_t bytes;
+                    uint64_t virtual_us;
+                    
+                    /* the split phase api waits by itself and burst only changes the status poll */
+                    if ((wait != 0) && ((api == BENCHMARK_API_SPLIT_PHASE) || (burst != 0)))
+                    {
+                        continue;
+                    }
+                    (void)bmp180_set_wait_mode(&gs_handle, (bmp180_wait_mode_t)wait);
+                    (void)bmp180_set_burst_read(&gs_handle, (bmp180_bool_t)burst);
+                    (void)bmp180_set_mode(&gs_handle, (bmp180_mode_t)mode);
+                    (void)bmp180_set_temperature_reuse(&gs_handle, (api == BENCHMARK_API_PRESSURE_REUSE) ? 10 : 0, 0);
+                    
+                    /* prime the temperature so every sample costs the same */
+                    if (a_benchmark_read(BENCHMARK_API_TEMPERATURE) != 0)
+                    {
+                        bmp180_interface_debug_print("bmp180: read failed.\n");
+                        (void)bmp180_deinit(&gs_handle);
+                        
+                        return 1;
+                    }
+                    samples = times * BENCHMARK_BUS_SAMPLES;
+                    (void)bmp180_simulator_clear_count();
+                    virtual_us = bmp180_simulator_timestamp_us();
+                    start = timestamp_ns();
+                    for (k = 0; k < samples; k++)
+                    {
+                        if (a_benchmark_read((uint8_t)api) != 0)
+                        {
+                            bmp180_interface_debug_print("bmp180: read failed.\n");
+                            (void)bmp180_deinit(&gs_handle);
+                            
+                            return 1;
+                        }
+                    }
+                    ns = timestamp_ns() - start;
+                    virtual_us = bmp180_simulator_timestamp_us() - virtual_us;
+                    (void)bmp180_simulator_get_count(&read_count, &write_count, &bytes);
+                    bmp180_interface_debug_print("%s    {\"api\": \"%s\", \"wait_mode\": \"%s\", \"burst\": %s, \"mode\": \"%s\", \"oss\": %d, ",
+                                                 separator, gs_api_name[api], gs_wait_name[wait], 
+                                                 (burst != 0) ? "true" : "false", gs_mode_name[mode], mode);
+                    bmp180_interface_debug_print("\"reads_per_sample\": %.3f, \"writes_per_sample\": %.3f, \"bytes_per_sample\": %.3f, ",
+                                                 (double)read_count / samples, (double)write_count / samples, 
+                                                 (double)bytes / samples);
+                    bmp180_interface_debug_print("\"bus_hz\": %d, \"samples_per_second\": %.3f, \"host_ns_per_sample\": %.1f}",
+                                                 BENCHMARK_BUS_HZ, (double)samples * 1000000.0 / (double)virtual_us, 
+                                                 (double)ns / samples);
+                    separator = ",\n";
+                }
+            }
+        }
+    }
+    bmp180_interface_debug_print("\n  ],\n");
+    
+    /* one day of samples per minute with a pressure tide, a drift and sensor noise */
+    {
+        const uint32_t resolution[3] = {1, 1000, 1000000};
+        bmp180_simulator_trajectory_t trajectory;
+        bmp180_sample_t sample;
+        bmp180_codec_t codec;
+        uint64_t decode_ns;
+        uint32_t len;
+        uint8_t met;
+        
+        trajectory.temperature = 215;
+        trajectory.temperature_slope = 1;
+        trajectory.pressure = 101325;
+        trajectory.pressure_slope = -15;
+        trajectory.pressure_amplitude = 120;
+        trajectory.pressure_period_ms = 12 * 3600 * 1000;
+        trajectory.pressure_noise = 2;
+        (void)bmp180_simulator_set_trajectory(&trajectory);
+        (void)bmp180_set_wait_mode(&gs_handle, BMP180_WAIT_MODE_POLL);
+        (void)bmp180_set_burst_read(&gs_handle, BMP180_BOOL_FALSE);
+        (void)bmp180_set_mode(&gs_handle, BMP180_MODE_STANDARD);
+        (void)bmp180_set_temperature_reuse(&gs_handle, 0, 0);
+        seed = 0x12345678U;
+        for (i = 0; i < BENCHMARK_CODEC_SAMPLES; i++)
+        {
+            /* the wake jitter of a periodic timer */
+            seed = seed * 1664525U + 1013904223U;
+            bmp180_simulator_delay_us(BENCHMARK_CODEC_PERIOD_MS * 1000 - 
+                                      (uint32_t)(bmp180_simulator_timestamp_us() % (BENCHMARK_CODEC_PERIOD_MS * 1000)) + 
+                                      (seed >> 16) % 200);
+            memset(&gs_sample[i], 0, sizeof(bmp180_sample_t));
+            gs_sample[i].timestamp_us = bmp180_simulator_timestamp_us();
+            gs_sample[i].sequence = i;
+            gs_sample[i].mode = BMP180_MODE_STANDARD;
+            if (bmp180_read_temperature_pressure_fixed(&gs_handle, &gs_sample[i].ut, &gs_sample[i].temperature,
+                                                       &gs_sample[i].up, &gs_sample[i].pa) != 0)
+            {
+                bmp180_interface_debug_print("bmp180: read failed.\n");
+                (void)bmp180_deinit(&gs_handle);
+                
+                return 1;
+            }
+        }
+        
+        /* encode and decode the day at every timestamp resolution */
+        bmp180_interface_debug_print("  \"codec\": [\n");
+        separator = "";
+        missed = 0;
+        for (k = 0; k < 3; k++)
+        {
+            start = timestamp_ns();
+            for (j = 0; j < times * BENCHMARK_CODEC_ROUNDS; j++)
+            {
+                (void)bmp180_codec_encoder_init(&codec, gs_chunk, sizeof(gs_chunk), resolution[k]);
+                for (i = 0; i < BENCHMARK_CODEC_SAMPLES; i++)
+                {
+                    (void)bmp180_codec_encode(&codec, &gs_sample[i]);
+                }
+                (void)bmp180_codec_encoder_finish(&codec, &len);
+            }
+            ns = timestamp_ns() - start;
+            start = timestamp_ns();
+            for (j = 0; j < times * BENCHMARK_CODEC_ROUNDS; j++)
+            {
+                (void)bmp180_codec_decoder_init(&codec, NULL, gs_chunk, len);
+                for (i = 0; i < BENCHMARK_CODEC_SAMPLES; i++)
+                {
+                    (void)bmp180_codec_decode(&codec, &sample);
+                }
+            }
+            decode_ns = timestamp_ns() - start;
+            
+            /* check the round trip */
+            (void)bmp180_codec_decoder_init(&codec, &gs_handle, gs_chunk, len);
+            for (i = 0; i < BENCHMARK_CODEC_SAMPLES; i++)
+            {
+                if ((bmp180_codec_decode(&codec, &sample) != 0) || (sample.up != gs_sample[i].up) || 
+                    (sample.ut != gs_sample[i].ut) || (sample.pa != gs_sample[i].pa) || 
+                    (sample.timestamp_us != gs_sample[i].timestamp_us / resolution[k] * resolution[k]))
+                {
+                    bmp180_interface_debug_print("bmp180: codec round trip failed.\n");
+                    (void)bmp180_deinit(&gs_handle);
+                    
+                    return 1;
+                }
+            }
+            bmp180_interface_debug_print("%s    {\"samples\": %d, \"period_ms\": %d, \"resolution_us\": %d, \"bytes\": %d, ",
+                                         separator, BENCHMARK_CODEC_SAMPLES, BENCHMARK_CODEC_PERIOD_MS, resolution[k], len);
+            bmp180_interface_debug_print("\"bits_per_sample\": %.2f, \"ratio_raw_record\": %.2f, \"ratio_sample\": %.2f, ",
+                                         (double)len * 8.0 / BENCHMARK_CODEC_SAMPLES, 
+                                         (double)BENCHMARK_CODEC_SAMPLES * BENCHMARK_RAW_RECORD_SIZE / len,
+                                         (double)BENCHMARK_CODEC_SAMPLES * sizeof(bmp180_sample_t) / len);
+            bmp180_interface_debug_print("\"encode_ns_per_sample\": %.2f, \"decode_ns_per_sample\": %.2f, ",
+                                         (double)ns / ((double)times * BENCHMARK_CODEC_ROUNDS * BENCHMARK_CODEC_SAMPLES),
+                                         (double)decode_ns / ((double)times * BENCHMARK_CODEC_ROUNDS * BENCHMARK_CODEC_SAMPLES));
+            
+            /* the target ratio assumes a ms or coarser resolution, the exact timestamps carry the wake jitter */
+            met = ((uint64_t)BENCHMARK_CODEC_SAMPLES * BENCHMARK_RAW_RECORD_SIZE >= 
+                   (uint64_t)BENCHMARK_CODEC_TARGET_RATIO * len) ? 1 : 0;
+            if ((met == 0) && (resolution[k] >= BENCHMARK_CODEC_TARGET_US))
+            {
+                missed = 1;
+            }
+            bmp180_interface_debug_print("\"target_ratio\": %d, \"target_held\": %s, \"target_met\": %s}",
+                                         BENCHMARK_CODEC_TARGET_RATIO, 
+                                         (resolution[k] >= BENCHMARK_CODEC_TARGET_US) ? "true" : "false",
+                                         (met != 0) ? "true" : "false");
+            separator = ",\n";
+        }
+        bmp180_interface_debug_print("\n  ]\n");
+    }
+    bmp180_interface_debug_print("}\n");
+    (void)bmp180_deinit(&gs_handle);
+    
+    /* a ms or coarser resolution that misses the target fails the benchmark */
+    if (missed != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
@@ -0,0 +1,529 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_bmp180_concurrency_test.c
+ * @brief     driver bmp180 concurrency test source file
+ * @version   2.1.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>2.1      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_bmp180_concurrency_test.h"
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+
+/**
+ * @brief concurrency test definition
+ */
+#define CONCURRENCY_RING_CAPACITY        16            /**< ring capacity, small enough to overflow */
+#define CONCURRENCY_RING_BATCH           5             /**< samples of one drain */
+#define CONCURRENCY_RING_SAMPLES         100000        /**< pushed samples of one round */
+#define CONCURRENCY_SHARED_THREADS       4             /**< threads reading one shared handle */
+#define CONCURRENCY_SHARED_READS         2000          /**< reads of one thread */
+#define CONCURRENCY_SHARED_TIMEOUT_MS    30000         /**< time limit of one round */
+
+/**
+ * @brief concurrency ring job structure definition
+ */
+typedef struct concurrency_ring_job_s
+{
+    bmp180_ring_t ring;                                      /**< ring under test */
+    bmp180_sample_t buf[CONCURRENCY_RING_CAPACITY];          /**< ring samples */
+    uint32_t samples;                                        /**< samples to push */
+    uint32_t rejected;                                       /**< pushes that dropped the new sample */
+    uint32_t overwritten;                                    /**< pushes that dropped the oldest sample */
+    uint32_t failed;                                         /**< pushes with another status code */
+    uint8_t done;                                            /**< producer done flag */
+} concurrency_ring_job_t;
+
+/**
+ * @brief concurrency shared job structure definition
+ */
+typedef struct concurrency_shared_job_s
+{
+    bmp180_shared_t *shared;        /**< shared handle under test */
+    uint32_t max_age_us;            /**< max age of a cached sample */
+    uint32_t reads;                 /**< reads to run */
+    uint32_t failed;                /**< failed reads */
+    uint8_t done;                   /**< reader done flag */
+} concurrency_shared_job_t;
+
+static const char *const gs_policy_name[2] = {"drop_newest", "drop_oldest"};
+
+/**
+ * @brief      make the sample of a sequence number
+ * @param[in]  sequence sample sequence number
+ * @param[out] *sample pointer to a sample buffer
+ * @note       every field depends on the sequence number, so a torn copy is found
+ */
+static void a_concurrency_sample(uint32_t sequence, bmp180_sample_t *sample)
+{
+    sample->timestamp_us = (uint64_t)sequence * 1000 + 7;
+    sample->sequence = sequence;
+    sample->up = sequence * 2654435761U;
+    sample->temperature = (int32_t)(sequence ^ 0x5A5A5A5AU);
+    sample->pa = ~sequence;
+    sample->ut = (uint16_t)(sequence >> 3);
+    sample->mode = (uint8_t)(sequence & 0x03);
+    sample->sensor = (uint8_t)(sequence >> 24);
+}
+
+/**
+ * @brief     check a sample against its sequence number
+ * @param[in] *sample pointer to a sample
+ * @return    check result
+ *            - 0 whole
+ *            - 1 torn
+ * @note      the fields are compared one by one, the padding is undefined
+ */
+static uint8_t a_concurrency_check(const bmp180_sample_t *sample)
+{
+    bmp180_sample_t expect;
+    
+    a_concurrency_sample(sample->sequence, &expect);
+    if ((sample->timestamp_us != expect.timestamp_us) || (sample->up != expect.up) || 
+        (sample->temperature != expect.temperature) || (sample->pa != expect.pa) || 
+        (sample->ut != expect.ut) || (sample->mode != expect.mode) || (sample->sensor != expect.sensor))
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     ring producer
+ * @param[in] *arg pointer to a concurrency ring job structure
+ * @return    NULL
+ * @note      it never waits for the consumer
+ */
+static void *a_concurrency_ring_producer(void *arg)
+{
+    concurrency_ring_job_t *job = (concurrency_ring_job_t *)arg;
+    bmp180_sample_t sample;
+    uint32_t i;
+    uint8_t res;
+    
+    for (i = 0; i < job->samples; i++)
+    {
+        a_concurrency_sample(i, &sample);
+        res = bmp180_ring_push(&job->ring, &sample);
+        if (res == 4)
+        {
+            job->rejected++;
+        }
+        else if (res == 5)
+        {
+            job->overwritten++;
+        }
+        else if (res != 0)
+        {
+            job->failed++;
+        }
+        else
+        {
+            /* published */
+        }
+        
+        /* let the consumer catch up now and then, so the ring runs both full and empty */
+        if ((i % 1024) == 0)
+        {
+            (void)sched_yield();
+        }
+    }
+    __atomic_store_n(&job->done, 1, __ATOMIC_RELEASE);
+    
+    return NULL;
+}
+
+/**
+ * @brief     run one producer and consumer round
+ * @param[in] policy overflow policy
+ * @param[in] samples samples to push
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      none
+ */
+static uint8_t a_concurrency_ring(bmp180_ring_policy_t policy, uint32_t samples)
+{
+    static concurrency_ring_job_t job;
+    bmp180_sample_t sample[CONCURRENCY_RING_BATCH];
+    pthread_t thread;
+    uint32_t published;
+    uint32_t dropped;
+    uint32_t received;
+    uint32_t torn;
+    uint32_t disorder;
+    uint32_t count;
+    uint32_t last;
+    uint32_t drains;
+    uint32_t i;
+    uint8_t done;
+    uint8_t res;
+    
+    memset(&job, 0, sizeof(concurrency_ring_job_t));
+    job.samples = samples;
+    if (bmp180_ring_init(&job.ring, job.buf, CONCURRENCY_RING_CAPACITY, policy) != 0)
+    {
+        bmp180_interface_debug_print("bmp180: ring init failed.\n");
+        
+        return 1;
+    }
+    if (pthread_create(&thread, NULL, a_concurrency_ring_producer, &job) != 0)
+    {
+        bmp180_interface_debug_print("bmp180: create thread failed.\n");
+        
+        return 1;
+    }
+    
+    /* drain until the producer is done and the ring is empty */
+    received = 0;
+    torn = 0;
+    disorder = 0;
+    drains = 0;
+    last = 0;
+    while (1)
+    {
+        done = __atomic_load_n(&job.done, __ATOMIC_ACQUIRE);
+        res = bmp180_ring_pop(&job.ring, sample, CONCURRENCY_RING_BATCH, &count);
+        if (res != 0)
+        {
+            break;
+        }
+        for (i = 0; i < count; i++)
+        {
+            torn += a_concurrency_check(&sample[i]);
+            if ((received + i != 0) && (sample[i].sequence <= last))
+            {
+                disorder++;
+            }
+            last = sample[i].sequence;
+        }
+        received += count;
+        if ((count == 0) && (done != 0))
+        {
+            break;
+        }
+        
+        /* fall behind now and then, so the ring overflows */
+        if ((++drains % 256) == 0)
+        {
+            (void)sched_yield();
+        }
+    }
+    (void)pthread_join(thread, NULL);
+    (void)bmp180_ring_get_counter(&job.ring, &published, &dropped);
+    bmp180_interface_debug_print("bmp180: %s %d pushed %d published %d dropped %d received.\n",
+                                 gs_policy_name[policy], samples, published, dropped, received);
+    
+    /* drop newest publishes the accepted samples, drop oldest publishes all and loses the overwritten ones */
+    if ((res != 0) || (job.failed != 0) || (torn != 0) || (disorder != 0))
+    {
+        bmp180_interface_debug_print("bmp180: %d torn samples %d samples out of order.\n", torn, disorder);
+        
+        return 1;
+    }
+    if (policy == BMP180_RING_POLICY_DROP_NEWEST)
+    {
+        if ((published + dropped != samples) || (dropped != job.rejected) || 
+            (received != published) || (job.overwritten != 0))
+        {
+            bmp180_interface_debug_print("bmp180: ring counters don't add up.\n");
+            
+            return 1;
+        }
+    }
+    else
+    {
+        if ((published != samples) || (dropped != job.overwritten) || 
+            (received + dropped != published) || (job.rejected != 0))
+        {
+            bmp180_interface_debug_print("bmp180: ring counters don't add up.\n");
+            
+            return 1;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  get the monotonic time of the shared handle
+ * @return monotonic time in us
+ * @note   every reader thread calls it
+ */
+static uint64_t a_concurrency_timestamp_us(void)
+{
+    struct timespec ts;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)ts.tv_nsec / 1000;
+}
+
+/**
+ * @brief     wait for the owner of the shared handle
+ * @param[in] us time in us
+ * @note      the simulated conversion takes no real time, so a yield is enough and the readers race harder
+ */
+static void a_concurrency_delay_us(uint32_t us)
+{
+    (void)us;
+    (void)sched_yield();
+}
+
+/**
+ * @brief     conversion delay of the shared handle owner
+ * @param[in] ms time in ms
+ * @note      the simulator clock jumps and the owner yields, so the other readers arrive during the conversion
+ */
+static void a_concurrency_delay_ms(uint32_t ms)
+{
+    bmp180_simulator_delay_ms(ms);
+    (void)sched_yield();
+}
+
+/**
+ * @brief     shared handle reader
+ * @param[in] *arg pointer to a concurrency shared job structure
+ * @return    NULL
+ * @note      none
+ */
+static void *a_concurrency_shared_reader(void *arg)
+{
+    concurrency_shared_job_t *job = (concurrency_shared_job_t *)arg;
+    bmp180_sample_t sample;
+    uint32_t i;
+    
+    for (i = 0; i < job->reads; i++)
+    {
+        if ((bmp180_shared_read(job->shared, job->max_age_us, &sample) != 0) || 
+            (sample.pa < 90000) || (sample.pa > 110000))
+        {
+            job->failed++;
+        }
+    }
+    __atomic_store_n(&job->done, 1, __ATOMIC_RELEASE);
+    
+    return NULL;
+}
+
+/**
+ * @brief     wait for the shared handle readers
+ * @param[in] *job pointer to a concurrency shared job array
+ * @param[in] *thread pointer to a reader thread array
+ * @param[in] count reader count
+ * @return    status code
+ *            - 0 success
+ *            - 1 a reader hangs
+ * @note      a reader that misses the released bus never returns, so the wait has a time limit
+ */
+static uint8_t a_concurrency_shared_join(concurrency_shared_job_t *job, pthread_t *thread, uint32_t count)
+{
+    struct timespec ts = {0, 1000000};
+    uint32_t done;
+    uint32_t ms;
+    uint32_t i;
+    
+    for (ms = 0; ms < CONCURRENCY_SHARED_TIMEOUT_MS; ms++)
+    {
+        done = 0;
+        for (i = 0; i < count; i++)
+        {
+            done += __atomic_load_n(&job[i].done, __ATOMIC_ACQUIRE);
+        }
+        if (done == count)
+        {
+            break;
+        }
+        (void)nanosleep(&ts, NULL);
+    }
+    if (ms == CONCURRENCY_SHARED_TIMEOUT_MS)
+    {
+        return 1;
+    }
+    for (i = 0; i < count; i++)
+    {
+        (void)pthread_join(thread[i], NULL);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  run one round of readers on a shared handle
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   a reader first meets a bus that is released after the result is published,
+ *         then half of the readers never accept a cached sample, so the bus is released and taken again all the time
+ */
+static uint8_t a_concurrency_shared(void)
+{
+    static concurrency_shared_job_t job[CONCURRENCY_SHARED_THREADS];
+    static bmp180_handle_t handle;
+    static bmp180_shared_t shared;
+    struct timespec ts = {0, 10000000};
+    pthread_t thread[CONCURRENCY_SHARED_THREADS];
+    bmp180_sample_t sample;
+    uint32_t conversions;
+    uint32_t joined;
+    uint32_t hits;
+    uint32_t failed;
+    uint32_t i;
+    
+    (void)bmp180_simulator_init(NULL);
+    (void)bmp180_simulator_link(&handle);
+    DRIVER_BMP180_LINK_DELAY_MS(&handle, a_concurrency_delay_ms);
+    if (bmp180_init(&handle) != 0)
+    {
+        bmp180_interface_debug_print("bmp180: init failed.\n");
+        
+        return 1;
+    }
+    if (bmp180_shared_init(&shared, &handle, a_concurrency_timestamp_us, a_concurrency_delay_us) != 0)
+    {
+        bmp180_interface_debug_print("bmp180: shared init failed.\n");
+        (void)bmp180_deinit(&handle);
+        
+        return 1;
+    }
+    
+    /* a reader that comes after the owner published its result but before it released the bus */
+    failed = bmp180_shared_read(&shared, 0, &sample);
+    __atomic_store_n(&shared.owner, 1, __ATOMIC_RELEASE);
+    memset(&job[0], 0, sizeof(concurrency_shared_job_t));
+    job[0].shared = &shared;
+    job[0].reads = 1;
+    if (pthread_create(&thread[0], NULL, a_concurrency_shared_reader, &job[0]) != 0)
+    {
+        bmp180_interface_debug_print("bmp180: create thread failed.\n");
+        
+        return 1;
+    }
+    (void)nanosleep(&ts, NULL);
+    __atomic_store_n(&shared.owner, 0, __ATOMIC_RELEASE);
+    if (a_concurrency_shared_join(job, thread, 1) != 0)
+    {
+        bmp180_interface_debug_print("bmp180: shared read hangs after the bus is released.\n");
+        
+        return 1;
+    }
+    failed += job[0].failed;
+    
+    /* many readers, half of them never accept a cached sample */
+    for (i = 0; i < CONCURRENCY_SHARED_THREADS; i++)
+    {
+        memset(&job[i], 0, sizeof(concurrency_shared_job_t));
+        job[i].shared = &shared;
+        job[i].max_age_us = ((i % 2) == 0) ? 0 : 50;
+        job[i].reads = CONCURRENCY_SHARED_READS;
+        if (pthread_create(&thread[i], NULL, a_concurrency_shared_reader, &job[i]) != 0)
+        {
+            bmp180_interface_debug_print("bmp180: create thread failed.\n");
+            
+            return 1;
+        }
+    }
+    if (a_concurrency_shared_join(job, thread, CONCURRENCY_SHARED_THREADS) != 0)
+    {
+        bmp180_interface_debug_print("bmp180: shared read hangs.\n");
+        
+        return 1;
+    }
+    for (i = 0; i < CONCURRENCY_SHARED_THREADS; i++)
+    {
+        failed += job[i].failed;
+    }
+    (void)bmp180_shared_get_counter(&shared, &conversions, &joined, &hits);
+    (void)bmp180_deinit(&handle);
+    bmp180_interface_debug_print("bmp180: %d reads %d conversions %d joined %d cached.\n",
+                                 CONCURRENCY_SHARED_THREADS * CONCURRENCY_SHARED_READS + 2, conversions, joined, hits);
+    
+    /* every read is either a conversion, a joined conversion or a cached sample */
+    if ((failed != 0) || (conversions + joined + hits != CONCURRENCY_SHARED_THREADS * CONCURRENCY_SHARED_READS + 2))
+    {
+        bmp180_interface_debug_print("bmp180: %d reads failed, shared counters don't add up.\n", failed);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     concurrency test
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      a producer thread pushes times * 100000 samples through a small ring of each overflow policy
+ *            while the consumer drains it, the samples must come out whole and in order and the counters
+ *            must add up, then 4 threads read one shared handle on the simulator times * 2000 times each,
+ *            it needs posix threads and no hardware
+ */
+uint8_t bmp180_concurrency_test(uint32_t times)
+{
+    uint32_t i;
+    
+    /* start concurrency test */
+    bmp180_interface_debug_print("bmp180: start concurrency test.\n");
+    
+    /* spsc ring with both overflow policies */
+    bmp180_interface_debug_print("bmp180: ring producer and consumer.\n");
+    for (i = 0; i < times; i++)
+    {
+        if ((a_concurrency_ring(BMP180_RING_POLICY_DROP_NEWEST, CONCURRENCY_RING_SAMPLES) != 0) ||
+            (a_concurrency_ring(BMP180_RING_POLICY_DROP_OLDEST, CONCURRENCY_RING_SAMPLES) != 0))
+        {
+            bmp180_interface_debug_print("bmp180: concurrency test failed.\n");
+            
+            return 1;
+        }
+    }
+    
+    /* readers of one shared handle */
+    bmp180_interface_debug_print("bmp180: shared handle readers.\n");
+    for (i = 0; i < times; i++)
+    {
+        if (a_concurrency_shared() != 0)
+        {
+            bmp180_interface_debug_print("bmp180: concurrency test failed.\n");
+            
+            return 1;
+        }
+    }
+    
+    /* finish concurrency test */
+    bmp180_interface_debug_print("bmp180: finish concurrency test.\n");
+    
+    return 0;
+}
@@ -0,0 +1,508 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_bmp180_equivalence_test.c
+ * @brief     driver bmp180 equivalence test source file
+ * @version   2.1.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>2.1      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_bmp180_equivalence_test.h"
+#include <pthread.h>
+
+/**
+ * @brief equivalence test definition
+ */
+#define EQUIVALENCE_MAX_THREADS        64          /**< max worker thread count */
+#define EQUIVALENCE_UP_POINTS          4096        /**< raw pressure grid points of every raw temperature */
+#define EQUIVALENCE_UT_BLOCK           64          /**< raw temperatures of one work item */
+#define EQUIVALENCE_KERNELS            6           /**< single sample api and 5 batch kernels */
+
+/**
+ * @brief equivalence calibration structure definition
+ */
+typedef struct equivalence_calibration_s
+{
+    const char *name;        /**< calibration name */
+    int16_t ac1;             /**< ac1 */
+    int16_t ac2;             /**< ac2 */
+    int16_t ac3;             /**< ac3 */
+    uint16_t ac4;            /**< ac4 */
+    uint16_t ac5;            /**< ac5 */
+    uint16_t ac6;            /**< ac6 */
+    int16_t b1;              /**< b1 */
+    int16_t b2;              /**< b2 */
+    int16_t mb;              /**< mb */
+    int16_t mc;              /**< mc */
+    int16_t md;              /**< md */
+} equivalence_calibration_t;
+
+/**
+ * @brief equivalence mismatch structure definition
+ */
+typedef struct equivalence_mismatch_s
+{
+    uint8_t found;                  /**< found flag */
+    uint8_t kernel;                 /**< kernel index */
+    uint8_t res;                    /**< kernel status code */
+    uint8_t expect;                 /**< reference status code */
+    uint16_t ut;                    /**< raw temperature */
+    uint32_t up;                    /**< raw pressure */
+    int32_t temperature;            /**< reference temperature */
+    uint32_t pa;                    /**< reference pressure */
+    int32_t got_temperature;        /**< kernel temperature */
+    uint32_t got_pa;                /**< kernel pressure */
+} equivalence_mismatch_t;
+
+/**
+ * @brief equivalence job structure definition
+ */
+typedef struct equivalence_job_s
+{
+    bmp180_handle_t handle;                          /**< handle with the calibration under test */
+    bmp180_mode_t mode;                              /**< mode under test */
+    uint8_t enable[EQUIVALENCE_KERNELS];             /**< kernel enable flags */
+    uint32_t next;                                   /**< next raw temperature block */
+    uint64_t samples;                                /**< compared samples of every kernel */
+    uint64_t invalid;                                /**< samples the reference can't compensate */
+    uint64_t mismatch[EQUIVALENCE_KERNELS];          /**< mismatch counter of every kernel */
+    equivalence_mismatch_t first;                    /**< first mismatch */
+    pthread_mutex_t mutex;                           /**< first mismatch mutex */
+} equivalence_job_t;
+
+/**
+ * @brief real calibration sets and synthetic corner cases
+ */
+static const equivalence_calibration_t gs_calibration[] =
+{
+    {"datasheet",  408,    -72,    -14383, 32741, 32757, 23153, 6190,   4,      -32768, -8711,  2868},
+    {"sensor",     7803,   -1070,  -14494, 33930, 25198, 16735, 6515,   41,     -32768, -11786, 2858},
+    {"typical",    8240,   -1196,  -14709, 32912, 24959, 16487, 6515,   48,     -32768, -11786, 2433},
+    {"max",        32767,  32767,  32767,  65535, 65535, 65535, 32767,  32767,  32767,  32767,  32767},
+    {"min",        -32768, -32768, -32768, 1,     1,     0,     -32768, -32768, -32768, -32768, -32768},
+    {"divisor",    408,    -72,    -14383, 1,     32757, 23153, 6190,   4,      -32768, -8711,  -4000},
+};
+static const char *const gs_mode_name[4] = {"ultra_low", "standard", "high", "ultra_high"};
+static const char *const gs_kernel_name[EQUIVALENCE_KERNELS] = {"single", "auto", "scalar", "sse41", "avx2", "neon"};
+
+/**
+ * @brief     wrapping 32 bit multiplication
+ * @param[in] a multiplicand
+ * @param[in] b multiplier
+ * @return    two's complement product
+ * @note      none
+ */
+static int32_t a_equivalence_mul(int32_t a, int32_t b)
+{
+    return (int32_t)((uint32_t)a * (uint32_t)b);
+}
+
+/**
+ * @brief     wrapping 32 bit addition
+ * @param[in] a augend
+ * @param[in] b addend
+ * @return    two's complement sum
+ * @note      none
+ */
+static int32_t a_equivalence_add(int32_t a, int32_t b)
+{
+    return (int32_t)((uint32_t)a + (uint32_t)b);
+}
+
+/**
+ * @brief      reference compensation
+ * @param[in]  *handle pointer to a bmp180 handle structure
+ * @param[in]  oss oversampling setting
+ * @param[in]  ut raw temperature
+ * @param[in]  up raw pressure register value
+ * @param[out] *temperature pointer to a temperature buffer in 0.1 degrees celsius
+ * @param[out] *pa pointer to a pressure buffer
+ * @return     valid flag
+ * @note       a line by line copy of the integer datasheet algorithm of driver 2.0.0 with every
+ *             intermediate wrapped to 32 bits, a zero divisor marks the sample invalid
+ */
+static uint8_t a_equivalence_reference(bmp180_handle_t *handle, uint8_t oss, uint16_t ut, uint32_t up,
+                                       int32_t *temperature, uint32_t *pa)
+{
+    int32_t x1, x2, x3, b3, b5, b6, p, div, raw;
+    uint32_t b4, b7;
+    
+    /* same mask as driver 2.0.0 */
+    raw = (int32_t)(up >> (8 - oss));
+    raw = raw & (int32_t)(0x0007FFFFU >> (3 - oss));
+    
+    /* temperature */
+    x1 = a_equivalence_mul((int32_t)ut - (int32_t)handle->ac6, (int32_t)handle->ac5) >> 15;
+    div = a_equivalence_add(x1, (int32_t)handle->md);
+    if (div == 0)
+    {
+        return 0;
+    }
+    x2 = a_equivalence_mul((int32_t)handle->mc, 2048) / div;
+    b5 = a_equivalence_add(x1, x2);
+    
+    /* pressure */
+    b6 = a_equivalence_add(b5, -4000);
+    x1 = a_equivalence_mul((int32_t)handle->b2, a_equivalence_mul(b6, b6) >> 12) >> 11;
+    x2 = a_equivalence_mul((int32_t)handle->ac2, b6) >> 11;
+    x3 = a_equivalence_add(x1, x2);
+    b3 = a_equivalence_add(a_equivalence_mul(a_equivalence_add(a_equivalence_mul((int32_t)handle->ac1, 4), x3), 
+                                             (int32_t)(1U << oss)), 2) >> 2;
+    x1 = a_equivalence_mul((int32_t)handle->ac3, b6) >> 13;
+    x2 = a_equivalence_mul((int32_t)handle->b1, a_equivalence_mul(b6, b6) >> 12) >> 16;
+    x3 = a_equivalence_add(a_equivalence_add(x1, x2), 2) >> 2;
+    b4 = ((uint32_t)handle->ac4 * (uint32_t)a_equivalence_add(x3, 32768)) >> 15;
+    if (b4 == 0)
+    {
+        return 0;
+    }
+    b7 = (uint32_t)a_equivalence_add(raw, -b3) * (uint32_t)(50000 >> oss);
+    if (b7 < 0x80000000U)
+    {
+        p = (int32_t)((b7 << 1) / b4);
+    }
+    else
+    {
+        p = (int32_t)((b7 / b4) << 1);
+    }
+    x1 = a_equivalence_mul(p >> 8, p >> 8);
+    x1 = a_equivalence_mul(x1, 3038) >> 16;
+    x2 = a_equivalence_mul(-7357, p) >> 16;
+    *pa = (uint32_t)a_equivalence_add(p, a_equivalence_add(a_equivalence_add(x1, x2), 3791) >> 4);
+    *temperature = a_equivalence_add(b5, 8) >> 4;
+    
+    return 1;
+}
+
+/**
+ * @brief     record a mismatch
+ * @param[in] *job pointer to an equivalence job structure
+ * @param[in] *mismatch pointer to a mismatch structure
+ * @note      only the first mismatch is kept
+ */
+static void a_equivalence_record(equivalence_job_t *job, const equivalence_mismatch_t *mismatch)
+{
+    __atomic_fetch_add(&job->mismatch[mismatch->kernel], 1, __ATOMIC_RELAXED);
+    (void)pthread_mutex_lock(&job->mutex);
+    if (job->first.found == 0)
+    {
+        job->first = *mismatch;
+        job->first.found = 1;
+    }
+    (void)pthread_mutex_unlock(&job->mutex);
+}
+
+/**
+ * @brief     equivalence worker
+ * @param[in] *arg pointer to an equivalence job structure
+ * @return    NULL
+ * @note      it takes raw temperature blocks until the whole range is done
+ */
+static void *a_equivalence_worker(void *arg)
+{
+    equivalence_job_t *job = (equivalence_job_t *)arg;
+    bmp180_handle_t handle;
+    equivalence_mismatch_t mismatch;
+    uint16_t ut[EQUIVALENCE_UP_POINTS];
+    uint32_t up[EQUIVALENCE_UP_POINTS];
+    uint8_t valid[EQUIVALENCE_UP_POINTS];
+    int32_t temperature[EQUIVALENCE_UP_POINTS];
+    uint32_t pa[EQUIVALENCE_UP_POINTS];
+    int32_t got_temperature[EQUIVALENCE_UP_POINTS];
+    uint32_t got_pa[EQUIVALENCE_UP_POINTS];
+    uint8_t oss = (uint8_t)job->mode;
+    uint32_t step = (0x10000U << oss) / EQUIVALENCE_UP_POINTS;
+    uint32_t invalid = 0;
+    uint32_t block;
+    uint32_t t;
+    uint32_t i;
+    uint32_t k;
+    
+    /* every thread works on its own copy of the calibration */
+    handle = job->handle;
+    while (1)
+    {
+        block = __atomic_fetch_add(&job->next, 1, __ATOMIC_RELAXED);
+        if (block >= (0x10000U / EQUIVALENCE_UT_BLOCK))
+        {
+            break;
+        }
+        for (t = block * EQUIVALENCE_UT_BLOCK; t < (block + 1) * EQUIVALENCE_UT_BLOCK; t++)
+        {
+            uint32_t len;
+            uint8_t res;
+            uint8_t expect;
+            
+            /* the grid offset walks with ut, so all raw temperatures together cover every raw pressure, */
+            /* the unused low register bits are filled to check the mask */
+            for (i = 0; i < EQUIVALENCE_UP_POINTS; i++)
+            {
+                ut[i] = (uint16_t)t;
+                up[i] = ((i * step + t % step) << (8 - oss)) | (t & (0xFFU >> oss));
+                temperature[i] = 0;
+                pa[i] = 0;
+                valid[i] = a_equivalence_reference(&handle, oss, ut[i], up[i], &temperature[i], &pa[i]);
+                invalid += (valid[i] == 0) ? 1 : 0;
+            }
+            
+            /* single sample api */
+            for (i = 0; i < EQUIVALENCE_UP_POINTS; i++)
+            {
+                got_temperature[i] = 0;
+                got_pa[i] = 0;
+                res = bmp180_compensate(&handle, job->mode, ut[i], up[i], &got_temperature[i], &got_pa[i]);
+                if ((res != ((valid[i] != 0) ? 0 : 4)) || 
+                    ((valid[i] != 0) && ((got_temperature[i] != temperature[i]) || (got_pa[i] != pa[i]))))
+                {
+                    mismatch.kernel = 0;
+                    mismatch.res = res;
+                    mismatch.expect = (valid[i] != 0) ? 0 : 4;
+                    mismatch.ut = ut[i];
+                    mismatch.up = up[i];
+                    mismatch.temperature = temperature[i];
+                    mismatch.pa = pa[i];
+                    mismatch.got_temperature = got_temperature[i];
+                    mismatch.got_pa = got_pa[i];
+                    a_equivalence_record(job, &mismatch);
+                }
+            }
+            
+            /* batch kernels must give 0 for the invalid samples, */
+            /* the batch is split at a moving point to cover unaligned heads and tails */
+            for (k = 1; k < EQUIVALENCE_KERNELS; k++)
+            {
+                uint32_t start;
+                
+                if (job->enable[k] == 0)
+                {
+                    continue;
+                }
+                for (i = 0; i < EQUIVALENCE_UP_POINTS; i++)
+                {
+                    got_temperature[i] = 0x5A5A5A5A;
+                    got_pa[i] = 0x5A5A5A5AU;
+                }
+                len = 1 + t % 37;
+                for (start = 0; start < EQUIVALENCE_UP_POINTS; start += len)
+                {
+                    if (start != 0)
+                    {
+                        len = EQUIVALENCE_UP_POINTS - start;
+                    }
+                    expect = 0;
+                    for (i = start; i < start + len; i++)
+                    {
+                        if (valid[i] == 0)
+                        {
+                            expect = 4;
+                        }
+                    }
+                    res = bmp180_batch_compensate_kernel(&handle, (bmp180_batch_kernel_t)(k - 1), job->mode,
+                                                         &ut[start], &up[start], &got_temperature[start], &got_pa[start], len);
+                    if (res != expect)
+                    {
+                        mismatch.kernel = (uint8_t)k;
+                        mismatch.res = res;
+                        mismatch.expect = expect;
+                        mismatch.ut = ut[start];
+                        mismatch.up = up[start];
+                        mismatch.temperature = temperature[start];
+                        mismatch.pa = pa[start];
+                        mismatch.got_temperature = got_temperature[start];
+                        mismatch.got_pa = got_pa[start];
+                        a_equivalence_record(job, &mismatch);
+                    }
+                }
+                for (i = 0; i < EQUIVALENCE_UP_POINTS; i++)
+                {
+                    if ((got_temperature[i] != temperature[i]) || (got_pa[i] != pa[i]))
+                    {
+                        mismatch.kernel = (uint8_t)k;
+                        mismatch.res = 0;
+                        mismatch.expect = 0;
+                        mismatch.ut = ut[i];
+                        mismatch.up = up[i];
+                        mismatch.temperature = temperature[i];
+                        mismatch.pa = pa[i];
+                        mismatch.got_temperature = got_temperature[i];
+                        mismatch.got_pa = got_pa[i];
+                        a_equivalence_record(job, &mismatch);
+                    }
+                }
+            }
+        }
+        __atomic_fetch_add(&job->samples, (uint64_t)EQUIVALENCE_UT_BLOCK * EQUIVALENCE_UP_POINTS, __ATOMIC_RELAXED);
+    }
+    __atomic_fetch_add(&job->invalid, invalid, __ATOMIC_RELAXED);
+    
+    return NULL;
+}
+
+/**
+ * @brief     equivalence test
+ * @param[in] threads worker thread count
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      it compares bmp180_compensate and every supported batch kernel with an independent copy of
+ *            the integer datasheet algorithm, every raw temperature is checked against a 4096 point raw pressure
+ *            grid of each mode and calibration set, it needs posix threads and no hardware
+ */
+uint8_t bmp180_equivalence_test(uint32_t threads)
+{
+    static equivalence_job_t job;
+    pthread_t thread[EQUIVALENCE_MAX_THREADS];
+    bmp180_bool_t supported;
+    bmp180_batch_kernel_t kernel;
+    uint64_t total = 0;
+    uint32_t failed = 0;
+    uint32_t started;
+    uint32_t c;
+    uint32_t m;
+    uint32_t i;
+    uint32_t k;
+    
+    /* check the params */
+    if ((threads == 0) || (threads > EQUIVALENCE_MAX_THREADS))
+    {
+        bmp180_interface_debug_print("bmp180: thread count is invalid.\n");
+        
+        return 1;
+    }
+    
+    /* start equivalence test */
+    bmp180_interface_debug_print("bmp180: start equivalence test.\n");
+    bmp180_interface_debug_print("bmp180: %d threads, %d raw pressure points per raw temperature.\n", 
+                                 threads, EQUIVALENCE_UP_POINTS);
+    job.enable[0] = 1;
+    for (k = 1; k < EQUIVALENCE_KERNELS; k++)
+    {
+        (void)bmp180_batch_kernel_supported((bmp180_batch_kernel_t)(k - 1), &supported);
+        job.enable[k] = (supported == BMP180_BOOL_TRUE) ? 1 : 0;
+        bmp180_interface_debug_print("bmp180: kernel %s is %s.\n", gs_kernel_name[k], 
+                                     (job.enable[k] != 0) ? "checked" : "not supported");
+    }
+    (void)bmp180_batch_get_kernel(&kernel);
+    bmp180_interface_debug_print("bmp180: kernel auto selects %s.\n", gs_kernel_name[(uint32_t)kernel + 1]);
+    
+    for (c = 0; c < sizeof(gs_calibration) / sizeof(gs_calibration[0]); c++)
+    {
+        for (m = 0; m < 4; m++)
+        {
+            /* set the calibration of the job */
+            memset(&job.handle, 0, sizeof(bmp180_handle_t));
+            job.handle.ac1 = gs_calibration[c].ac1;
+            job.handle.ac2 = gs_calibration[c].ac2;
+            job.handle.ac3 = gs_calibration[c].ac3;
+            job.handle.ac4 = gs_calibration[c].ac4;
+            job.handle.ac5 = gs_calibration[c].ac5;
+            job.handle.ac6 = gs_calibration[c].ac6;
+            job.handle.b1 = gs_calibration[c].b1;
+            job.handle.b2 = gs_calibration[c].b2;
+            job.handle.mb = gs_calibration[c].mb;
+            job.handle.mc = gs_calibration[c].mc;
+            job.handle.md = gs_calibration[c].md;
+            job.mode = (bmp180_mode_t)m;
+            job.next = 0;
+            job.samples = 0;
+            job.invalid = 0;
+            memset(job.mismatch, 0, sizeof(job.mismatch));
+            memset(&job.first, 0, sizeof(equivalence_mismatch_t));
+            (void)pthread_mutex_init(&job.mutex, NULL);
+            
+            /* spread the raw temperature range over the threads */
+            for (started = 0; started < threads; started++)
+            {
+                if (pthread_create(&thread[started], NULL, a_equivalence_worker, &job) != 0)
+                {
+                    break;
+                }
+            }
+            if (started == 0)
+            {
+                bmp180_interface_debug_print("bmp180: create thread failed.\n");
+                (void)pthread_mutex_destroy(&job.mutex);
+                
+                return 1;
+            }
+            for (i = 0; i < started; i++)
+            {
+                (void)pthread_join(thread[i], NULL);
+            }
+            (void)pthread_mutex_destroy(&job.mutex);
+            total += job.samples;
+            
+            /* output the result */
+            for (k = 0; k < EQUIVALENCE_KERNELS; k++)
+            {
+                if (job.enable[k] == 0)
+                {
+                    continue;
+                }
+                if (job.mismatch[k] != 0)
+                {
+                    failed++;
+                }
+            }
+            bmp180_interface_debug_print("bmp180: calibration %s mode %s %llu samples %llu invalid %s.\n",
+                                         gs_calibration[c].name, gs_mode_name[m], (unsigned long long)job.samples,
+                                         (unsigned long long)job.invalid, (job.first.found != 0) ? "failed" : "ok");
+            if (job.first.found != 0)
+            {
+                for (k = 0; k < EQUIVALENCE_KERNELS; k++)
+                {
+                    if (job.mismatch[k] != 0)
+                    {
+                        bmp180_interface_debug_print("bmp180: kernel %s has %llu mismatches.\n", gs_kernel_name[k],
+                                                     (unsigned long long)job.mismatch[k]);
+                    }
+                }
+                bmp180_interface_debug_print("bmp180: first mismatch kernel %s ut %d up 0x%06X status %d/%d "
+                                             "temperature %d/%d pressure %d/%d.\n",
+                                             gs_kernel_name[job.first.kernel], job.first.ut, job.first.up,
+                                             job.first.res, job.first.expect, 
+                                             job.first.got_temperature, job.first.temperature,
+                                             job.first.got_pa, job.first.pa);
+            }
+        }
+    }
+    
+    /* finish equivalence test */
+    bmp180_interface_debug_print("bmp180: %llu samples checked against every kernel.\n", (unsigned long long)total);
+    if (failed != 0)
+    {
+        bmp180_interface_debug_print("bmp180: equivalence test failed.\n");
+        
+        return 1;
+    }
+    bmp180_interface_debug_print("bmp180: finish equivalence test.\n");
+    
+    return 0;
+}
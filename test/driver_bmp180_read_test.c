@@ -23,13 +23,14 @@
  *
  * @file      driver_bmp180_read_test.c
  * @brief     driver bmp180 read test source file
- * @version   2.0.0
+ * @version   2.1.0
  * @author    Shifeng Li
  * @date      2021-02-21
  *
  * <h3>history</h3>
  * <table>
  * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>2.1      <td>Shifeng Li  <td>add the split-phase api and performance modules
  * <tr><td>2021/02/21  <td>2.0      <td>Shifeng Li  <td>format the code
  * <tr><td>2020/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
  * </table>
@@ -52,7 +53,10 @@ uint8_t bmp180_read_test(uint32_t times)
     uint8_t res;
     uint32_t i;
     uint16_t temperature_yaw;
+    int32_t temperature;
+#if (BMP180_FLOAT_ENABLE == 1)
     float temperature_c;
+#endif
     uint32_t pressure_yaw;
     uint32_t pressure_pa;
     bmp180_info_t info;
@@ -64,6 +68,10 @@ uint8_t bmp180_read_test(uint32_t times)
     DRIVER_BMP180_LINK_IIC_READ(&gs_handle, bmp180_interface_iic_read);
     DRIVER_BMP180_LINK_IIC_WRITE(&gs_handle, bmp180_interface_iic_write);
     DRIVER_BMP180_LINK_DELAY_MS(&gs_handle, bmp180_interface_delay_ms);
+    DRIVER_BMP180_LINK_DELAY_US(&gs_handle, bmp180_interface_delay_us);
+    DRIVER_BMP180_LINK_TIMESTAMP_MS(&gs_handle, bmp180_interface_timestamp_ms);
+    DRIVER_BMP180_LINK_TIMESTAMP_NS(&gs_handle, bmp180_interface_timestamp_ns);
+    DRIVER_BMP180_LINK_WAIT_EOC(&gs_handle, bmp180_interface_wait_eoc);
     DRIVER_BMP180_LINK_DEBUG_PRINT(&gs_handle, bmp180_interface_debug_print);
     
     /* get bmp180 info */
@@ -109,7 +117,11 @@ uint8_t bmp180_read_test(uint32_t times)
     }
     for (i = 0; i < times; i++)
     {
+#if (BMP180_FLOAT_ENABLE == 1)
         res = bmp180_read_temperature_pressure(&gs_handle, (uint16_t *)&temperature_yaw, (float *)&temperature_c, (uint32_t *)&pressure_yaw, (uint32_t *)&pressure_pa);
+#else
+        res = bmp180_read_temperature_pressure_fixed(&gs_handle, (uint16_t *)&temperature_yaw, (int32_t *)&temperature, (uint32_t *)&pressure_yaw, (uint32_t *)&pressure_pa);
+#endif
         if (res != 0)
         {
             bmp180_interface_debug_print("bmp180: read failed.\n");
@@ -117,7 +129,11 @@ uint8_t bmp180_read_test(uint32_t times)
             
             return 1;
         }
+#if (BMP180_FLOAT_ENABLE == 1)
         bmp180_interface_debug_print("bmp180: ultra low mode temperature: %.01fC.\n", temperature_c);
+#else
+        bmp180_interface_debug_print("bmp180: ultra low mode temperature: %d * 0.1C.\n", temperature);
+#endif
         bmp180_interface_debug_print("bmp180: ultra low mode pressure: %dPa.\n", pressure_pa);
         bmp180_interface_delay_ms(1000);
     }
@@ -133,7 +149,11 @@ uint8_t bmp180_read_test(uint32_t times)
     }
     for (i = 0; i < times; i++)
     {
+#if (BMP180_FLOAT_ENABLE == 1)
         res = bmp180_read_temperature_pressure(&gs_handle, (uint16_t *)&temperature_yaw, (float *)&temperature_c, (uint32_t *)&pressure_yaw, (uint32_t *)&pressure_pa);
+#else
+        res = bmp180_read_temperature_pressure_fixed(&gs_handle, (uint16_t *)&temperature_yaw, (int32_t *)&temperature, (uint32_t *)&pressure_yaw, (uint32_t *)&pressure_pa);
+#endif
         if (res != 0)
         {
             bmp180_interface_debug_print("bmp180: read failed.\n");
@@ -141,7 +161,11 @@ uint8_t bmp180_read_test(uint32_t times)
             
             return 1;
         }
+#if (BMP180_FLOAT_ENABLE == 1)
         bmp180_interface_debug_print("bmp180: standard mode temperature: %.01fC.\n", temperature_c);
+#else
+        bmp180_interface_debug_print("bmp180: standard mode temperature: %d * 0.1C.\n", temperature);
+#endif
         bmp180_interface_debug_print("bmp180: standard mode pressure: %dPa.\n", pressure_pa);
         bmp180_interface_delay_ms(1000);
     }
@@ -157,7 +181,11 @@ uint8_t bmp180_read_test(uint32_t times)
     }
     for (i = 0; i < times; i++)
     {
+#if (BMP180_FLOAT_ENABLE == 1)
         res = bmp180_read_temperature_pressure(&gs_handle, (uint16_t *)&temperature_yaw, (float *)&temperature_c, (uint32_t *)&pressure_yaw, (uint32_t *)&pressure_pa);
+#else
+        res = bmp180_read_temperature_pressure_fixed(&gs_handle, (uint16_t *)&temperature_yaw, (int32_t *)&temperature, (uint32_t *)&pressure_yaw, (uint32_t *)&pressure_pa);
+#endif
         if (res != 0)
         {
             bmp180_interface_debug_print("bmp180: read failed.\n");
@@ -165,7 +193,11 @@ uint8_t bmp180_read_test(uint32_t times)
             
             return 1;
         }
+#if (BMP180_FLOAT_ENABLE == 1)
         bmp180_interface_debug_print("bmp180: high mode temperature: %.01fC.\n", temperature_c);
+#else
+        bmp180_interface_debug_print("bmp180: high mode temperature: %d * 0.1C.\n", temperature);
+#endif
         bmp180_interface_debug_print("bmp180: high mode pressure: %dPa.\n", pressure_pa);
         bmp180_interface_delay_ms(1000);
     }
@@ -181,7 +213,11 @@ uint8_t bmp180_read_test(uint32_t times)
     }
     for (i = 0; i < times; i++)
     {
+#if (BMP180_FLOAT_ENABLE == 1)
         res = bmp180_read_temperature_pressure(&gs_handle, (uint16_t *)&temperature_yaw, (float *)&temperature_c, (uint32_t *)&pressure_yaw, (uint32_t *)&pressure_pa);
+#else
+        res = bmp180_read_temperature_pressure_fixed(&gs_handle, (uint16_t *)&temperature_yaw, (int32_t *)&temperature, (uint32_t *)&pressure_yaw, (uint32_t *)&pressure_pa);
+#endif
         if (res != 0)
         {
             bmp180_interface_debug_print("bmp180: read failed.\n");
@@ -189,11 +225,207 @@ uint8_t bmp180_read_test(uint32_t times)
             
             return 1;
         }
+#if (BMP180_FLOAT_ENABLE == 1)
         bmp180_interface_debug_print("bmp180: ultra high mode temperature: %.01fC.\n", temperature_c);
+#else
+        bmp180_interface_debug_print("bmp180: ultra high mode temperature: %d * 0.1C.\n", temperature);
+#endif
         bmp180_interface_debug_print("bmp180: ultra high mode pressure: %dPa.\n", pressure_pa);
         bmp180_interface_delay_ms(1000);
     }
     
+    /* wait mode bus transactions */
+    bmp180_interface_debug_print("bmp180: wait mode bus transactions.\n");
+    for (i = 0; i < 12; i++)
+    {
+        uint32_t read_count;
+        uint32_t write_count;
+        
+        /* set wait mode and measurement mode */
+        res = bmp180_set_wait_mode(&gs_handle, (bmp180_wait_mode_t)(i / 4));
+        if (res != 0)
+        {
+            bmp180_interface_debug_print("bmp180: set wait mode failed.\n");
+            (void)bmp180_deinit(&gs_handle); 
+            
+            return 1;
+        }
+        res = bmp180_set_mode(&gs_handle, (bmp180_mode_t)(i % 4));
+        if (res != 0)
+        {
+            bmp180_interface_debug_print("bmp180: set mode failed.\n");
+            (void)bmp180_deinit(&gs_handle); 
+            
+            return 1;
+        }
+        
+        /* read once and count the transactions */
+        (void)bmp180_clear_iic_count(&gs_handle);
+        res = bmp180_read_temperature_pressure_fixed(&gs_handle, (uint16_t *)&temperature_yaw, (int32_t *)&temperature, (uint32_t *)&pressure_yaw, (uint32_t *)&pressure_pa);
+        if (res != 0)
+        {
+            bmp180_interface_debug_print("bmp180: read failed.\n");
+            (void)bmp180_deinit(&gs_handle); 
+            
+            return 1;
+        }
+        (void)bmp180_get_iic_count(&gs_handle, &read_count, &write_count);
+        bmp180_interface_debug_print("bmp180: %s wait mode %d oss %d * 0.1C %dPa with %d reads and %d writes.\n",
+                                     (i < 4) ? "poll" : ((i < 8) ? "timed" : "eoc"), (uint32_t)(i % 4), temperature, pressure_pa,
+                                     read_count, write_count);
+    }
+    (void)bmp180_set_wait_mode(&gs_handle, BMP180_WAIT_MODE_POLL);
+    
+    /* burst readout bus transactions */
+    bmp180_interface_debug_print("bmp180: burst readout bus transactions.\n");
+    res = bmp180_set_burst_read(&gs_handle, BMP180_BOOL_TRUE);
+    if (res != 0)
+    {
+        bmp180_interface_debug_print("bmp180: set burst read failed.\n");
+        (void)bmp180_deinit(&gs_handle); 
+        
+        return 1;
+    }
+    for (i = 0; i < 4; i++)
+    {
+        uint32_t read_count;
+        uint32_t write_count;
+        
+        res = bmp180_set_mode(&gs_handle, (bmp180_mode_t)(i));
+        if (res != 0)
+        {
+            bmp180_interface_debug_print("bmp180: set mode failed.\n");
+            (void)bmp180_deinit(&gs_handle); 
+            
+            return 1;
+        }
+        (void)bmp180_clear_iic_count(&gs_handle);
+        res = bmp180_read_temperature_pressure_fixed(&gs_handle, (uint16_t *)&temperature_yaw, (int32_t *)&temperature, (uint32_t *)&pressure_yaw, (uint32_t *)&pressure_pa);
+        if (res != 0)
+        {
+            bmp180_interface_debug_print("bmp180: read failed.\n");
+            (void)bmp180_deinit(&gs_handle); 
+            
+            return 1;
+        }
+        (void)bmp180_get_iic_count(&gs_handle, &read_count, &write_count);
+        bmp180_interface_debug_print("bmp180: burst %d oss %d * 0.1C %dPa with %d reads and %d writes.\n",
+                                     (uint32_t)(i), temperature, pressure_pa, read_count, write_count);
+    }
+    (void)bmp180_set_burst_read(&gs_handle, BMP180_BOOL_FALSE);
+    
+    /* temperature reuse */
+    bmp180_interface_debug_print("bmp180: temperature reuse every 4 pressure reads.\n");
+    res = bmp180_set_temperature_reuse(&gs_handle, 4, 0);
+    if (res != 0)
+    {
+        bmp180_interface_debug_print("bmp180: set temperature reuse failed.\n");
+        (void)bmp180_deinit(&gs_handle); 
+        
+        return 1;
+    }
+    for (i = 0; i < times * 4; i++)
+    {
+        uint32_t read_count;
+        uint32_t write_count;
+        
+        (void)bmp180_clear_iic_count(&gs_handle);
+        res = bmp180_read_pressure(&gs_handle, (uint32_t *)&pressure_yaw, (uint32_t *)&pressure_pa);
+        if (res != 0)
+        {
+            bmp180_interface_debug_print("bmp180: read pressure failed.\n");
+            (void)bmp180_deinit(&gs_handle); 
+            
+            return 1;
+        }
+        (void)bmp180_get_iic_count(&gs_handle, &read_count, &write_count);
+        bmp180_interface_debug_print("bmp180: pressure %dPa with %d conversions.\n", pressure_pa, write_count);
+    }
+    (void)bmp180_set_temperature_reuse(&gs_handle, 0, 0);
+    
+    /* non-blocking read */
+    bmp180_interface_debug_print("bmp180: non-blocking read.\n");
+    for (i = 0; i < times; i++)
+    {
+        bmp180_bool_t ready;
+        
+        /* start temperature conversion */
+        res = bmp180_start_temperature(&gs_handle);
+        if (res != 0)
+        {
+            bmp180_interface_debug_print("bmp180: start temperature failed.\n");
+            (void)bmp180_deinit(&gs_handle); 
+            
+            return 1;
+        }
+        
+        /* fetch when ready */
+        do
+        {
+            bmp180_interface_delay_ms(1);
+            res = bmp180_fetch_temperature_fixed(&gs_handle, (uint16_t *)&temperature_yaw, (int32_t *)&temperature);
+        } while (res == 5);
+        if (res != 0)
+        {
+            bmp180_interface_debug_print("bmp180: fetch temperature failed.\n");
+            (void)bmp180_deinit(&gs_handle); 
+            
+            return 1;
+        }
+        
+        /* start pressure conversion */
+        res = bmp180_start_pressure(&gs_handle);
+        if (res != 0)
+        {
+            bmp180_interface_debug_print("bmp180: start pressure failed.\n");
+            (void)bmp180_deinit(&gs_handle); 
+            
+            return 1;
+        }
+        
+        /* poll until ready */
+        do
+        {
+            bmp180_interface_delay_ms(1);
+            res = bmp180_poll_conversion(&gs_handle, &ready);
+        } while ((res == 0) && (ready == BMP180_BOOL_FALSE));
+        if (res != 0)
+        {
+            bmp180_interface_debug_print("bmp180: poll conversion failed.\n");
+            (void)bmp180_deinit(&gs_handle); 
+            
+            return 1;
+        }
+        res = bmp180_fetch_pressure(&gs_handle, (uint32_t *)&pressure_yaw, (uint32_t *)&pressure_pa);
+        if (res != 0)
+        {
+            bmp180_interface_debug_print("bmp180: fetch pressure failed.\n");
+            (void)bmp180_deinit(&gs_handle); 
+            
+            return 1;
+        }
+        bmp180_interface_debug_print("bmp180: non-blocking temperature: %d * 0.1C.\n", temperature);
+        bmp180_interface_debug_print("bmp180: non-blocking pressure: %dPa.\n", pressure_pa);
+        bmp180_interface_delay_ms(1000);
+    }
+    
+    /* fixed point read */
+    bmp180_interface_debug_print("bmp180: fixed point read.\n");
+    for (i = 0; i < times; i++)
+    {
+        res = bmp180_read_temperature_pressure_fixed(&gs_handle, (uint16_t *)&temperature_yaw, (int32_t *)&temperature, (uint32_t *)&pressure_yaw, (uint32_t *)&pressure_pa);
+        if (res != 0)
+        {
+            bmp180_interface_debug_print("bmp180: read failed.\n");
+            (void)bmp180_deinit(&gs_handle); 
+            
+            return 1;
+        }
+        bmp180_interface_debug_print("bmp180: fixed point temperature: %d * 0.1C.\n", temperature);
+        bmp180_interface_debug_print("bmp180: fixed point pressure: %dPa.\n", pressure_pa);
+        bmp180_interface_delay_ms(1000);
+    }
+    
     /* finish read test */
     bmp180_interface_debug_print("bmp180: finish read test.\n");
     (void)bmp180_deinit(&gs_handle); 
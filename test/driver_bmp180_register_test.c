@@ -23,13 +23,14 @@
  *
  * @file      driver_bmp180_register_test.c
  * @brief     driver bmp180 register test source file
- * @version   2.0.0
+ * @version   2.1.0
  * @author    Shifeng Li
  * @date      2021-02-21
  *
  * <h3>history</h3>
  * <table>
  * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>2.1      <td>Shifeng Li  <td>add the split-phase api and performance modules
  * <tr><td>2021/02/21  <td>2.0      <td>Shifeng Li  <td>format the code
  * <tr><td>2020/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
  * </table>
@@ -51,6 +52,7 @@ uint8_t bmp180_register_test(void)
     uint8_t res;
     bmp180_mode_t mode;
     bmp180_info_t info;
+    uint8_t blob[BMP180_CALIBRATION_SIZE];
     
     /* link interface function */
     DRIVER_BMP180_LINK_INIT(&gs_handle, bmp180_handle_t); 
@@ -59,6 +61,10 @@ uint8_t bmp180_register_test(void)
     DRIVER_BMP180_LINK_IIC_READ(&gs_handle, bmp180_interface_iic_read);
     DRIVER_BMP180_LINK_IIC_WRITE(&gs_handle, bmp180_interface_iic_write);
     DRIVER_BMP180_LINK_DELAY_MS(&gs_handle, bmp180_interface_delay_ms);
+    DRIVER_BMP180_LINK_DELAY_US(&gs_handle, bmp180_interface_delay_us);
+    DRIVER_BMP180_LINK_TIMESTAMP_MS(&gs_handle, bmp180_interface_timestamp_ms);
+    DRIVER_BMP180_LINK_TIMESTAMP_NS(&gs_handle, bmp180_interface_timestamp_ns);
+    DRIVER_BMP180_LINK_WAIT_EOC(&gs_handle, bmp180_interface_wait_eoc);
     DRIVER_BMP180_LINK_DEBUG_PRINT(&gs_handle, bmp180_interface_debug_print);
     
     /* get bmp180 info */
@@ -176,6 +182,48 @@ uint8_t bmp180_register_test(void)
     }        
     bmp180_interface_debug_print("bmp180: check mode %s.\n", mode == BMP180_MODE_ULTRA_HIGH ? "ok" : "error");
     
+    /* bmp180_export_calibration/bmp180_init_with_calibration test */
+    bmp180_interface_debug_print("bmp180: bmp180_export_calibration/bmp180_init_with_calibration test.\n");
+    res = bmp180_export_calibration(&gs_handle, (uint8_t *)blob, BMP180_CALIBRATION_SIZE);
+    if (res != 0)
+    {
+        bmp180_interface_debug_print("bmp180: export calibration failed.\n");
+        (void)bmp180_deinit(&gs_handle); 
+        
+        return 1;
+    }
+    bmp180_interface_debug_print("bmp180: export calibration version %d.\n", blob[1]);
+    (void)bmp180_deinit(&gs_handle); 
+    res = bmp180_init_with_calibration(&gs_handle, (const uint8_t *)blob, BMP180_CALIBRATION_SIZE, BMP180_BOOL_TRUE);
+    if (res != 0)
+    {
+        bmp180_interface_debug_print("bmp180: init with calibration failed.\n");
+        
+        return 1;
+    }
+    bmp180_interface_debug_print("bmp180: init with calibration and id check.\n");
+    (void)bmp180_deinit(&gs_handle); 
+    res = bmp180_init_with_calibration(&gs_handle, (const uint8_t *)blob, BMP180_CALIBRATION_SIZE, BMP180_BOOL_FALSE);
+    if (res != 0)
+    {
+        bmp180_interface_debug_print("bmp180: init with calibration failed.\n");
+        
+        return 1;
+    }
+    bmp180_interface_debug_print("bmp180: init with calibration without id check.\n");
+    blob[2] ^= 0x01;
+    (void)bmp180_deinit(&gs_handle); 
+    res = bmp180_init_with_calibration(&gs_handle, (const uint8_t *)blob, BMP180_CALIBRATION_SIZE, BMP180_BOOL_FALSE);
+    bmp180_interface_debug_print("bmp180: check corrupted calibration %s.\n", res == 6 ? "ok" : "error");
+    blob[2] ^= 0x01;
+    res = bmp180_init_with_calibration(&gs_handle, (const uint8_t *)blob, BMP180_CALIBRATION_SIZE, BMP180_BOOL_FALSE);
+    if (res != 0)
+    {
+        bmp180_interface_debug_print("bmp180: init with calibration failed.\n");
+        
+        return 1;
+    }
+    
     /* finish register test */
     bmp180_interface_debug_print("bmp180: finish register test.\n");
     (void)bmp180_deinit(&gs_handle); 
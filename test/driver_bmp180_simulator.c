@@ -0,0 +1,914 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_bmp180_simulator.c
+ * @brief     driver bmp180 simulator source file
+ * @version   2.1.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>2.1      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+#include "driver_bmp180_simulator.h"
+#include <math.h>
+
+/**
+ * @brief simulator register definition
+ */
+#define SIMULATOR_ADDRESS               0xEE        /**< iic device address */
+#define SIMULATOR_REG_CALIBRATION       0xAA        /**< first calibration register */
+#define SIMULATOR_REG_ID                0xD0        /**< chip id register */
+#define SIMULATOR_REG_SOFT_RESET        0xE0        /**< soft reset register */
+#define SIMULATOR_REG_CTRL_MEAS         0xF4        /**< ctrl meas register */
+#define SIMULATOR_REG_OUT_MSB           0xF6        /**< out msb register */
+#define SIMULATOR_REG_OUT_LSB           0xF7        /**< out lsb register */
+#define SIMULATOR_REG_OUT_XLSB          0xF8        /**< out xlsb register */
+#define SIMULATOR_CTRL_MEAS_SCO         0x20        /**< start of conversion bit */
+
+/**
+ * @brief simulator conversion definition
+ */
+#define SIMULATOR_CONVERSION_NONE          0        /**< no conversion is running */
+#define SIMULATOR_CONVERSION_TEMPERATURE   1        /**< temperature conversion is running */
+#define SIMULATOR_CONVERSION_PRESSURE      2        /**< pressure conversion is running */
+
+/**
+ * @brief datasheet example calibration definition
+ */
+static const uint8_t gs_calibration[22] =
+{
+    0x01, 0x98, 0xFF, 0xB8, 0xC7, 0xD1, 0x7F, 0xE5, 0x7F, 0xF5, 0x5A,
+    0x71, 0x18, 0x2E, 0x00, 0x04, 0x80, 0x00, 0xDD, 0xF9, 0x0B, 0x34,
+};
+
+/**
+ * @brief conversion time definition in ns, temperature first and then indexed by oss
+ */
+static const uint64_t gs_conversion_ns[5] = {4500000ULL, 4500000ULL, 7500000ULL, 13500000ULL, 25500000ULL};
+
+static bmp180_simulator_device_t gs_device;                                   /**< default device */
+static int32_t gs_ac1, gs_ac2, gs_ac3, gs_ac4, gs_ac5, gs_ac6;               /**< calibration ac1-ac6 */
+static int32_t gs_b1, gs_b2, gs_mc, gs_md;                                   /**< calibration b1, b2, mc and md */
+static uint64_t gs_time_ns;                                                  /**< virtual clock */
+static uint32_t gs_bus_hz;                                                   /**< iic bus clock */
+static uint32_t gs_error;                                                    /**< failed transfers to inject */
+static uint32_t gs_read;                                                     /**< read transfer counter */
+static uint32_t gs_write;                                                    /**< write transfer counter */
+static uint32_t gs_bytes;                                                    /**< transferred byte counter */
+static uint32_t gs_seed;                                                     /**< noise generator state */
+static bmp180_simulator_trajectory_t gs_trajectory;                          /**< trajectory */
+static void (*gs_callback)(uint64_t us, int32_t *temperature, int32_t *pa);  /**< trajectory callback */
+
+/**
+ * @brief      compensate a raw temperature with the datasheet algorithm
+ * @param[in]  ut raw temperature
+ * @param[out] *b5 pointer to a b5 buffer
+ * @return     temperature in 0.1 degrees celsius
+ * @note       none
+ */
+static int32_t a_simulator_temperature(int32_t ut, int32_t *b5)
+{
+    int32_t x1;
+    int32_t x2;
+    
+    x1 = ((ut - gs_ac6) * gs_ac5) >> 15;
+    x2 = (x1 + gs_md != 0) ? ((gs_mc << 11) / (x1 + gs_md)) : 0;
+    *b5 = x1 + x2;
+    
+    return (*b5 + 8) >> 4;
+}
+
+/**
+ * @brief     compensate a raw pressure with the datasheet algorithm
+ * @param[in] up raw pressure
+ * @param[in] b5 temperature compensation term
+ * @param[in] oss oversampling setting
+ * @return    pressure in pa
+ * @note      none
+ */
+static int32_t a_simulator_pressure(int32_t up, int32_t b5, uint8_t oss)
+{
+    int32_t x1, x2, x3, b3, b6, p;
+    uint32_t b4, b7;
+    
+    b6 = b5 - 4000;
+    x1 = (gs_b2 * ((b6 * b6) >> 12)) >> 11;
+    x2 = (gs_ac2 * b6) >> 11;
+    x3 = x1 + x2;
+    b3 = (((gs_ac1 * 4 + x3) << oss) + 2) >> 2;
+    x1 = (gs_ac3 * b6) >> 13;
+    x2 = (gs_b1 * ((b6 * b6) >> 12)) >> 16;
+    x3 = ((x1 + x2) + 2) >> 2;
+    b4 = ((uint32_t)gs_ac4 * (uint32_t)(x3 + 32768)) >> 15;
+    if (b4 == 0)
+    {
+        return 0;
+    }
+    b7 = (uint32_t)(up - b3) * (uint32_t)(50000 >> oss);
+    if (b7 < 0x80000000U)
+    {
+        p = (int32_t)((b7 * 2) / b4);
+    }
+    else
+    {
+        p = (int32_t)((b7 / b4) * 2);
+    }
+    x1 = (p >> 8) * (p >> 8);
+    x1 = (x1 * 3038) >> 16;
+    x2 = (-7357 * p) >> 16;
+    
+    return p + ((x1 + x2 + 3791) >> 4);
+}
+
+/**
+ * @brief     find the raw temperature of a temperature
+ * @param[in] temperature temperature in 0.1 degrees celsius
+ * @return    raw temperature
+ * @note      the smallest raw value whose temperature is not below the target
+ */
+static uint16_t a_simulator_invert_temperature(int32_t temperature)
+{
+    int32_t lo;
+    int32_t hi;
+    int32_t mid;
+    int32_t b5;
+    
+    /* the temperature rises with ut above ac6 */
+    lo = gs_ac6;
+    hi = 65535;
+    while (lo < hi)
+    {
+        mid = lo + (hi - lo) / 2;
+        if (a_simulator_temperature(mid, &b5) < temperature)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    
+    return (uint16_t)lo;
+}
+
+/**
+ * @brief     find the raw pressure of a pressure
+ * @param[in] pa pressure in pa
+ * @param[in] oss oversampling setting
+ * @param[in] ut raw temperature of the pressure conversion
+ * @return    raw pressure
+ * @note      the smallest raw value whose pressure is not below the target
+ */
+static uint32_t a_simulator_invert_pressure(int32_t pa, uint8_t oss, uint16_t ut)
+{
+    int32_t lo;
+    int32_t hi;
+    int32_t mid;
+    int32_t b5;
+    int32_t b3;
+    int32_t b6;
+    int32_t x1;
+    int32_t x2;
+    
+    /* the pressure rises with up above b3 */
+    (void)a_simulator_temperature(ut, &b5);
+    b6 = b5 - 4000;
+    x1 = (gs_b2 * ((b6 * b6) >> 12)) >> 11;
+    x2 = (gs_ac2 * b6) >> 11;
+    b3 = (((gs_ac1 * 4 + x1 + x2) << oss) + 2) >> 2;
+    lo = (b3 > 0) ? b3 : 0;
+    hi = (int32_t)(0x10000 << oss) - 1;
+    while (lo < hi)
+    {
+        mid = lo + (hi - lo) / 2;
+        if (a_simulator_pressure(mid, b5, oss) < pa)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    
+    return (uint32_t)lo;
+}
+
+/**
+ * @brief      get the trajectory values
+ * @param[in]  ns virtual time in ns
+ * @param[out] *temperature pointer to a temperature buffer
+ * @param[out] *pa pointer to a pressure buffer
+ * @note       none
+ */
+static void a_simulator_trajectory(uint64_t ns, int32_t *temperature, int32_t *pa)
+{
+    double hours;
+    double p;
+    uint32_t noise;
+    
+    /* user trajectory */
+    if (gs_callback != NULL)
+    {
+        gs_callback(ns / 1000, temperature, pa);
+        
+        return;
+    }
+    
+    /* slopes */
+    hours = (double)ns / 3.6e12;
+    *temperature = gs_trajectory.temperature + (int32_t)lround(gs_trajectory.temperature_slope * hours);
+    p = gs_trajectory.pressure + gs_trajectory.pressure_slope * hours;
+    
+    /* sine */
+    if (gs_trajectory.pressure_period_ms != 0)
+    {
+        p += gs_trajectory.pressure_amplitude * 
+             sin(6.283185307179586 * (double)((ns / 1000000) % gs_trajectory.pressure_period_ms) / 
+                 (double)gs_trajectory.pressure_period_ms);
+    }
+    
+    /* noise */
+    if (gs_trajectory.pressure_noise != 0)
+    {
+        gs_seed ^= gs_seed << 13;
+        gs_seed ^= gs_seed >> 17;
+        gs_seed ^= gs_seed << 5;
+        noise = gs_seed % (2 * gs_trajectory.pressure_noise + 1);
+        p += (double)noise - (double)gs_trajectory.pressure_noise;
+    }
+    *pa = (int32_t)lround(p);
+}
+
+/**
+ * @brief     finish the running conversion when its time is over
+ * @param[in] *device pointer to a simulator device structure
+ * @note      none
+ */
+static void a_simulator_update(bmp180_simulator_device_t *device)
+{
+    uint32_t up;
+    
+    if ((device->conversion == SIMULATOR_CONVERSION_NONE) || (gs_time_ns < device->done_ns))
+    {
+        return;
+    }
+    
+    if (device->conversion == SIMULATOR_CONVERSION_TEMPERATURE)
+    {
+        int32_t pa;
+        
+        /* sample the temperature at the end of the conversion */
+        a_simulator_trajectory(device->done_ns, &device->temperature, &pa);
+        device->ut = a_simulator_invert_temperature(device->temperature);
+        device->reg[SIMULATOR_REG_OUT_MSB] = (uint8_t)(device->ut >> 8);
+        device->reg[SIMULATOR_REG_OUT_LSB] = (uint8_t)(device->ut >> 0);
+        device->reg[SIMULATOR_REG_OUT_XLSB] = 0x00;
+    }
+    else
+    {
+        int32_t temperature;
+        
+        /* sample the pressure at the end of the conversion */
+        a_simulator_trajectory(device->done_ns, &temperature, &device->pa);
+        up = a_simulator_invert_pressure(device->pa, device->oss, device->ut) << (8 - device->oss);
+        device->reg[SIMULATOR_REG_OUT_MSB] = (uint8_t)(up >> 16);
+        device->reg[SIMULATOR_REG_OUT_LSB] = (uint8_t)(up >> 8);
+        device->reg[SIMULATOR_REG_OUT_XLSB] = (uint8_t)(up >> 0);
+    }
+    device->reg[SIMULATOR_REG_CTRL_MEAS] &= (uint8_t)(~SIMULATOR_CTRL_MEAS_SCO);
+    device->conversion = SIMULATOR_CONVERSION_NONE;
+}
+
+/**
+ * @brief     advance the virtual clock by the bit time of a transfer
+ * @param[in] bytes transferred bytes
+ * @note      every byte takes 9 clocks
+ */
+static void a_simulator_bus(uint32_t bytes)
+{
+    gs_bytes += bytes;
+    if (gs_bus_hz != 0)
+    {
+        gs_time_ns += ((uint64_t)bytes * 9 * 1000000000ULL + gs_bus_hz - 1) / gs_bus_hz;
+    }
+}
+
+/**
+ * @brief      read the registers of a device
+ * @param[in]  *device pointer to a simulator device structure
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+static uint8_t a_simulator_read(bmp180_simulator_device_t *device, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint16_t i;
+    
+    /* address, register, repeated start address and data */
+    gs_read++;
+    a_simulator_bus(3 + len);
+    if ((addr != SIMULATOR_ADDRESS) || (gs_error != 0))
+    {
+        if (gs_error != 0)
+        {
+            gs_error--;
+        }
+        
+        return 1;
+    }
+    
+    /* update the conversion and read the registers */
+    a_simulator_update(device);
+    for (i = 0; i < len; i++)
+    {
+        buf[i] = device->reg[(uint8_t)(reg + i)];
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     write the registers of a device
+ * @param[in] *device pointer to a simulator device structure
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+static uint8_t a_simulator_write(bmp180_simulator_device_t *device, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint16_t i;
+    uint8_t r;
+    
+    /* address, register and data */
+    gs_write++;
+    a_simulator_bus(2 + len);
+    if ((addr != SIMULATOR_ADDRESS) || (gs_error != 0))
+    {
+        if (gs_error != 0)
+        {
+            gs_error--;
+        }
+        
+        return 1;
+    }
+    
+    a_simulator_update(device);
+    for (i = 0; i < len; i++)
+    {
+        r = (uint8_t)(reg + i);
+        if (r == SIMULATOR_REG_CTRL_MEAS)
+        {
+            /* a new command restarts the conversion */
+            device->reg[r] = buf[i];
+            device->conversion = SIMULATOR_CONVERSION_NONE;
+            if ((buf[i] & SIMULATOR_CTRL_MEAS_SCO) != 0)
+            {
+                if ((buf[i] & 0x1F) == 0x0E)
+                {
+                    device->conversion = SIMULATOR_CONVERSION_TEMPERATURE;
+                    device->done_ns = gs_time_ns + gs_conversion_ns[0];
+                }
+                else if ((buf[i] & 0x1F) == 0x14)
+                {
+                    device->conversion = SIMULATOR_CONVERSION_PRESSURE;
+                    device->oss = (buf[i] >> 6) & 0x03;
+                    device->done_ns = gs_time_ns + gs_conversion_ns[1 + device->oss];
+                }
+                else
+                {
+                    /* unknown measurement, the bit is cleared at once */
+                    device->reg[r] &= (uint8_t)(~SIMULATOR_CTRL_MEAS_SCO);
+                }
+            }
+        }
+        else if ((r == SIMULATOR_REG_SOFT_RESET) && (buf[i] == 0xB6))
+        {
+            /* soft reset */
+            device->reg[SIMULATOR_REG_CTRL_MEAS] = 0x00;
+            device->conversion = SIMULATOR_CONVERSION_NONE;
+        }
+        else
+        {
+            /* calibration, id and output registers are read only */
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     wait for the eoc rising edge of a device
+ * @param[in] *device pointer to a simulator device structure
+ * @param[in] us timeout in us
+ * @return    status code
+ *            - 0 success
+ *            - 1 timeout
+ * @note      it advances the virtual clock to the end of the running conversion
+ */
+static uint8_t a_simulator_wait_eoc(bmp180_simulator_device_t *device, uint32_t us)
+{
+    /* eoc is high without a running conversion */
+    if (device->conversion == SIMULATOR_CONVERSION_NONE)
+    {
+        return 0;
+    }
+    
+    /* check the timeout */
+    if (device->done_ns > gs_time_ns + (uint64_t)us * 1000ULL)
+    {
+        gs_time_ns += (uint64_t)us * 1000ULL;
+        
+        return 1;
+    }
+    if (device->done_ns > gs_time_ns)
+    {
+        gs_time_ns = device->done_ns;
+    }
+    a_simulator_update(device);
+    
+    return 0;
+}
+
+/**
+ * @brief     initialize the simulator
+ * @param[in] *calibration pointer to the 22 calibration register bytes from 0xAA, NULL uses the datasheet example
+ * @return    status code
+ *            - 0 success
+ * @note      the virtual clock, the registers, the counters and the trajectory are reset,
+ *            the default trajectory is a constant 25.0C and 101325pa
+ */
+uint8_t bmp180_simulator_init(const uint8_t *calibration)
+{
+    const uint8_t *c;
+    
+    /* parse the calibration */
+    c = (calibration != NULL) ? calibration : gs_calibration;
+    gs_ac1 = (int16_t)(((uint16_t)c[0] << 8) | c[1]);
+    gs_ac2 = (int16_t)(((uint16_t)c[2] << 8) | c[3]);
+    gs_ac3 = (int16_t)(((uint16_t)c[4] << 8) | c[5]);
+    gs_ac4 = (uint16_t)(((uint16_t)c[6] << 8) | c[7]);
+    gs_ac5 = (uint16_t)(((uint16_t)c[8] << 8) | c[9]);
+    gs_ac6 = (uint16_t)(((uint16_t)c[10] << 8) | c[11]);
+    gs_b1 = (int16_t)(((uint16_t)c[12] << 8) | c[13]);
+    gs_b2 = (int16_t)(((uint16_t)c[14] << 8) | c[15]);
+    gs_mc = (int16_t)(((uint16_t)c[18] << 8) | c[19]);
+    gs_md = (int16_t)(((uint16_t)c[20] << 8) | c[21]);
+    memcpy(&gs_device.reg[SIMULATOR_REG_CALIBRATION], c, 22);
+    
+    /* reset the state */
+    gs_time_ns = 0;
+    gs_bus_hz = 0;
+    gs_error = 0;
+    gs_read = 0;
+    gs_write = 0;
+    gs_bytes = 0;
+    gs_seed = 0x2545F491;
+    gs_callback = NULL;
+    memset(&gs_trajectory, 0, sizeof(bmp180_simulator_trajectory_t));
+    gs_trajectory.temperature = 250;
+    gs_trajectory.pressure = 101325;
+    
+    /* reset the default device */
+    (void)bmp180_simulator_device_init(&gs_device);
+    
+    return 0;
+}
+
+/**
+ * @brief     initialize a simulator device
+ * @param[in] *device pointer to a simulator device structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 device is NULL
+ * @note      the device gets the calibration of bmp180_simulator_init,
+ *            all devices share the virtual clock, the trajectory, the bus and the counters
+ */
+uint8_t bmp180_simulator_device_init(bmp180_simulator_device_t *device)
+{
+    uint8_t calibration[22];
+    
+    if (device == NULL)
+    {
+        return 2;
+    }
+    
+    /* reset the register map */
+    memcpy(calibration, &gs_device.reg[SIMULATOR_REG_CALIBRATION], 22);
+    memset(device, 0, sizeof(bmp180_simulator_device_t));
+    memcpy(&device->reg[SIMULATOR_REG_CALIBRATION], calibration, 22);
+    device->reg[SIMULATOR_REG_ID] = 0x55;
+    
+    /* reset the conversion */
+    device->conversion = SIMULATOR_CONVERSION_NONE;
+    device->temperature = gs_trajectory.temperature;
+    device->pa = gs_trajectory.pressure;
+    device->ut = a_simulator_invert_temperature(device->temperature);
+    
+    return 0;
+}
+
+/**
+ * @brief     set the trajectory
+ * @param[in] *trajectory pointer to a trajectory structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 trajectory is NULL
+ * @note      it clears the trajectory callback
+ */
+uint8_t bmp180_simulator_set_trajectory(const bmp180_simulator_trajectory_t *trajectory)
+{
+    if (trajectory == NULL)
+    {
+        return 1;
+    }
+    gs_trajectory = *trajectory;
+    gs_callback = NULL;
+    
+    return 0;
+}
+
+/**
+ * @brief     set the trajectory callback
+ * @param[in] *callback pointer to a trajectory callback
+ * @return    status code
+ *            - 0 success
+ * @note      the callback returns the temperature in 0.1 degrees celsius and the pressure in pa
+ *            at the virtual time in us, NULL restores the trajectory structure
+ */
+uint8_t bmp180_simulator_set_trajectory_callback(void (*callback)(uint64_t us, int32_t *temperature, int32_t *pa))
+{
+    gs_callback = callback;
+    
+    return 0;
+}
+
+/**
+ * @brief     set the iic bus speed
+ * @param[in] hz bus clock in hz
+ * @return    status code
+ *            - 0 success
+ * @note      every transfer advances the virtual clock by its bit time, 0 makes transfers free
+ */
+uint8_t bmp180_simulator_set_bus_speed(uint32_t hz)
+{
+    gs_bus_hz = hz;
+    
+    return 0;
+}
+
+/**
+ * @brief     fail the next transfers
+ * @param[in] count number of failed transfers
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+uint8_t bmp180_simulator_inject_error(uint32_t count)
+{
+    gs_error = count;
+    
+    return 0;
+}
+
+/**
+ * @brief      get the true values of the last finished conversions
+ * @param[out] *temperature pointer to a temperature buffer in 0.1 degrees celsius
+ * @param[out] *pa pointer to a pressure buffer in pa
+ * @return     status code
+ *             - 0 success
+ * @note       the raw values are inverted from them with the integer compensation,
+ *             it reports the default device
+ */
+uint8_t bmp180_simulator_get_truth(int32_t *temperature, int32_t *pa)
+{
+    *temperature = gs_device.temperature;
+    *pa = gs_device.pa;
+    
+    return 0;
+}
+
+/**
+ * @brief      get the transfer counters
+ * @param[out] *read pointer to a read transfer counter buffer
+ * @param[out] *write pointer to a write transfer counter buffer
+ * @param[out] *bytes pointer to a transferred byte counter buffer
+ * @return     status code
+ *             - 0 success
+ * @note       bytes include the address and register bytes
+ */
+uint8_t bmp180_simulator_get_count(uint32_t *read, uint32_t *write, uint32_t *bytes)
+{
+    *read = gs_read;
+    *write = gs_write;
+    *bytes = gs_bytes;
+    
+    return 0;
+}
+
+/**
+ * @brief  clear the transfer counters
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+uint8_t bmp180_simulator_clear_count(void)
+{
+    gs_read = 0;
+    gs_write = 0;
+    gs_bytes = 0;
+    
+    return 0;
+}
+
+/**
+ * @brief     link all simulator functions to a handle
+ * @param[in] *handle pointer to a bmp180 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      debug_print is linked to bmp180_interface_debug_print
+ */
+uint8_t bmp180_simulator_link(bmp180_handle_t *handle)
+{
+    if (handle == NULL)
+    {
+        return 2;
+    }
+    
+    /* link simulator function */
+    DRIVER_BMP180_LINK_INIT(handle, bmp180_handle_t);
+    DRIVER_BMP180_LINK_IIC_INIT(handle, bmp180_simulator_iic_init);
+    DRIVER_BMP180_LINK_IIC_DEINIT(handle, bmp180_simulator_iic_deinit);
+    DRIVER_BMP180_LINK_IIC_READ(handle, bmp180_simulator_iic_read);
+    DRIVER_BMP180_LINK_IIC_WRITE(handle, bmp180_simulator_iic_write);
+    DRIVER_BMP180_LINK_DELAY_MS(handle, bmp180_simulator_delay_ms);
+    DRIVER_BMP180_LINK_DELAY_US(handle, bmp180_simulator_delay_us);
+    DRIVER_BMP180_LINK_TIMESTAMP_MS(handle, bmp180_simulator_timestamp_ms);
+    DRIVER_BMP180_LINK_TIMESTAMP_NS(handle, bmp180_simulator_timestamp_ns);
+    DRIVER_BMP180_LINK_WAIT_EOC(handle, bmp180_simulator_wait_eoc);
+    DRIVER_BMP180_LINK_DEBUG_PRINT(handle, bmp180_interface_debug_print);
+    
+    return 0;
+}
+
+/**
+ * @brief     link a simulator device to a handle
+ * @param[in] *handle pointer to a bmp180 handle structure
+ * @param[in] *device pointer to a simulator device structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle or device is NULL
+ * @note      the iic functions and wait_eoc are linked with the device as the user context
+ */
+uint8_t bmp180_simulator_link_device(bmp180_handle_t *handle, bmp180_simulator_device_t *device)
+{
+    if ((handle == NULL) || (device == NULL))
+    {
+        return 2;
+    }
+    
+    /* link simulator function */
+    DRIVER_BMP180_LINK_INIT(handle, bmp180_handle_t);
+    DRIVER_BMP180_LINK_IIC_INIT_CTX(handle, bmp180_simulator_iic_init_ctx);
+    DRIVER_BMP180_LINK_IIC_DEINIT_CTX(handle, bmp180_simulator_iic_deinit_ctx);
+    DRIVER_BMP180_LINK_IIC_READ_CTX(handle, bmp180_simulator_iic_read_ctx);
+    DRIVER_BMP180_LINK_IIC_WRITE_CTX(handle, bmp180_simulator_iic_write_ctx);
+    DRIVER_BMP180_LINK_USER(handle, device);
+    DRIVER_BMP180_LINK_DELAY_MS(handle, bmp180_simulator_delay_ms);
+    DRIVER_BMP180_LINK_DELAY_US(handle, bmp180_simulator_delay_us);
+    DRIVER_BMP180_LINK_TIMESTAMP_MS(handle, bmp180_simulator_timestamp_ms);
+    DRIVER_BMP180_LINK_TIMESTAMP_NS(handle, bmp180_simulator_timestamp_ns);
+    DRIVER_BMP180_LINK_WAIT_EOC_CTX(handle, bmp180_simulator_wait_eoc_ctx);
+    DRIVER_BMP180_LINK_DEBUG_PRINT(handle, bmp180_interface_debug_print);
+    
+    return 0;
+}
+
+/**
+ * @brief  simulator iic bus init
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+uint8_t bmp180_simulator_iic_init(void)
+{
+    return 0;
+}
+
+/**
+ * @brief  simulator iic bus deinit
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+uint8_t bmp180_simulator_iic_deinit(void)
+{
+    return 0;
+}
+
+/**
+ * @brief      simulator iic bus read
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       it reads the default device
+ */
+uint8_t bmp180_simulator_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    return a_simulator_read(&gs_device, addr, reg, buf, len);
+}
+
+/**
+ * @brief     simulator iic bus write
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      it writes the default device
+ */
+uint8_t bmp180_simulator_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    return a_simulator_write(&gs_device, addr, reg, buf, len);
+}
+
+/**
+ * @brief     simulator iic bus init with a device
+ * @param[in] *user pointer to a simulator device structure
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+uint8_t bmp180_simulator_iic_init_ctx(void *user)
+{
+    (void)user;
+    
+    return 0;
+}
+
+/**
+ * @brief     simulator iic bus deinit with a device
+ * @param[in] *user pointer to a simulator device structure
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+uint8_t bmp180_simulator_iic_deinit_ctx(void *user)
+{
+    (void)user;
+    
+    return 0;
+}
+
+/**
+ * @brief      simulator iic bus read with a device
+ * @param[in]  *user pointer to a simulator device structure
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t bmp180_simulator_iic_read_ctx(void *user, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    return a_simulator_read((bmp180_simulator_device_t *)user, addr, reg, buf, len);
+}
+
+/**
+ * @brief     simulator iic bus write with a device
+ * @param[in] *user pointer to a simulator device structure
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t bmp180_simulator_iic_write_ctx(void *user, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    return a_simulator_write((bmp180_simulator_device_t *)user, addr, reg, buf, len);
+}
+
+/**
+ * @brief     simulator delay ms
+ * @param[in] ms time
+ * @note      it only advances the virtual clock
+ */
+void bmp180_simulator_delay_ms(uint32_t ms)
+{
+    gs_time_ns += (uint64_t)ms * 1000000ULL;
+}
+
+/**
+ * @brief     simulator delay us
+ * @param[in] us time
+ * @note      it only advances the virtual clock
+ */
+void bmp180_simulator_delay_us(uint32_t us)
+{
+    gs_time_ns += (uint64_t)us * 1000ULL;
+}
+
+/**
+ * @brief  simulator timestamp ms
+ * @return virtual time in ms
+ * @note   none
+ */
+uint32_t bmp180_simulator_timestamp_ms(void)
+{
+    return (uint32_t)(gs_time_ns / 1000000ULL);
+}
+
+/**
+ * @brief  simulator timestamp us
+ * @return virtual time in us
+ * @note   none
+ */
+uint64_t bmp180_simulator_timestamp_us(void)
+{
+    return gs_time_ns / 1000ULL;
+}
+
+/**
+ * @brief  simulator timestamp ns
+ * @return virtual time in ns
+ * @note   none
+ */
+uint64_t bmp180_simulator_timestamp_ns(void)
+{
+    return gs_time_ns;
+}
+
+/**
+ * @brief     simulator wait eoc
+ * @param[in] us timeout in us
+ * @return    status code
+ *            - 0 success
+ *            - 1 timeout
+ * @note      it advances the virtual clock to the end of the running conversion of the default device
+ */
+uint8_t bmp180_simulator_wait_eoc(uint32_t us)
+{
+    return a_simulator_wait_eoc(&gs_device, us);
+}
+
+/**
+ * @brief     simulator wait eoc with a device
+ * @param[in] *user pointer to a simulator device structure
+ * @param[in] us timeout in us
+ * @return    status code
+ *            - 0 success
+ *            - 1 timeout
+ * @note      it advances the virtual clock to the end of the running conversion of the device
+ */
+uint8_t bmp180_simulator_wait_eoc_ctx(void *user, uint32_t us)
+{
+    return a_simulator_wait_eoc((bmp180_simulator_device_t *)user, us);
+}
@@ -0,0 +1,342 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_bmp180_simulator.h
+ * @brief     driver bmp180 simulator header file
+ * @version   2.1.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>2.1      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+#ifndef DRIVER_BMP180_SIMULATOR_H
+#define DRIVER_BMP180_SIMULATOR_H
+
+#include "driver_bmp180_interface.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup bmp180_simulator_driver bmp180 simulator driver function
+ * @brief    bmp180 simulator driver modules
+ * @ingroup  bmp180_driver
+ * @{
+ */
+
+/**
+ * @brief bmp180 simulator trajectory structure definition
+ */
+typedef struct bmp180_simulator_trajectory_s
+{
+    int32_t temperature;               /**< start temperature in 0.1 degrees celsius */
+    int32_t temperature_slope;         /**< temperature slope in 0.1 degrees celsius per hour */
+    int32_t pressure;                  /**< start pressure in pa */
+    int32_t pressure_slope;            /**< pressure slope in pa per hour */
+    int32_t pressure_amplitude;        /**< pressure sine amplitude in pa */
+    uint32_t pressure_period_ms;       /**< pressure sine period in ms, 0 disables the sine */
+    uint32_t pressure_noise;           /**< peak pressure noise in pa */
+} bmp180_simulator_trajectory_t;
+
+/**
+ * @brief bmp180 simulator device structure definition
+ */
+typedef struct bmp180_simulator_device_s
+{
+    uint8_t reg[256];         /**< register map */
+    uint64_t done_ns;         /**< end of the running conversion */
+    uint8_t conversion;       /**< running conversion */
+    uint8_t oss;              /**< oss of the running conversion */
+    uint16_t ut;              /**< last raw temperature */
+    int32_t temperature;      /**< last true temperature */
+    int32_t pa;               /**< last true pressure */
+} bmp180_simulator_device_t;
+
+/**
+ * @brief     initialize the simulator
+ * @param[in] *calibration pointer to the 22 calibration register bytes from 0xAA, NULL uses the datasheet example
+ * @return    status code
+ *            - 0 success
+ * @note      the virtual clock, the registers, the counters and the trajectory are reset,
+ *            the default trajectory is a constant 25.0C and 101325pa
+ */
+uint8_t bmp180_simulator_init(const uint8_t *calibration);
+
+/**
+ * @brief     initialize a simulator device
+ * @param[in] *device pointer to a simulator device structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 device is NULL
+ * @note      the device gets the calibration of bmp180_simulator_init,
+ *            all devices share the virtual clock, the trajectory, the bus and the counters
+ */
+uint8_t bmp180_simulator_device_init(bmp180_simulator_device_t *device);
+
+/**
+ * @brief     set the trajectory
+ * @param[in] *trajectory pointer to a trajectory structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 trajectory is NULL
+ * @note      it clears the trajectory callback
+ */
+uint8_t bmp180_simulator_set_trajectory(const bmp180_simulator_trajectory_t *trajectory);
+
+/**
+ * @brief     set the trajectory callback
+ * @param[in] *callback pointer to a trajectory callback
+ * @return    status code
+ *            - 0 success
+ * @note      the callback returns the temperature in 0.1 degrees celsius and the pressure in pa
+ *            at the virtual time in us, NULL restores the trajectory structure
+ */
+uint8_t bmp180_simulator_set_trajectory_callback(void (*callback)(uint64_t us, int32_t *temperature, int32_t *pa));
+
+/**
+ * @brief     set the iic bus speed
+ * @param[in] hz bus clock in hz
+ * @return    status code
+ *            - 0 success
+ * @note      every transfer advances the virtual clock by its bit time, 0 makes transfers free
+ */
+uint8_t bmp180_simulator_set_bus_speed(uint32_t hz);
+
+/**
+ * @brief     fail the next transfers
+ * @param[in] count number of failed transfers
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+uint8_t bmp180_simulator_inject_error(uint32_t count);
+
+/**
+ * @brief      get the true values of the last finished conversions
+ * @param[out] *temperature pointer to a temperature buffer in 0.1 degrees celsius
+ * @param[out] *pa pointer to a pressure buffer in pa
+ * @return     status code
+ *             - 0 success
+ * @note       the raw values are inverted from them with the integer compensation,
+ *             it reports the default device
+ */
+uint8_t bmp180_simulator_get_truth(int32_t *temperature, int32_t *pa);
+
+/**
+ * @brief      get the transfer counters
+ * @param[out] *read pointer to a read transfer counter buffer
+ * @param[out] *write pointer to a write transfer counter buffer
+ * @param[out] *bytes pointer to a transferred byte counter buffer
+ * @return     status code
+ *             - 0 success
+ * @note       bytes include the address and register bytes
+ */
+uint8_t bmp180_simulator_get_count(uint32_t *read, uint32_t *write, uint32_t *bytes);
+
+/**
+ * @brief  clear the transfer counters
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+uint8_t bmp180_simulator_clear_count(void);
+
+/**
+ * @brief     link all simulator functions to a handle
+ * @param[in] *handle pointer to a bmp180 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      debug_print is linked to bmp180_interface_debug_print
+ */
+uint8_t bmp180_simulator_link(bmp180_handle_t *handle);
+
+/**
+ * @brief     link a simulator device to a handle
+ * @param[in] *handle pointer to a bmp180 handle structure
+ * @param[in] *device pointer to a simulator device structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle or device is NULL
+ * @note      the iic functions and wait_eoc are linked with the device as the user context
+ */
+uint8_t bmp180_simulator_link_device(bmp180_handle_t *handle, bmp180_simulator_device_t *device);
+
+/**
+ * @brief  simulator iic bus init
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+uint8_t bmp180_simulator_iic_init(void);
+
+/**
+ * @brief  simulator iic bus deinit
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+uint8_t bmp180_simulator_iic_deinit(void);
+
+/**
+ * @brief      simulator iic bus read
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       it reads the default device
+ */
+uint8_t bmp180_simulator_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief     simulator iic bus write
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      it writes the default device
+ */
+uint8_t bmp180_simulator_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief     simulator iic bus init with a device
+ * @param[in] *user pointer to a simulator device structure
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+uint8_t bmp180_simulator_iic_init_ctx(void *user);
+
+/**
+ * @brief     simulator iic bus deinit with a device
+ * @param[in] *user pointer to a simulator device structure
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+uint8_t bmp180_simulator_iic_deinit_ctx(void *user);
+
+/**
+ * @brief      simulator iic bus read with a device
+ * @param[in]  *user pointer to a simulator device structure
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t bmp180_simulator_iic_read_ctx(void *user, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief     simulator iic bus write with a device
+ * @param[in] *user pointer to a simulator device structure
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t bmp180_simulator_iic_write_ctx(void *user, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief     simulator delay ms
+ * @param[in] ms time
+ * @note      it only advances the virtual clock
+ */
+void bmp180_simulator_delay_ms(uint32_t ms);
+
+/**
+ * @brief     simulator delay us
+ * @param[in] us time
+ * @note      it only advances the virtual clock
+ */
+void bmp180_simulator_delay_us(uint32_t us);
+
+/**
+ * @brief  simulator timestamp ms
+ * @return virtual time in ms
+ * @note   none
+ */
+uint32_t bmp180_simulator_timestamp_ms(void);
+
+/**
+ * @brief  simulator timestamp us
+ * @return virtual time in us
+ * @note   none
+ */
+uint64_t bmp180_simulator_timestamp_us(void);
+
+/**
+ * @brief  simulator timestamp ns
+ * @return virtual time in ns
+ * @note   none
+ */
+uint64_t bmp180_simulator_timestamp_ns(void);
+
+/**
+ * @brief     simulator wait eoc
+ * @param[in] us timeout in us
+ * @return    status code
+ *            - 0 success
+ *            - 1 timeout
+ * @note      it advances the virtual clock to the end of the running conversion of the default device
+ */
+uint8_t bmp180_simulator_wait_eoc(uint32_t us);
+
+/**
+ * @brief     simulator wait eoc with a device
+ * @param[in] *user pointer to a simulator device structure
+ * @param[in] us timeout in us
+ * @return    status code
+ *            - 0 success
+ *            - 1 timeout
+ * @note      it advances the virtual clock to the end of the running conversion of the device
+ */
+uint8_t bmp180_simulator_wait_eoc_ctx(void *user, uint32_t us);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,782 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_bmp180_simulator_test.c
+ * @brief     driver bmp180 simulator test source file
+ * @version   2.1.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>2.1      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+#include "driver_bmp180_simulator_test.h"
+#include "driver_bmp180_scheduler.h"
+#include "driver_bmp180_shared.h"
+#include "driver_bmp180_codec.h"
+
+static bmp180_handle_t gs_handle;        /**< bmp180 handle */
+static uint32_t gs_ctx_calls;            /**< ctx function calls */
+static uint32_t gs_ctx_eoc_calls;        /**< ctx wait_eoc calls */
+
+/**
+ * @brief     context iic init
+ * @param[in] *user pointer to the user context
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      none
+ */
+static uint8_t a_simulator_iic_init_ctx(void *user)
+{
+    if (user != &gs_ctx_calls)
+    {
+        return 1;
+    }
+    gs_ctx_calls++;
+    
+    return bmp180_simulator_iic_init();
+}
+
+/**
+ * @brief     context iic deinit
+ * @param[in] *user pointer to the user context
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      none
+ */
+static uint8_t a_simulator_iic_deinit_ctx(void *user)
+{
+    if (user != &gs_ctx_calls)
+    {
+        return 1;
+    }
+    gs_ctx_calls++;
+    
+    return bmp180_simulator_iic_deinit();
+}
+
+/**
+ * @brief      context iic read
+ * @param[in]  *user pointer to the user context
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+static uint8_t a_simulator_iic_read_ctx(void *user, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    if (user != &gs_ctx_calls)
+    {
+        return 1;
+    }
+    gs_ctx_calls++;
+    
+    return bmp180_simulator_iic_read(addr, reg, buf, len);
+}
+
+/**
+ * @brief     context iic write
+ * @param[in] *user pointer to the user context
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+static uint8_t a_simulator_iic_write_ctx(void *user, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    if (user != &gs_ctx_calls)
+    {
+        return 1;
+    }
+    gs_ctx_calls++;
+    
+    return bmp180_simulator_iic_write(addr, reg, buf, len);
+}
+
+/**
+ * @brief     context delay ms
+ * @param[in] *user pointer to the user context
+ * @param[in] ms time
+ * @note      none
+ */
+static void a_simulator_delay_ms_ctx(void *user, uint32_t ms)
+{
+    if (user == &gs_ctx_calls)
+    {
+        gs_ctx_calls++;
+    }
+    
+    bmp180_simulator_delay_ms(ms);
+}
+
+/**
+ * @brief     context delay us
+ * @param[in] *user pointer to the user context
+ * @param[in] us time
+ * @note      none
+ */
+static void a_simulator_delay_us_ctx(void *user, uint32_t us)
+{
+    if (user == &gs_ctx_calls)
+    {
+        gs_ctx_calls++;
+    }
+    
+    bmp180_simulator_delay_us(us);
+}
+
+/**
+ * @brief     context timestamp ms
+ * @param[in] *user pointer to the user context
+ * @return    virtual time in ms
+ * @note      none
+ */
+static uint32_t a_simulator_timestamp_ms_ctx(void *user)
+{
+    if (user == &gs_ctx_calls)
+    {
+        gs_ctx_calls++;
+    }
+    
+    return bmp180_simulator_timestamp_ms();
+}
+
+/**
+ * @brief     context wait eoc
+ * @param[in] *user pointer to the user context
+ * @param[in] us timeout in us
+ * @return    status code
+ *            - 0 success
+ *            - 1 timeout
+ * @note      none
+ */
+static uint8_t a_simulator_wait_eoc_ctx(void *user, uint32_t us)
+{
+    if (user != &gs_ctx_calls)
+    {
+        return 1;
+    }
+    gs_ctx_calls++;
+    gs_ctx_eoc_calls++;
+    
+    return bmp180_simulator_wait_eoc(us);
+}
+
+/**
+ * @brief     simulator test
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      it runs the driver against the simulated sensor without hardware
+ */
+uint8_t bmp180_simulator_test(uint32_t times)
+{
+    uint8_t res;
+    uint32_t i;
+    uint32_t j;
+    uint16_t temperature_yaw;
+    int32_t temperature;
+    uint32_t pressure_yaw;
+    uint32_t pressure_pa;
+    int32_t truth_temperature;
+    int32_t truth_pa;
+    bmp180_bool_t ready;
+    bmp180_simulator_trajectory_t trajectory;
+    const char *const wait_name[3] = {"poll", "timed", "eoc"};
+    
+    /* link simulator function */
+    (void)bmp180_simulator_init(NULL);
+    (void)bmp180_simulator_link(&gs_handle);
+    
+    /* start simulator test */
+    bmp180_interface_debug_print("bmp180: start simulator test.\n");
+    res = bmp180_init(&gs_handle);
+    if (res != 0)
+    {
+        bmp180_interface_debug_print("bmp180: init failed.\n");
+       
+        return 1;
+    }
+    
+    /* 200Pa sine over 10s on a falling pressure and a rising temperature */
+    trajectory.temperature = -105;
+    trajectory.temperature_slope = 100;
+    trajectory.pressure = 95000;
+    trajectory.pressure_slope = -2000;
+    trajectory.pressure_amplitude = 200;
+    trajectory.pressure_period_ms = 10000;
+    trajectory.pressure_noise = 0;
+    (void)bmp180_simulator_set_trajectory(&trajectory);
+    
+    /* every wait mode, burst readout and oss */
+    for (j = 0; j < 24; j++)
+    {
+        uint32_t start;
+        uint32_t read_count;
+        uint32_t write_count;
+        uint32_t bytes;
+        int32_t error;
+        int32_t error_max;
+        int32_t previous_temperature;
+        uint32_t previous_pa;
+        
+        (void)bmp180_set_wait_mode(&gs_handle, (bmp180_wait_mode_t)(j / 8));
+        (void)bmp180_set_burst_read(&gs_handle, (bmp180_bool_t)((j / 4) % 2));
+        (void)bmp180_set_mode(&gs_handle, (bmp180_mode_t)(j % 4));
+        (void)bmp180_simulator_clear_count();
+        start = bmp180_simulator_timestamp_ms();
+        error_max = 0;
+        for (i = 0; i < times; i++)
+        {
+            res = bmp180_read_temperature_pressure_fixed(&gs_handle, (uint16_t *)&temperature_yaw, (int32_t *)&temperature, 
+                                                         (uint32_t *)&pressure_yaw, (uint32_t *)&pressure_pa);
+            if (res != 0)
+            {
+                bmp180_interface_debug_print("bmp180: read failed.\n");
+                (void)bmp180_deinit(&gs_handle); 
+                
+                return 1;
+            }
+            
+            /* the raw pressure is the smallest one whose pressure is not below the truth */
+            (void)bmp180_simulator_get_truth(&truth_temperature, &truth_pa);
+            (void)bmp180_compensate(&gs_handle, (bmp180_mode_t)(j % 4), temperature_yaw, pressure_yaw - 1, 
+                                    &previous_temperature, &previous_pa);
+            error = (int32_t)pressure_pa - truth_pa;
+            if ((temperature != truth_temperature) || (error < 0) || ((int32_t)previous_pa >= truth_pa))
+            {
+                bmp180_interface_debug_print("bmp180: %d * 0.1C %dPa doesn't match %d * 0.1C %dPa.\n", 
+                                             temperature, pressure_pa, truth_temperature, truth_pa);
+                (void)bmp180_deinit(&gs_handle); 
+                
+                return 1;
+            }
+            error_max = (error > error_max) ? error : error_max;
+            bmp180_simulator_delay_ms(100);
+        }
+        (void)bmp180_simulator_get_count(&read_count, &write_count, &bytes);
+        bmp180_interface_debug_print("bmp180: %s wait mode burst %d oss %d max error %dPa, %d reads %d writes %d bytes in %dms.\n",
+                                     wait_name[j / 8], (uint32_t)((j / 4) % 2), (uint32_t)(j % 4), error_max, 
+                                     read_count, write_count, bytes, bmp180_simulator_timestamp_ms() - start - 100 * times);
+    }
+    (void)bmp180_set_wait_mode(&gs_handle, BMP180_WAIT_MODE_POLL);
+    (void)bmp180_set_burst_read(&gs_handle, BMP180_BOOL_FALSE);
+    
+    /* non-blocking conversions on the virtual clock */
+    bmp180_interface_debug_print("bmp180: simulator non-blocking read.\n");
+    (void)bmp180_set_mode(&gs_handle, BMP180_MODE_ULTRA_HIGH);
+    res = bmp180_start_temperature(&gs_handle);
+    if (res != 0)
+    {
+        bmp180_interface_debug_print("bmp180: start temperature failed.\n");
+        (void)bmp180_deinit(&gs_handle); 
+        
+        return 1;
+    }
+    bmp180_simulator_delay_us(4400);
+    (void)bmp180_poll_conversion(&gs_handle, &ready);
+    if (ready != BMP180_BOOL_FALSE)
+    {
+        bmp180_interface_debug_print("bmp180: conversion finished too early.\n");
+        (void)bmp180_deinit(&gs_handle); 
+        
+        return 1;
+    }
+    bmp180_simulator_delay_us(100);
+    res = bmp180_fetch_temperature_fixed(&gs_handle, (uint16_t *)&temperature_yaw, (int32_t *)&temperature);
+    if (res != 0)
+    {
+        bmp180_interface_debug_print("bmp180: fetch temperature failed.\n");
+        (void)bmp180_deinit(&gs_handle); 
+        
+        return 1;
+    }
+    res = bmp180_start_pressure(&gs_handle);
+    if (res != 0)
+    {
+        bmp180_interface_debug_print("bmp180: start pressure failed.\n");
+        (void)bmp180_deinit(&gs_handle); 
+        
+        return 1;
+    }
+    bmp180_simulator_delay_us(25500);
+    res = bmp180_fetch_pressure(&gs_handle, (uint32_t *)&pressure_yaw, (uint32_t *)&pressure_pa);
+    if (res != 0)
+    {
+        bmp180_interface_debug_print("bmp180: fetch pressure failed.\n");
+        (void)bmp180_deinit(&gs_handle); 
+        
+        return 1;
+    }
+    bmp180_interface_debug_print("bmp180: simulator non-blocking temperature: %d * 0.1C.\n", temperature);
+    bmp180_interface_debug_print("bmp180: simulator non-blocking pressure: %dPa.\n", pressure_pa);
+    
+    /* the timed mode doesn't fetch before the datasheet time */
+    bmp180_interface_debug_print("bmp180: simulator non-blocking timed read.\n");
+    (void)bmp180_set_wait_mode(&gs_handle, BMP180_WAIT_MODE_TIMED);
+    res = bmp180_start_temperature(&gs_handle);
+    if (res != 0)
+    {
+        bmp180_interface_debug_print("bmp180: start temperature failed.\n");
+        (void)bmp180_deinit(&gs_handle); 
+        
+        return 1;
+    }
+    bmp180_simulator_delay_us(4500);
+    res = bmp180_fetch_temperature_fixed(&gs_handle, (uint16_t *)&temperature_yaw, (int32_t *)&temperature);
+    if (res != 5)
+    {
+        bmp180_interface_debug_print("bmp180: early fetch is not rejected.\n");
+        (void)bmp180_deinit(&gs_handle); 
+        
+        return 1;
+    }
+    bmp180_simulator_delay_us(2500);
+    res = bmp180_fetch_temperature_fixed(&gs_handle, (uint16_t *)&temperature_yaw, (int32_t *)&temperature);
+    if (res != 0)
+    {
+        bmp180_interface_debug_print("bmp180: fetch temperature failed.\n");
+        (void)bmp180_deinit(&gs_handle); 
+        
+        return 1;
+    }
+    (void)bmp180_set_wait_mode(&gs_handle, BMP180_WAIT_MODE_POLL);
+    bmp180_interface_debug_print("bmp180: simulator non-blocking timed temperature: %d * 0.1C.\n", temperature);
+    
+    /* the eoc mode waits for the edge without reading CTRL_MEAS */
+    bmp180_interface_debug_print("bmp180: simulator non-blocking eoc read.\n");
+    (void)bmp180_set_wait_mode(&gs_handle, BMP180_WAIT_MODE_EOC);
+    res = bmp180_start_pressure(&gs_handle);
+    if (res != 0)
+    {
+        bmp180_interface_debug_print("bmp180: start pressure failed.\n");
+        (void)bmp180_deinit(&gs_handle); 
+        
+        return 1;
+    }
+    (void)bmp180_simulator_clear_count();
+    bmp180_simulator_delay_us(20000);
+    res = bmp180_fetch_pressure(&gs_handle, (uint32_t *)&pressure_yaw, (uint32_t *)&pressure_pa);
+    {
+        uint32_t read_count;
+        uint32_t write_count;
+        uint32_t bytes;
+        
+        (void)bmp180_simulator_get_count(&read_count, &write_count, &bytes);
+        if ((res != 5) || (read_count != 0))
+        {
+            bmp180_interface_debug_print("bmp180: early fetch is not rejected by the eoc check.\n");
+            (void)bmp180_deinit(&gs_handle); 
+            
+            return 1;
+        }
+    }
+    bmp180_simulator_delay_us(6000);
+    res = bmp180_fetch_pressure(&gs_handle, (uint32_t *)&pressure_yaw, (uint32_t *)&pressure_pa);
+    (void)bmp180_simulator_get_truth(&truth_temperature, &truth_pa);
+    if ((res != 0) || ((int32_t)pressure_pa < truth_pa))
+    {
+        bmp180_interface_debug_print("bmp180: fetch pressure failed.\n");
+        (void)bmp180_deinit(&gs_handle); 
+        
+        return 1;
+    }
+    (void)bmp180_set_wait_mode(&gs_handle, BMP180_WAIT_MODE_POLL);
+    bmp180_interface_debug_print("bmp180: simulator non-blocking eoc pressure: %dPa.\n", pressure_pa);
+    
+    /* bus error */
+    bmp180_interface_debug_print("bmp180: simulator bus error.\n");
+    (void)bmp180_simulator_inject_error(1);
+    res = bmp180_read_temperature_pressure_fixed(&gs_handle, (uint16_t *)&temperature_yaw, (int32_t *)&temperature, 
+                                                 (uint32_t *)&pressure_yaw, (uint32_t *)&pressure_pa);
+    if (res == 0)
+    {
+        bmp180_interface_debug_print("bmp180: bus error is not reported.\n");
+        (void)bmp180_deinit(&gs_handle); 
+        
+        return 1;
+    }
+    res = bmp180_read_temperature_pressure_fixed(&gs_handle, (uint16_t *)&temperature_yaw, (int32_t *)&temperature, 
+                                                 (uint32_t *)&pressure_yaw, (uint32_t *)&pressure_pa);
+    if (res != 0)
+    {
+        bmp180_interface_debug_print("bmp180: read after bus error failed.\n");
+        (void)bmp180_deinit(&gs_handle); 
+        
+        return 1;
+    }
+    
+    /* the ctx functions replace the bus functions */
+    bmp180_interface_debug_print("bmp180: simulator context functions.\n");
+    (void)bmp180_deinit(&gs_handle);
+    gs_ctx_calls = 0;
+    DRIVER_BMP180_LINK_IIC_INIT(&gs_handle, NULL);
+    DRIVER_BMP180_LINK_IIC_DEINIT(&gs_handle, NULL);
+    DRIVER_BMP180_LINK_IIC_READ(&gs_handle, NULL);
+    DRIVER_BMP180_LINK_IIC_WRITE(&gs_handle, NULL);
+    DRIVER_BMP180_LINK_IIC_INIT_CTX(&gs_handle, a_simulator_iic_init_ctx);
+    DRIVER_BMP180_LINK_IIC_DEINIT_CTX(&gs_handle, a_simulator_iic_deinit_ctx);
+    DRIVER_BMP180_LINK_IIC_READ_CTX(&gs_handle, a_simulator_iic_read_ctx);
+    DRIVER_BMP180_LINK_IIC_WRITE_CTX(&gs_handle, a_simulator_iic_write_ctx);
+    DRIVER_BMP180_LINK_USER(&gs_handle, &gs_ctx_calls);
+    res = bmp180_init(&gs_handle);
+    if (res != 0)
+    {
+        bmp180_interface_debug_print("bmp180: init with the context functions failed.\n");
+        
+        return 1;
+    }
+    res = bmp180_read_temperature_pressure_fixed(&gs_handle, (uint16_t *)&temperature_yaw, (int32_t *)&temperature, 
+                                                 (uint32_t *)&pressure_yaw, (uint32_t *)&pressure_pa);
+    if (res != 0)
+    {
+        bmp180_interface_debug_print("bmp180: read with the context functions failed.\n");
+        (void)bmp180_deinit(&gs_handle); 
+        
+        return 1;
+    }
+    
+    /* the ctx time and eoc functions replace the plain ones in every wait mode */
+    DRIVER_BMP180_LINK_DELAY_MS(&gs_handle, NULL);
+    DRIVER_BMP180_LINK_DELAY_US(&gs_handle, NULL);
+    DRIVER_BMP180_LINK_TIMESTAMP_MS(&gs_handle, NULL);
+    DRIVER_BMP180_LINK_WAIT_EOC(&gs_handle, NULL);
+    DRIVER_BMP180_LINK_DELAY_MS_CTX(&gs_handle, a_simulator_delay_ms_ctx);
+    DRIVER_BMP180_LINK_DELAY_US_CTX(&gs_handle, a_simulator_delay_us_ctx);
+    DRIVER_BMP180_LINK_TIMESTAMP_MS_CTX(&gs_handle, a_simulator_timestamp_ms_ctx);
+    DRIVER_BMP180_LINK_WAIT_EOC_CTX(&gs_handle, a_simulator_wait_eoc_ctx);
+    gs_ctx_eoc_calls = 0;
+    res = bmp180_set_temperature_reuse(&gs_handle, 0, 1000);
+    for (j = 0; j < 3; j++)
+    {
+        res |= bmp180_set_wait_mode(&gs_handle, (bmp180_wait_mode_t)j);
+        res |= bmp180_read_temperature_pressure_fixed(&gs_handle, (uint16_t *)&temperature_yaw, (int32_t *)&temperature, 
+                                                      (uint32_t *)&pressure_yaw, (uint32_t *)&pressure_pa);
+    }
+    res |= bmp180_set_temperature_reuse(&gs_handle, 0, 0);
+    res |= bmp180_set_wait_mode(&gs_handle, BMP180_WAIT_MODE_POLL);
+    if ((res != 0) || (gs_ctx_eoc_calls == 0))
+    {
+        bmp180_interface_debug_print("bmp180: wait with the context functions failed.\n");
+        (void)bmp180_deinit(&gs_handle); 
+        
+        return 1;
+    }
+    bmp180_interface_debug_print("bmp180: %d context function calls.\n", gs_ctx_calls);
+    
+    /* the scheduler interleaves the conversions of several sensors */
+    bmp180_interface_debug_print("bmp180: simulator scheduler.\n");
+    {
+        static bmp180_simulator_device_t device[3];
+        static bmp180_handle_t handle[3];
+        bmp180_scheduler_sensor_t sensor[3];
+        bmp180_scheduler_t scheduler;
+        bmp180_sample_t sample[60];
+        uint64_t samples;
+        uint32_t single_mhz;
+        uint32_t rate_mhz;
+        uint8_t index;
+        uint8_t seen;
+        
+        for (j = 0; j < 3; j++)
+        {
+            (void)bmp180_simulator_device_init(&device[j]);
+            (void)bmp180_simulator_link_device(&handle[j], &device[j]);
+            res = bmp180_init(&handle[j]);
+            res |= bmp180_set_mode(&handle[j], (bmp180_mode_t)j);
+            if (res != 0)
+            {
+                bmp180_interface_debug_print("bmp180: scheduler sensor init failed.\n");
+                (void)bmp180_deinit(&gs_handle); 
+                
+                return 1;
+            }
+        }
+        
+        /* one sensor alone */
+        (void)bmp180_scheduler_init(&scheduler, sensor, 3, bmp180_simulator_timestamp_us, bmp180_simulator_delay_us);
+        (void)bmp180_scheduler_add(&scheduler, &handle[0], &index);
+        res = bmp180_scheduler_read(&scheduler, sample, 20);
+        (void)bmp180_scheduler_get_rate(&scheduler, &samples, &single_mhz);
+        if (res != 0)
+        {
+            bmp180_interface_debug_print("bmp180: scheduler read failed.\n");
+            (void)bmp180_deinit(&gs_handle); 
+            
+            return 1;
+        }
+        
+        /* all sensors together */
+        (void)bmp180_scheduler_init(&scheduler, sensor, 3, bmp180_simulator_timestamp_us, bmp180_simulator_delay_us);
+        for (j = 0; j < 3; j++)
+        {
+            (void)bmp180_scheduler_add(&scheduler, &handle[j], &index);
+        }
+        res = bmp180_scheduler_read(&scheduler, sample, 60);
+        (void)bmp180_scheduler_get_rate(&scheduler, &samples, &rate_mhz);
+        if (res != 0)
+        {
+            bmp180_interface_debug_print("bmp180: scheduler read failed.\n");
+            (void)bmp180_deinit(&gs_handle); 
+            
+            return 1;
+        }
+        seen = 0;
+        for (j = 0; j < 60; j++)
+        {
+            seen |= (uint8_t)(1 << sample[j].sensor);
+            if ((sample[j].mode != sample[j].sensor) || (sample[j].pa < 90000) || (sample[j].pa > 110000) ||
+                ((j != 0) && ((sample[j].timestamp_us < sample[j - 1].timestamp_us) || 
+                              (sample[j].sequence != sample[j - 1].sequence + 1))))
+            {
+                seen = 0;
+                
+                break;
+            }
+        }
+        if ((seen != 0x07) || (rate_mhz <= single_mhz))
+        {
+            bmp180_interface_debug_print("bmp180: scheduler doesn't interleave the sensors in completion order.\n");
+            (void)bmp180_deinit(&gs_handle); 
+            
+            return 1;
+        }
+        bmp180_interface_debug_print("bmp180: 1 sensor %d.%03dHz, 3 sensors %d.%03dHz.\n", 
+                                     single_mhz / 1000, single_mhz % 1000, rate_mhz / 1000, rate_mhz % 1000);
+        
+        /* one sensor on a period grid */
+        (void)bmp180_scheduler_init(&scheduler, sensor, 3, bmp180_simulator_timestamp_us, bmp180_simulator_delay_us);
+        (void)bmp180_scheduler_add(&scheduler, &handle[1], &index);
+        (void)bmp180_scheduler_set_sensor_timing(&scheduler, index, 50000, 0);
+        res = bmp180_scheduler_read(&scheduler, sample, 6);
+        (void)bmp180_scheduler_get_sensor_overruns(&scheduler, index, &samples);
+        if ((res != 0) || (samples != 0) || (bmp180_scheduler_wake(&scheduler, index) != 5))
+        {
+            bmp180_interface_debug_print("bmp180: scheduler period read failed.\n");
+            (void)bmp180_deinit(&gs_handle); 
+            
+            return 1;
+        }
+        for (j = 2; j < 6; j++)
+        {
+            if ((sample[j].timestamp_us - sample[j - 1].timestamp_us < 45000) || 
+                (sample[j].timestamp_us - sample[j - 1].timestamp_us > 55000))
+            {
+                bmp180_interface_debug_print("bmp180: scheduler doesn't keep the period grid.\n");
+                (void)bmp180_deinit(&gs_handle); 
+                
+                return 1;
+            }
+        }
+        
+        /* a period shorter than the conversion skips the missed grid points */
+        (void)bmp180_scheduler_set_sensor_timing(&scheduler, index, 1000, 0);
+        res = bmp180_scheduler_read(&scheduler, sample, 6);
+        (void)bmp180_scheduler_get_sensor_overruns(&scheduler, index, &samples);
+        if ((res != 0) || (samples == 0))
+        {
+            bmp180_interface_debug_print("bmp180: scheduler doesn't count the overruns.\n");
+            (void)bmp180_deinit(&gs_handle); 
+            
+            return 1;
+        }
+        bmp180_interface_debug_print("bmp180: scheduler period grid with %d overruns.\n", (uint32_t)samples);
+        
+        /* the read gives up when every transfer fails */
+        (void)bmp180_simulator_inject_error(0xFFFFFFFFU);
+        res = bmp180_scheduler_read(&scheduler, sample, 60);
+        (void)bmp180_simulator_inject_error(0);
+        if (res != 5)
+        {
+            bmp180_interface_debug_print("bmp180: scheduler read doesn't report the failed sensors.\n");
+            (void)bmp180_deinit(&gs_handle); 
+            
+            return 1;
+        }
+        for (j = 0; j < 3; j++)
+        {
+            (void)bmp180_deinit(&handle[j]);
+        }
+    }
+    
+    /* the shared handle starts a conversion or returns a fresh enough sample */
+    bmp180_interface_debug_print("bmp180: simulator shared handle.\n");
+    {
+        bmp180_shared_t shared;
+        bmp180_sample_t sample[3];
+        uint32_t conversions;
+        uint32_t joined;
+        uint32_t hits;
+        
+        res = bmp180_shared_init(&shared, &gs_handle, bmp180_simulator_timestamp_us, bmp180_simulator_delay_us);
+        if (res != 0)
+        {
+            bmp180_interface_debug_print("bmp180: shared init failed.\n");
+            (void)bmp180_deinit(&gs_handle); 
+            
+            return 1;
+        }
+        res = bmp180_shared_read(&shared, 0, &sample[0]);
+        bmp180_simulator_delay_ms(500);
+        res |= bmp180_shared_read(&shared, 1000000, &sample[1]);
+        bmp180_simulator_delay_ms(1000);
+        res |= bmp180_shared_read(&shared, 1000000, &sample[2]);
+        (void)bmp180_shared_get_counter(&shared, &conversions, &joined, &hits);
+        if ((res != 0) || (conversions != 2) || (hits != 1) || 
+            (sample[1].sequence != sample[0].sequence) || (sample[2].sequence == sample[0].sequence))
+        {
+            bmp180_interface_debug_print("bmp180: shared handle doesn't reuse the fresh sample.\n");
+            (void)bmp180_deinit(&gs_handle); 
+            
+            return 1;
+        }
+        bmp180_interface_debug_print("bmp180: %d conversions for 3 reads, %d cached.\n", conversions, hits);
+    }
+    
+    /* the codec returns the raw values and the compensation of every sample */
+    bmp180_interface_debug_print("bmp180: simulator codec.\n");
+    {
+        static uint8_t chunk[BMP180_CODEC_HEADER_SIZE + 64 * BMP180_CODEC_SAMPLE_MAX];
+        bmp180_sample_t sample[64];
+        bmp180_sample_t decoded;
+        bmp180_codec_t codec;
+        bmp180_mode_t mode;
+        uint32_t len;
+        
+        (void)bmp180_get_mode(&gs_handle, &mode);
+        (void)bmp180_codec_encoder_init(&codec, chunk, sizeof(chunk), 1);
+        for (j = 0; j < 64; j++)
+        {
+            memset(&sample[j], 0, sizeof(bmp180_sample_t));
+            sample[j].timestamp_us = bmp180_simulator_timestamp_us();
+            sample[j].sequence = j;
+            sample[j].mode = (uint8_t)mode;
+            res = bmp180_read_temperature_pressure_fixed(&gs_handle, &sample[j].ut, &sample[j].temperature, 
+                                                         &sample[j].up, &sample[j].pa);
+            res |= bmp180_codec_encode(&codec, &sample[j]);
+            if (res != 0)
+            {
+                bmp180_interface_debug_print("bmp180: codec encode failed.\n");
+                (void)bmp180_deinit(&gs_handle); 
+                
+                return 1;
+            }
+            bmp180_simulator_delay_ms(1000);
+        }
+        (void)bmp180_codec_encoder_finish(&codec, &len);
+        res = bmp180_codec_decoder_init(&codec, &gs_handle, chunk, len);
+        for (j = 0; (res == 0) && (j < 64); j++)
+        {
+            res = bmp180_codec_decode(&codec, &decoded);
+            if ((res == 0) && (memcmp(&decoded, &sample[j], sizeof(bmp180_sample_t)) != 0))
+            {
+                res = 1;
+            }
+        }
+        if ((res != 0) || (bmp180_codec_decode(&codec, &decoded) != 4))
+        {
+            bmp180_interface_debug_print("bmp180: codec doesn't return the samples.\n");
+            (void)bmp180_deinit(&gs_handle); 
+            
+            return 1;
+        }
+        bmp180_interface_debug_print("bmp180: 64 samples in %d bytes.\n", len);
+    }
+    
+#if (BMP180_METRICS_ENABLE == 1)
+    /* the metrics match the bus traffic and the conversions */
+    bmp180_interface_debug_print("bmp180: simulator metrics.\n");
+    {
+        bmp180_metrics_t metrics;
+        uint32_t read_count;
+        uint32_t write_count;
+        uint32_t bytes;
+        uint32_t sum;
+        
+        (void)bmp180_clear_metrics(&gs_handle);
+        (void)bmp180_simulator_clear_count();
+        for (i = 0; i < times; i++)
+        {
+            res = bmp180_read_temperature_pressure_fixed(&gs_handle, (uint16_t *)&temperature_yaw, (int32_t *)&temperature, 
+                                                         (uint32_t *)&pressure_yaw, (uint32_t *)&pressure_pa);
+            if (res != 0)
+            {
+                bmp180_interface_debug_print("bmp180: read failed.\n");
+                (void)bmp180_deinit(&gs_handle); 
+                
+                return 1;
+            }
+        }
+        (void)bmp180_simulator_inject_error(1);
+        (void)bmp180_read_temperature_pressure_fixed(&gs_handle, (uint16_t *)&temperature_yaw, (int32_t *)&temperature, 
+                                                     (uint32_t *)&pressure_yaw, (uint32_t *)&pressure_pa);
+        (void)bmp180_get_metrics(&gs_handle, &metrics);
+        (void)bmp180_simulator_get_count(&read_count, &write_count, &bytes);
+        sum = 0;
+        for (j = 0; j < BMP180_METRICS_BUCKETS; j++)
+        {
+            sum += metrics.conversion_ns[j];
+        }
+        if ((metrics.iic_reads != read_count) || (metrics.iic_writes != write_count) || 
+            (metrics.iic_read_errors + metrics.iic_write_errors != 1) || 
+            (metrics.conversions != 2 * times) || (sum != metrics.conversions))
+        {
+            bmp180_interface_debug_print("bmp180: metrics don't match the simulator.\n");
+            (void)bmp180_deinit(&gs_handle); 
+            
+            return 1;
+        }
+        bmp180_interface_debug_print("bmp180: %d iic reads %d iic writes %d errors %d conversions %d polls, max %d polls.\n",
+                                     metrics.iic_reads, metrics.iic_writes, metrics.iic_read_errors + metrics.iic_write_errors, 
+                                     metrics.conversions, metrics.polls, metrics.polls_max);
+        for (j = 0; j < BMP180_METRICS_BUCKETS; j++)
+        {
+            if (metrics.conversion_ns[j] != 0)
+            {
+                bmp180_interface_debug_print("bmp180: conversion %dns-%dns: %d.\n", 
+                                             (uint32_t)(1UL << j), (uint32_t)((2UL << j) - 1), metrics.conversion_ns[j]);
+            }
+        }
+    }
+    
+#endif
+    /* finish simulator test */
+    bmp180_interface_debug_print("bmp180: finish simulator test.\n");
+    (void)bmp180_deinit(&gs_handle); 
+    
+    return 0;
+}